@@ -119,14 +119,20 @@ SOURCES += src/main.cpp \
     src/concerts/ConcertModel.cpp \
     src/concerts/ConcertProxyModel.cpp \
     src/data/Database.cpp \
+    src/data/ImageBlob.cpp \
     src/data/ImageCache.cpp \
+    src/data/LibrarySearchIndex.cpp \
     src/data/ResumeTime.cpp \
     src/movies/Movie.cpp \
+    src/movies/MovieDuplicateFinder.cpp \
+    src/movies/file_searcher/MovieFileGrouping.cpp \
     src/movies/file_searcher/MovieFileSearcher.cpp \
+    src/movies/file_searcher/MovieLibraryWatcher.cpp \
     src/movies/MovieFilesOrganizer.cpp \
     src/movies/MovieImages.cpp \
     src/movies/MovieModel.cpp \
     src/movies/MovieProxyModel.cpp \
+    src/movies/MovieSaveQueue.cpp \
     src/data/Locale.cpp \
     src/data/Rating.cpp \
     src/data/Storage.cpp \
@@ -142,16 +148,24 @@ SOURCES += src/main.cpp \
     src/ui/export/ExportDialog.cpp \
     src/ui/imports/UnpackButtons.cpp \
     src/imports/MakeMkvCon.cpp \
-    src/imports/MyFile.cpp \
     src/imports/Extractor.cpp \
+    src/imports/ExtractionQueue.cpp \
     src/imports/FileWorker.cpp \
     src/imports/DownloadFileSearcher.cpp \
+    src/log/AsyncLogWriter.cpp \
     src/log/Log.cpp \
+    src/log/StartupProfiler.cpp \
+    src/log/Tracer.cpp \
     src/export/ExportTemplate.cpp \
     src/export/ExportTemplateLoader.cpp \
     src/export/MediaExport.cpp \
     src/export/SimpleEngine.cpp \
+    src/file/DirectoryListingCache.cpp \
+    src/file/FileCopier.cpp \
     src/file/FileFilter.cpp \
+    src/file/FileNameMatcher.cpp \
+    src/file/FileWriteBatch.cpp \
+    src/file/InotifyWatcher.cpp \
     src/file/Path.cpp \
     src/globals/Actor.cpp \
     src/globals/ComboDelegate.cpp \
@@ -168,12 +182,16 @@ SOURCES += src/main.cpp \
     src/globals/Math.cpp \
     src/globals/Meta.cpp \
     src/globals/NameFormatter.cpp \
+    src/network/HostRateLimiter.cpp \
     src/network/NetworkReplyWatcher.cpp \
+    src/network/NetworkService.cpp \
+    src/network/QueuedNetworkReply.cpp \
     src/network/WebsiteCache.cpp \
     src/globals/Poster.cpp \
     src/globals/ScraperInfos.cpp \
     src/globals/ScraperManager.cpp \
     src/globals/ScraperResult.cpp \
+    src/globals/StringPool.cpp \
     src/globals/Time.cpp \
     src/globals/TrailerDialog.cpp \
     src/globals/VersionInfo.cpp \
@@ -198,6 +216,7 @@ SOURCES += src/main.cpp \
     src/media_centers/kodi/ConcertXmlWriter.cpp \
     src/media_centers/kodi/EpisodeXmlWriter.cpp \
     src/media_centers/kodi/EpisodeXmlReader.cpp \
+    src/media_centers/kodi/KodiFileIndex.cpp \
     src/media_centers/kodi/KodiNfoMeta.cpp \
     src/media_centers/kodi/MovieXmlReader.cpp \
     src/media_centers/kodi/MovieXmlWriter.cpp \
@@ -279,6 +298,7 @@ SOURCES += src/main.cpp \
     src/scrapers/tv_show/TheTvDb.cpp \
     src/scrapers/tv_show/thetvdb/ApiRequest.cpp \
     src/scrapers/tv_show/thetvdb/Cache.cpp \
+    src/scrapers/tv_show/thetvdb/EpisodeBatchLoader.cpp \
     src/scrapers/tv_show/thetvdb/EpisodeLoader.cpp \
     src/scrapers/tv_show/thetvdb/EpisodeParser.cpp \
     src/scrapers/tv_show/thetvdb/Search.cpp \
@@ -357,6 +377,7 @@ SOURCES += src/main.cpp \
     src/data/ImdbId.cpp \
     src/data/TmdbId.cpp \
     src/tv_shows/TvDbId.cpp \
+    src/tv_shows/EpisodeFileNameParser.cpp \
     src/tv_shows/EpisodeNumber.cpp \
     src/tv_shows/SeasonNumber.cpp \
     src/tv_shows/SeasonOrder.cpp \
@@ -384,15 +405,21 @@ HEADERS  += Version.h \
     src/concerts/ConcertProxyModel.h \
     src/ui/concerts/ConcertStreamDetailsWidget.h \
     src/data/Database.h \
+    src/data/ImageBlob.h \
     src/data/ImageCache.h \
+    src/data/LibrarySearchIndex.h \
     src/data/ResumeTime.h \
     src/media_centers/MediaCenterInterface.h \
     src/movies/Movie.h \
+    src/movies/MovieDuplicateFinder.h \
+    src/movies/file_searcher/MovieFileGrouping.h \
     src/movies/file_searcher/MovieFileSearcher.h \
+    src/movies/file_searcher/MovieLibraryWatcher.h \
     src/movies/MovieFilesOrganizer.h \
     src/movies/MovieImages.h \
     src/movies/MovieModel.h \
     src/movies/MovieProxyModel.h \
+    src/movies/MovieSaveQueue.h \
     src/scrapers/image/ImageProviderInterface.h \
     src/scrapers/concert/ConcertScraperInterface.h \
     src/scrapers/music/MusicScraperInterface.h \
@@ -409,10 +436,13 @@ HEADERS  += Version.h \
     src/tv_shows/TvShowFileSearcher.h \
     src/imports/DownloadFileSearcher.h \
     src/imports/Extractor.h \
+    src/imports/ExtractionQueue.h \
     src/imports/FileWorker.h \
     src/imports/MakeMkvCon.h \
-    src/imports/MyFile.h \
+    src/log/AsyncLogWriter.h \
     src/log/Log.h \
+    src/log/StartupProfiler.h \
+    src/log/Tracer.h \
     src/ui/export/ExportDialog.h \
     src/ui/imports/DownloadsWidget.h \
     src/ui/imports/ImportActions.h \
@@ -423,9 +453,15 @@ HEADERS  += Version.h \
     src/export/ExportTemplateLoader.h \
     src/export/MediaExport.h \
     src/export/SimpleEngine.h \
+    src/file/DirectoryListingCache.h \
+    src/file/FileCopier.h \
     src/file/FileFilter.h \
+    src/file/FileNameMatcher.h \
+    src/file/FileWriteBatch.h \
+    src/file/InotifyWatcher.h \
     src/file/Path.h \
     src/globals/Actor.h \
+    src/globals/BatchCollector.h \
     src/globals/ComboDelegate.h \
     src/globals/DownloadManager.h \
     src/globals/DownloadManagerElement.h \
@@ -441,12 +477,17 @@ HEADERS  += Version.h \
     src/globals/Math.h \
     src/globals/Meta.h \
     src/globals/NameFormatter.h \
+    src/network/HostRateLimiter.h \
     src/network/NetworkReplyWatcher.h \
+    src/network/NetworkService.h \
+    src/network/QueuedNetworkReply.h \
+    src/network/SingleFlightCache.h \
     src/network/WebsiteCache.h \
     src/globals/Poster.h \
     src/globals/ScraperInfos.h \
     src/globals/ScraperManager.h \
     src/globals/ScraperResult.h \
+    src/globals/StringPool.h \
     src/globals/Time.h \
     src/globals/TrailerDialog.h \
     src/globals/VersionInfo.h \
@@ -476,6 +517,7 @@ HEADERS  += Version.h \
     src/media_centers/kodi/ConcertXmlWriter.h \
     src/media_centers/kodi/EpisodeXmlWriter.h \
     src/media_centers/kodi/EpisodeXmlReader.h \
+    src/media_centers/kodi/KodiFileIndex.h \
     src/media_centers/kodi/KodiNfoMeta.h \
     src/media_centers/kodi/MovieXmlReader.h \
     src/media_centers/kodi/MovieXmlWriter.h \
@@ -551,6 +593,7 @@ HEADERS  += Version.h \
     src/scrapers/tv_show/TheTvDb.h \
     src/scrapers/tv_show/thetvdb/ApiRequest.h \
     src/scrapers/tv_show/thetvdb/Cache.h \
+    src/scrapers/tv_show/thetvdb/EpisodeBatchLoader.h \
     src/scrapers/tv_show/thetvdb/EpisodeLoader.h \
     src/scrapers/tv_show/thetvdb/EpisodeParser.h \
     src/scrapers/tv_show/thetvdb/Search.h \
@@ -630,6 +673,7 @@ HEADERS  += Version.h \
     src/data/ImdbId.h \
     src/data/TmdbId.h \
     src/tv_shows/TvDbId.h \
+    src/tv_shows/EpisodeFileNameParser.h \
     src/tv_shows/EpisodeNumber.h \
     src/tv_shows/SeasonNumber.h \
     src/tv_shows/SeasonOrder.h \
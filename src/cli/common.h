@@ -1,6 +1,8 @@
 #pragma once
 
+#include <QEventLoop>
 #include <QMessageLogContext>
+#include <QObject>
 #include <QString>
 
 namespace mediaelch {
@@ -21,5 +23,17 @@ MediaType mediaTypeFromString(QString str);
 void setVerbosity(int level);
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg);
 
+/// \brief Starts a file searcher and blocks until the given "loaded" signal is emitted.
+/// File searchers scan in a worker thread and deliver their results through the
+/// event loop, so an event loop has to run until they are done.
+template<class Searcher, class Signal>
+void reloadAndWait(Searcher* searcher, Signal loadedSignal, bool force)
+{
+    QEventLoop loop;
+    QObject::connect(searcher, loadedSignal, &loop, &QEventLoop::quit);
+    searcher->reload(force);
+    loop.exec();
+}
+
 } // namespace cli
 } // namespace mediaelch
@@ -28,7 +28,7 @@ void listMovies()
 {
     Manager::instance()->movieFileSearcher()->setMovieDirectories(
         Settings::instance()->directorySettings().movieDirectories());
-    Manager::instance()->movieFileSearcher()->reload(false);
+    reloadAndWait(Manager::instance()->movieFileSearcher(), &MovieFileSearcher::moviesLoaded, false);
     MovieModel* movieModel = Manager::instance()->movieModel();
 
     TableLayout layout;
@@ -60,7 +60,7 @@ void listConcerts()
 {
     Manager::instance()->concertFileSearcher()->setConcertDirectories(
         Settings::instance()->directorySettings().concertDirectories());
-    Manager::instance()->concertFileSearcher()->reload(false);
+    reloadAndWait(Manager::instance()->concertFileSearcher(), &ConcertFileSearcher::concertsLoaded, false);
     ConcertModel* concertModel = Manager::instance()->concertModel();
 
     TableLayout layout;
@@ -100,7 +100,7 @@ void listMusic()
 {
     Manager::instance()->musicFileSearcher()->setMusicDirectories(
         Settings::instance()->directorySettings().musicDirectories());
-    Manager::instance()->musicFileSearcher()->reload(false);
+    reloadAndWait(Manager::instance()->musicFileSearcher(), &MusicFileSearcher::musicLoaded, false);
     MusicModel* musicModel = Manager::instance()->musicModel();
 
     TableLayout layout;
@@ -126,7 +126,7 @@ void listTvShows()
     // The global TvShowFilesWidget instance is set in its constructor...
     // TODO: Don't implicitly expect that it is instantiated somewhere.
     TvShowFilesWidget filesWidget;
-    Manager::instance()->tvShowFileSearcher()->reload(false);
+    reloadAndWait(Manager::instance()->tvShowFileSearcher(), &TvShowFileSearcher::tvShowsLoaded, false);
     TvShowModel* tvShowModel = Manager::instance()->tvShowModel();
 
     TableLayout layout;
@@ -4,6 +4,7 @@
 #include "cli/list.h"
 #include "cli/reload.h"
 #include "cli/show.h"
+#include "log/Tracer.h"
 #include "settings/Settings.h"
 
 #include <QApplication>
@@ -71,6 +72,8 @@ Options:
                    `mediaelch <command> --help` to the command.
  -v, --version     Print Mediaelch's version.
  --verbose=<level> Verbosity level (0: only errors, 4: everything)
+ --trace=<file>    Write a Chrome trace-event file that shows where the time
+                   was spent. Open it in chrome://tracing or ui.perfetto.dev.
 
 commands:
    list        List all media entries.
@@ -102,6 +105,7 @@ static int parseArguments(QApplication& app)
     // custom help option that lists all commands
     parser.addOption({{"h", "?", "help"}, "Print help"});
     parser.addOption({"verbose", "Verbosity level (0: only errors, 4: everything)", "level"});
+    parser.addOption({"trace", "Write a Chrome trace-event file", "file"});
     parser.addHelpOption();
     parser.addPositionalArgument("command", "The command to execute.");
 
@@ -113,6 +117,9 @@ static int parseArguments(QApplication& app)
         const int verbosity = QString(parser.value("verbose")).toInt();
         mediaelch::cli::setVerbosity(verbosity);
     }
+    if (parser.isSet("trace") && !mediaelch::Tracer::start(parser.value("trace"))) {
+        return 1;
+    }
 
     const QStringList args = parser.positionalArguments();
     const QString command = args.isEmpty() ? QString() : args.first();
@@ -160,5 +167,7 @@ int main(int argc, char** argv)
 
     Settings::instance(QCoreApplication::instance())->loadSettings();
 
-    return parseArguments(app);
+    const int ret = parseArguments(app);
+    mediaelch::Tracer::stop();
+    return ret;
 }
@@ -1,5 +1,6 @@
 #include "cli/reload.h"
 
+#include "cli/common.h"
 #include "globals/Manager.h"
 #include "movies/file_searcher/MovieFileSearcher.h"
 
@@ -12,7 +13,7 @@ void reloadMovies()
 {
     Manager::instance()->movieFileSearcher()->setMovieDirectories(
         Settings::instance()->directorySettings().movieDirectories());
-    Manager::instance()->movieFileSearcher()->reload(true);
+    reloadAndWait(Manager::instance()->movieFileSearcher(), &MovieFileSearcher::moviesLoaded, true);
     std::cout << "Movies reloaded." << std::endl;
 }
 
@@ -23,7 +24,7 @@ void reloadTvShows()
     // The global TvShowFilesWidget instance is set in its constructor...
     // TODO: Don't implicitly expect that it is instantiated somewhere.
     TvShowFilesWidget filesWidget;
-    Manager::instance()->tvShowFileSearcher()->reload(true);
+    reloadAndWait(Manager::instance()->tvShowFileSearcher(), &TvShowFileSearcher::tvShowsLoaded, true);
     std::cout << "Concerts reloaded." << std::endl;
 }
 
@@ -31,7 +32,7 @@ void reloadConcerts()
 {
     Manager::instance()->concertFileSearcher()->setConcertDirectories(
         Settings::instance()->directorySettings().concertDirectories());
-    Manager::instance()->concertFileSearcher()->reload(true);
+    reloadAndWait(Manager::instance()->concertFileSearcher(), &ConcertFileSearcher::concertsLoaded, true);
     std::cout << "Concerts reloaded." << std::endl;
 }
 
@@ -39,7 +40,7 @@ void reloadMusic()
 {
     Manager::instance()->musicFileSearcher()->setMusicDirectories(
         Settings::instance()->directorySettings().musicDirectories());
-    Manager::instance()->musicFileSearcher()->reload(true);
+    reloadAndWait(Manager::instance()->musicFileSearcher(), &MusicFileSearcher::musicLoaded, true);
     std::cout << "Music reloaded." << std::endl;
 }
 
@@ -8,6 +8,7 @@
 #include "data/StreamDetails.h"
 #include "globals/Helper.h"
 #include "globals/NameFormatter.h"
+#include "globals/StringPool.h"
 #include "media_centers/MediaCenterInterface.h"
 #include "settings/Settings.h"
 
@@ -28,10 +29,11 @@ Concert::Concert(const mediaelch::FileList& files, QObject* parent) :
     m_syncNeeded{false},
     m_hasExtraFanarts{false}
 {
-    moveToThread(QApplication::instance()->thread());
     static int s_idCounter = 0;
     m_concert.concertId = ++s_idCounter;
     setFiles(files);
+    // Move after setFiles() so that child objects created there are moved as well.
+    moveToThread(QApplication::instance()->thread());
 }
 
 void Concert::setFiles(const mediaelch::FileList& files)
@@ -76,7 +78,7 @@ void Concert::clear(QSet<ConcertScraperInfo> infos)
 {
     if (infos.contains(ConcertScraperInfo::Backdrop)) {
         m_concert.backdrops.clear();
-        m_concert.images.insert(ImageType::ConcertBackdrop, QByteArray());
+        m_concert.images.insert(ImageType::ConcertBackdrop, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::ConcertBackdrop, false);
         m_imagesToRemove.removeOne(ImageType::ConcertBackdrop);
     }
@@ -85,7 +87,7 @@ void Concert::clear(QSet<ConcertScraperInfo> infos)
     }
     if (infos.contains(ConcertScraperInfo::Poster)) {
         m_concert.posters.clear();
-        m_concert.images.insert(ImageType::ConcertPoster, QByteArray());
+        m_concert.images.insert(ImageType::ConcertPoster, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::ConcertPoster, false);
         m_imagesToRemove.removeOne(ImageType::ConcertPoster);
     }
@@ -116,11 +118,11 @@ void Concert::clear(QSet<ConcertScraperInfo> infos)
         m_concert.tags.clear();
     }
     if (infos.contains(ConcertScraperInfo::ExtraArts)) {
-        m_concert.images.insert(ImageType::ConcertCdArt, QByteArray());
+        m_concert.images.insert(ImageType::ConcertCdArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::ConcertCdArt, false);
-        m_concert.images.insert(ImageType::ConcertLogo, QByteArray());
+        m_concert.images.insert(ImageType::ConcertLogo, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::ConcertLogo, false);
-        m_concert.images.insert(ImageType::ConcertClearArt, QByteArray());
+        m_concert.images.insert(ImageType::ConcertClearArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::ConcertClearArt, false);
         m_imagesToRemove.removeOne(ImageType::ConcertCdArt);
         m_imagesToRemove.removeOne(ImageType::ConcertClearArt);
@@ -767,13 +769,13 @@ void Concert::addGenre(QString genre)
     if (genre.isEmpty()) {
         return;
     }
-    m_concert.genres.append(genre);
+    m_concert.genres.append(mediaelch::StringPool::intern(genre));
     setChanged(true);
 }
 
 void Concert::addTag(QString tag)
 {
-    m_concert.tags.append(tag);
+    m_concert.tags.append(mediaelch::StringPool::intern(tag));
     setChanged(true);
 }
 
@@ -824,13 +826,18 @@ void Concert::removeTag(QString tag)
 
 void Concert::addExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.append(fanart);
+    m_extraFanartImagesToAdd.append(mediaelch::ImageBlob(fanart));
     setChanged(true);
 }
 
 void Concert::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i = 0; i < m_extraFanartImagesToAdd.size(); ++i) {
+        if (m_extraFanartImagesToAdd.at(i).hasSameData(fanart)) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setChanged(true);
 }
 
@@ -855,9 +862,9 @@ QVector<ExtraFanart> Concert::extraFanarts(MediaCenterInterface* mediaCenterInte
         f.path = file;
         fanarts.append(f);
     }
-    for (const QByteArray& img : m_extraFanartImagesToAdd) {
+    for (const mediaelch::ImageBlob& img : m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -870,7 +877,11 @@ QStringList Concert::extraFanartsToRemove()
 
 QVector<QByteArray> Concert::extraFanartImagesToAdd()
 {
-    return m_extraFanartImagesToAdd;
+    QVector<QByteArray> images;
+    for (const mediaelch::ImageBlob& image : m_extraFanartImagesToAdd) {
+        images.append(image.data());
+    }
+    return images;
 }
 
 void Concert::clearExtraFanartData()
@@ -901,8 +912,8 @@ QVector<ImageType> Concert::imagesToRemove() const
 
 void Concert::removeImage(ImageType type)
 {
-    if (!m_concert.images.value(type, QByteArray()).isNull()) {
-        m_concert.images.insert(type, QByteArray());
+    if (!m_concert.images.value(type).isNull()) {
+        m_concert.images.insert(type, mediaelch::ImageBlob());
         m_hasImageChanged.insert(type, false);
     } else if (!m_imagesToRemove.contains(type)) {
         m_imagesToRemove.append(type);
@@ -926,7 +937,7 @@ QVector<ImageType> Concert::imageTypes()
 
 QByteArray Concert::image(ImageType imageType)
 {
-    return m_concert.images.value(imageType, QByteArray());
+    return m_concert.images.value(imageType).data();
 }
 
 bool Concert::imageHasChanged(ImageType imageType)
@@ -936,7 +947,7 @@ bool Concert::imageHasChanged(ImageType imageType)
 
 void Concert::setImage(ImageType imageType, QByteArray image)
 {
-    m_concert.images.insert(imageType, image);
+    m_concert.images.insert(imageType, mediaelch::ImageBlob(image));
     m_hasImageChanged.insert(imageType, true);
     setChanged(true);
 }
@@ -2,6 +2,7 @@
 
 #include "concerts/ConcertController.h"
 #include "data/Certification.h"
+#include "data/ImageBlob.h"
 #include "data/ImdbId.h"
 #include "data/Rating.h"
 #include "data/TmdbId.h"
@@ -58,7 +59,7 @@ public:
     QStringList extraFanarts;
 
     StreamDetails* streamDetails = nullptr;
-    QMap<ImageType, QByteArray> images;
+    QMap<ImageType, ImageBlob> images;
 };
 
 } // namespace mediaelch
@@ -208,7 +209,7 @@ private:
     bool m_hasExtraFanarts;
 
     QMap<ImageType, bool> m_hasImageChanged;
-    QVector<QByteArray> m_extraFanartImagesToAdd;
+    QVector<mediaelch::ImageBlob> m_extraFanartImagesToAdd;
     QVector<ImageType> m_imagesToRemove;
     QMap<ImageType, bool> m_hasImage;
 };
@@ -1,17 +1,33 @@
 #include "ConcertFileSearcher.h"
 
-#include <QApplication>
+#include <QCoreApplication>
 #include <QDebug>
 #include <QSqlQuery>
 #include <QSqlRecord>
+#include <QtConcurrent/QtConcurrentRun>
 
+#include "globals/BatchCollector.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
+#include "log/Tracer.h"
 
 ConcertFileSearcher::ConcertFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::ConcertFileSearcherProgressMessageId}
 {
+    connect(this,
+        &ConcertFileSearcher::concertsBatchLoaded,
+        this,
+        &ConcertFileSearcher::onConcertsBatchLoaded,
+        Qt::QueuedConnection);
+    connect(
+        this, &ConcertFileSearcher::workerFinished, this, &ConcertFileSearcher::onWorkerFinished, Qt::QueuedConnection);
+}
+
+ConcertFileSearcher::~ConcertFileSearcher()
+{
+    m_aborted = true;
+    m_worker.waitForFinished();
 }
 
 void ConcertFileSearcher::setConcertDirectories(QVector<SettingsDir> directories)
@@ -39,25 +55,84 @@ void ConcertFileSearcher::setConcertDirectories(QVector<SettingsDir> directories
 /// Starts the scanning process
 ///
 ///  1. Clear old concert entries if a reload is either forced here or in its settings
-///  2. Reload all entries from disk if it's forced here or in its directory settings
-///  3. Load all entries from the database
+///  2. Load all entries from the database that don't need to be reloaded
+///  3. Reload all other entries from disk in a worker thread
 void ConcertFileSearcher::reload(bool force)
 {
+    // Only one scan at a time. Deliver pending batches of a previous scan while
+    // m_aborted is still set so that they are discarded.
+    m_aborted = true;
+    m_worker.waitForFinished();
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+
     m_aborted = false;
 
     clearOldConcerts(force);
 
     emit searchStarted(tr("Searching for Concerts..."));
 
-    auto contents = loadContentsFromDiskIfRequired(force);
-    storeContentsInDatabase(contents);
+    // The database can only be used from the GUI thread.
+    QVector<SettingsDir> directoriesToScan;
+    QVector<Concert*> dbConcerts;
+    for (const SettingsDir& dir : m_directories) {
+        QVector<Concert*> concertsFromDb;
+        if (!dir.autoReload && !force) {
+            concertsFromDb = database().concertsInDirectory(dir.path);
+        }
+        if (concertsFromDb.isEmpty()) {
+            directoriesToScan.append(dir);
+        } else {
+            dbConcerts.append(concertsFromDb);
+        }
+    }
+
+    m_worker = QtConcurrent::run(this, &ConcertFileSearcher::loadConcerts, directoriesToScan, dbConcerts);
+}
+
+void ConcertFileSearcher::loadConcerts(QVector<SettingsDir> directoriesToScan, QVector<Concert*> dbConcerts)
+{
+    for (const SettingsDir& dir : directoriesToScan) {
+        if (m_aborted) {
+            break;
+        }
+        loadConcertsFromDisk(dir);
+    }
 
     emit currentDir("");
     emit searchStarted(tr("Loading Concerts..."));
 
-    addConcertsToGui(loadConcertsFromDatabase());
+    if (!m_aborted) {
+        setupDatabaseConcerts(dbConcerts);
+    }
 
     qDebug() << "Searching for concerts done";
+    emit workerFinished();
+}
+
+void ConcertFileSearcher::onConcertsBatchLoaded(QVector<Concert*> concerts, QString directory, bool storeInDatabase)
+{
+    ELCH_TRACE_SCOPE("scan", "Store concert batch", directory);
+    if (m_aborted) {
+        for (Concert* concert : concerts) {
+            concert->deleteLater();
+        }
+        return;
+    }
+
+    if (storeInDatabase) {
+        database().transaction();
+        for (Concert* concert : concerts) {
+            concert->setParent(this);
+            database().add(concert, directory);
+        }
+        database().commit();
+    }
+
+    Manager::instance()->concertModel()->addConcerts(concerts);
+}
+
+void ConcertFileSearcher::onWorkerFinished()
+{
     if (!m_aborted) {
         emit concertsLoaded();
     }
@@ -78,6 +153,7 @@ void ConcertFileSearcher::scanDir(QString startPath,
     bool separateFolders,
     bool firstScan)
 {
+    ELCH_TRACE_SCOPE("scan", "Scan concert directory", path);
     emit currentDir(path.mid(startPath.length()));
 
     QDir dir(path);
@@ -195,63 +271,35 @@ void ConcertFileSearcher::clearOldConcerts(bool forceClear)
     }
 }
 
-QVector<QStringList> ConcertFileSearcher::loadContentsFromDiskIfRequired(bool forceReload)
+void ConcertFileSearcher::loadConcertsFromDisk(const SettingsDir& dir)
 {
+    ELCH_TRACE_SCOPE("scan", "Load concerts from disk", dir.path.path());
+    const QString path = dir.path.path();
     QVector<QStringList> contents;
+    scanDir(path, path, contents, dir.separateFolders, true);
 
-    for (const SettingsDir& dir : m_directories) {
-        const QString path = dir.path.path();
-        QVector<Concert*> concertsFromDb = database().concertsInDirectory(dir.path);
-        if (dir.autoReload || forceReload || concertsFromDb.isEmpty()) {
-            scanDir(path, path, contents, dir.separateFolders, true);
-        }
-    }
-    return contents;
-}
+    BatchCollector<Concert*> collector(
+        [&](QVector<Concert*> concerts) { emit concertsBatchLoaded(concerts, path, true); });
 
-void ConcertFileSearcher::storeContentsInDatabase(const QVector<QStringList>& contents)
-{
-    // Setup concerts
-    database().transaction();
     for (const QStringList& files : contents) {
         if (m_aborted) {
-            return;
-        }
-
-        bool inSeparateFolder = false;
-        QString path;
-        // get directory
-        if (!files.isEmpty()) {
-            int index = -1;
-            // Get a normalized path so that we can compare it to QPath().path().
-            // Otherwise we may still have a Windows-style path, e.g. "G:\Test"
-            // instead of "G:/Test". "files" should already be normalized, though.
-            const QString filePath = QDir(files.at(0)).path();
-            for (int i = 0, n = m_directories.count(); i < n; ++i) {
-                if (filePath.startsWith(m_directories[i].path.path())) {
-                    if (index == -1) {
-                        index = i;
-                    } else if (m_directories[index].path.path().length() < m_directories[i].path.path().length()) {
-                        index = i;
-                    }
-                }
-            }
-            if (index != -1) {
-                inSeparateFolder = m_directories[index].separateFolders;
-                path = m_directories[index].path.path();
-            }
+            break;
         }
-        Concert concert(files, this);
-        concert.setInSeparateFolder(inSeparateFolder);
-        concert.controller()->loadData(Manager::instance()->mediaCenterInterface());
-        emit currentDir(concert.name());
-        database().add(&concert, path);
+        // Concerts move themselves to the GUI thread, see Concert's constructor.
+        auto* concert = new Concert(files);
+        concert->setInSeparateFolder(dir.separateFolders);
+        concert->controller()->loadData(Manager::instance()->mediaCenterInterface());
+        emit currentDir(concert->name());
+        collector.add(concert);
     }
-    database().commit();
+    collector.flush();
 }
 
 void ConcertFileSearcher::setupDatabaseConcerts(QVector<Concert*>& dbConcerts)
 {
+    BatchCollector<Concert*> collector(
+        [&](QVector<Concert*> concerts) { emit concertsBatchLoaded(concerts, QString(), false); });
+
     int concertCounter = 0;
     for (Concert* concert : dbConcerts) {
         if (m_aborted) {
@@ -260,28 +308,9 @@ void ConcertFileSearcher::setupDatabaseConcerts(QVector<Concert*>& dbConcerts)
         concert->controller()->loadData(Manager::instance()->mediaCenterInterface(), false, false);
         emit currentDir(concert->name());
         emit progress(++concertCounter, dbConcerts.size(), m_progressMessageId);
+        collector.add(concert);
     }
-}
-
-QVector<Concert*> ConcertFileSearcher::loadConcertsFromDatabase()
-{
-    QVector<Concert*> dbConcerts;
-    for (const SettingsDir& dir : m_directories) {
-        if (m_aborted) {
-            break;
-        }
-        dbConcerts.append(database().concertsInDirectory(dir.path));
-    }
-    setupDatabaseConcerts(dbConcerts);
-    return dbConcerts;
-}
-
-void ConcertFileSearcher::addConcertsToGui(const QVector<Concert*>& concerts)
-{
-    // add all entries from database including the previously stored ones
-    for (Concert* concert : concerts) {
-        Manager::instance()->concertModel()->addConcert(concert);
-    }
+    collector.flush();
 }
 
 /// Get a list of files in a directory
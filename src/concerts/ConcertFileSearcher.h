@@ -3,15 +3,23 @@
 #include "data/Database.h"
 
 #include <QDir>
+#include <QFuture>
 #include <QString>
 #include <QStringList>
 #include <QVector>
+#include <atomic>
 
+/// \brief Loads all concerts of the configured concert directories.
+///
+/// Directories are scanned and NFO files are loaded in a worker thread. Loaded concerts
+/// are handed to the GUI thread in batches which are stored in the database and added
+/// to the concert model.
 class ConcertFileSearcher : public QObject
 {
     Q_OBJECT
 public:
     explicit ConcertFileSearcher(QObject* parent = nullptr);
+    ~ConcertFileSearcher() override;
     void setConcertDirectories(QVector<SettingsDir> directories);
 
 public slots:
@@ -24,22 +32,33 @@ signals:
     void concertsLoaded();
     void currentDir(QString);
 
+    /// \brief Emitted by the worker thread for each batch of loaded concerts.
+    /// If storeInDatabase is true, the concerts were read from disk and are not yet
+    /// stored in the database. Internal signal, don't connect to it.
+    void concertsBatchLoaded(QVector<Concert*> concerts, QString directory, bool storeInDatabase);
+    /// \brief Emitted by the worker thread after the last batch. Internal signal.
+    void workerFinished();
+
+private slots:
+    void onConcertsBatchLoaded(QVector<Concert*> concerts, QString directory, bool storeInDatabase);
+    void onWorkerFinished();
+
 private:
     QVector<SettingsDir> m_directories;
     int m_progressMessageId;
-    bool m_aborted = false;
+    std::atomic<bool> m_aborted{false};
+    QFuture<void> m_worker;
 
 private:
     Database& database();
 
     void clearOldConcerts(bool forceClear);
 
-    QVector<QStringList> loadContentsFromDiskIfRequired(bool forceReload);
-    QVector<Concert*> loadConcertsFromDatabase();
+    /// \brief Entry point of the worker thread.
+    void loadConcerts(QVector<SettingsDir> directoriesToScan, QVector<Concert*> dbConcerts);
 
-    void storeContentsInDatabase(const QVector<QStringList>& contents);
+    void loadConcertsFromDisk(const SettingsDir& dir);
     void setupDatabaseConcerts(QVector<Concert*>& concerts);
-    void addConcertsToGui(const QVector<Concert*>& concerts);
 
     void scanDir(QString startPath,
         QString path,
@@ -6,6 +6,7 @@
 #include "globals/Globals.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "log/Tracer.h"
 
 ConcertModel::ConcertModel(QObject* parent) :
 #ifndef Q_OS_WIN
@@ -34,6 +35,20 @@ void ConcertModel::addConcert(Concert* concert)
     connect(concert, &Concert::sigChanged, this, &ConcertModel::onConcertChanged, Qt::UniqueConnection);
 }
 
+void ConcertModel::addConcerts(const QVector<Concert*>& concerts)
+{
+    ELCH_TRACE_SCOPE("model", "Add concerts to model");
+    if (concerts.isEmpty()) {
+        return;
+    }
+    beginInsertRows(QModelIndex(), rowCount(), rowCount() + concerts.size() - 1);
+    m_concerts.append(concerts);
+    endInsertRows();
+    for (Concert* concert : concerts) {
+        connect(concert, &Concert::sigChanged, this, &ConcertModel::onConcertChanged, Qt::UniqueConnection);
+    }
+}
+
 /**
  * \brief Called when a concerts data has changed
  * Emits dataChanged
@@ -173,6 +188,7 @@ QModelIndex ConcertModel::index(int row, int column, const QModelIndex& parent)
 /// \brief Clears the current contents
 void ConcertModel::clear()
 {
+    ELCH_TRACE_SCOPE("model", "Clear concert model");
     if (m_concerts.isEmpty()) {
         return;
     }
@@ -16,6 +16,8 @@ public:
     };
     explicit ConcertModel(QObject* parent = nullptr);
     void addConcert(Concert* concert);
+    /// \brief Adds all concerts with a single row insertion.
+    void addConcerts(const QVector<Concert*>& concerts);
     void clear();
     QVector<Concert*> concerts();
     Concert* concert(int row);
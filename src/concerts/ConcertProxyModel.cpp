@@ -2,6 +2,7 @@
 
 #include <QDebug>
 
+#include "data/Database.h"
 #include "globals/Filter.h"
 #include "globals/Globals.h"
 #include "globals/Manager.h"
@@ -26,8 +27,13 @@ bool ConcertProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourc
     }
 
     Concert* concert = concerts.at(sourceRow);
+    const bool useSearchResults = m_searchFilter != nullptr && isInSearchIndex(concert);
     for (Filter* filter : m_filters) {
-        if (!filter->accepts(concert)) {
+        if (useSearchResults && filter == m_searchFilter) {
+            if (!m_searchResults.contains(concert->databaseId())) {
+                return false;
+            }
+        } else if (!filter->accepts(concert)) {
             return false;
         }
     }
@@ -53,10 +59,84 @@ bool ConcertProxyModel::lessThan(const QModelIndex& left, const QModelIndex& rig
 }
 
 /**
- * \brief Sets active filters
+ * \brief Sets active filters. The title filter is answered by the database's full-text index:
+ * words are matched as prefixes and concerts are also found by their artist.
  */
 void ConcertProxyModel::setFilter(QVector<Filter*> filters, QString text)
 {
     m_filters = filters;
     m_filterText = text;
+
+    m_searchFilter = nullptr;
+    if (Manager::instance()->database()->hasSearchIndex()) {
+        for (Filter* filter : m_filters) {
+            if (filter->isInfo(ConcertFilters::Title)
+                && !mediaelch::LibrarySearchIndex::matchExpression(filter->shortText()).isEmpty()) {
+                m_searchFilter = filter;
+                break;
+            }
+        }
+    }
+    updateSearchResults();
+}
+
+void ConcertProxyModel::setSourceModel(QAbstractItemModel* model)
+{
+    QAbstractItemModel* oldModel = sourceModel();
+    if (oldModel != nullptr) {
+        disconnect(oldModel, &QAbstractItemModel::rowsInserted, this, &ConcertProxyModel::onSourceRowsInserted);
+        disconnect(oldModel, &QAbstractItemModel::dataChanged, this, &ConcertProxyModel::onSourceDataChanged);
+    }
+    if (model != nullptr) {
+        // Connected before QSortFilterProxyModel's own connections so that new and
+        // changed rows are filtered linearly.
+        connect(model, &QAbstractItemModel::rowsInserted, this, &ConcertProxyModel::onSourceRowsInserted);
+        connect(model, &QAbstractItemModel::dataChanged, this, &ConcertProxyModel::onSourceDataChanged);
+    }
+    QSortFilterProxyModel::setSourceModel(model);
+}
+
+void ConcertProxyModel::updateSearchResults()
+{
+    m_searchResults.clear();
+    m_changedConcerts.clear();
+    if (m_searchFilter == nullptr) {
+        return;
+    }
+    const QVector<int> ids = Manager::instance()->database()->searchConcerts(
+        m_searchFilter->shortText(), mediaelch::LibrarySearchIndex::Columns::Titles);
+    m_searchResults = QSet<int>::fromList(ids.toList());
+}
+
+void ConcertProxyModel::onSourceRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    markConcertsChanged(first, last);
+}
+
+void ConcertProxyModel::onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight)
+{
+    markConcertsChanged(topLeft.row(), bottomRight.row());
+}
+
+/**
+ * \brief Search results don't include later changes of the concerts: filter them linearly.
+ */
+void ConcertProxyModel::markConcertsChanged(int first, int last)
+{
+    if (m_searchFilter == nullptr) {
+        return;
+    }
+    const QVector<Concert*> concerts = Manager::instance()->concertModel()->concerts();
+    for (int row = qMax(0, first); row <= last && row < concerts.count(); ++row) {
+        m_changedConcerts.insert(concerts.at(row));
+    }
+}
+
+/**
+ * \brief Whether the index knows the current state of the concert.
+ */
+bool ConcertProxyModel::isInSearchIndex(Concert* concert) const
+{
+    return concert->databaseId() >= 0 && !concert->hasChanged() && !m_changedConcerts.contains(concert);
 }
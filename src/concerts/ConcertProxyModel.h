@@ -1,7 +1,9 @@
 #pragma once
 
+#include <QSet>
 #include <QSortFilterProxyModel>
 
+class Concert;
 class Filter;
 
 class ConcertProxyModel : public QSortFilterProxyModel
@@ -10,12 +12,25 @@ class ConcertProxyModel : public QSortFilterProxyModel
 public:
     explicit ConcertProxyModel(QObject* parent = nullptr);
     void setFilter(QVector<Filter*> filters, QString text);
+    void setSourceModel(QAbstractItemModel* model) override;
 
 protected:
     bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
     bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
 
 private:
+    void updateSearchResults();
+    void onSourceRowsInserted(const QModelIndex& parent, int first, int last);
+    void onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight);
+    void markConcertsChanged(int first, int last);
+    bool isInSearchIndex(Concert* concert) const;
+
     QVector<Filter*> m_filters;
     QString m_filterText;
+    /// Title filter that is answered by the database's full-text index, see setFilter().
+    Filter* m_searchFilter = nullptr;
+    /// Database ids of the concerts that match m_searchFilter.
+    QSet<int> m_searchResults;
+    /// Concerts that were added or changed since the index was queried. They are filtered linearly.
+    QSet<Concert*> m_changedConcerts;
 };
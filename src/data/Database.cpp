@@ -11,6 +11,7 @@
 #include "data/Subtitle.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "log/Tracer.h"
 #include "media_centers/KodiXml.h"
 #include "media_centers/kodi/v18/EpisodeXmlWriterV18.h"
 #include "movies/Movie.h"
@@ -30,10 +31,12 @@ Database::Database(QObject* parent) : QObject(parent)
     }
     m_db = new QSqlDatabase(QSqlDatabase::addDatabase("QSQLITE", "mediaDb"));
     m_db->setDatabaseName(dataLocation.filePath("MediaElch.sqlite"));
+    m_searchIndex = std::make_unique<LibrarySearchIndex>(*m_db);
     if (!m_db->open()) {
         qWarning() << "Could not open cache database";
     } else {
         QSqlQuery query(*m_db);
+        m_searchIndex->create();
 
         int myDbVersion = -1;
         query.prepare("SELECT * FROM sqlite_master WHERE name ='settings' and type='table';");
@@ -217,10 +220,18 @@ Database::Database(QObject* parent) : QObject(parent)
             query.exec();
 
             myDbVersion = 16;
-            Q_UNUSED(myDbVersion);
             updateDbVersion(16);
         }
 
+        if (myDbVersion < 17) {
+            // Items cached by older versions are not in the search index yet.
+            m_searchIndex->indexCachedItems();
+
+            myDbVersion = 17;
+            Q_UNUSED(myDbVersion);
+            updateDbVersion(17);
+        }
+
         query.prepare("PRAGMA synchronous=0;");
         query.exec();
 
@@ -283,11 +294,13 @@ void Database::transaction()
 
 void Database::commit()
 {
+    ELCH_TRACE_SCOPE("database", "Commit");
     db().commit();
 }
 
 void Database::clearAllMovies()
 {
+    m_searchIndex->clear(LibrarySearchIndex::MediaType::Movie);
     QSqlQuery query(db());
     query.prepare("DELETE FROM movies");
     query.exec();
@@ -305,6 +318,9 @@ void Database::clearAllMovies()
 
 void Database::clearMoviesInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Clear movies");
+    m_searchIndex->removeSelected(
+        LibrarySearchIndex::MediaType::Movie, "SELECT idMovie FROM movies WHERE path=:path", path.toString());
     QSqlQuery query(db());
     query.prepare("DELETE FROM movieFiles WHERE idMovie IN (SELECT idMovie FROM movies WHERE path=:path)");
     query.bindValue(":path", path.toString().toUtf8());
@@ -319,6 +335,7 @@ void Database::clearMoviesInDirectory(DirectoryPath path)
 
 void Database::add(Movie* movie, DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Add movie");
     QSqlQuery query(db());
     query.prepare("INSERT INTO movies(content, lastModified, inSeparateFolder, hasPoster, hasBackdrop, hasLogo, "
                   "hasClearArt, hasCdArt, hasBanner, hasThumb, hasExtraFanarts, discType, path) "
@@ -361,10 +378,28 @@ void Database::add(Movie* movie, DirectoryPath path)
     setLabel(movie->files(), movie->label());
 
     movie->setDatabaseId(insertId);
+    m_searchIndex->index(LibrarySearchIndex::MediaType::Movie, insertId, LibrarySearchIndex::document(*movie));
+}
+
+void Database::remove(Movie* movie)
+{
+    QSqlQuery query(db());
+    query.prepare("DELETE FROM movieFiles WHERE idMovie=:idMovie");
+    query.bindValue(":idMovie", movie->databaseId());
+    query.exec();
+    query.prepare("DELETE FROM movieSubtitles WHERE idMovie=:idMovie");
+    query.bindValue(":idMovie", movie->databaseId());
+    query.exec();
+    query.prepare("DELETE FROM movies WHERE idMovie=:idMovie");
+    query.bindValue(":idMovie", movie->databaseId());
+    query.exec();
+    m_searchIndex->remove(LibrarySearchIndex::MediaType::Movie, movie->databaseId());
+    movie->setDatabaseId(-1);
 }
 
 void Database::update(Movie* movie)
 {
+    ELCH_TRACE_SCOPE("database", "Update movie");
     QSqlQuery query(db());
     query.prepare("UPDATE movies SET content=:content WHERE idMovie=:idMovie");
     query.bindValue(":content", movie->nfoContent().isEmpty() ? "" : movie->nfoContent());
@@ -393,10 +428,14 @@ void Database::update(Movie* movie)
         query.bindValue(":forced", subtitle->forced() ? 1 : 0);
         query.exec();
     }
+
+    m_searchIndex->index(
+        LibrarySearchIndex::MediaType::Movie, movie->databaseId(), LibrarySearchIndex::document(*movie));
 }
 
 QVector<Movie*> Database::moviesInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Load movies");
     transaction();
     QSqlQuery query(db());
     query.prepare("SELECT M.idMovie, M.content, M.lastModified, M.inSeparateFolder, M.hasPoster, M.hasBackdrop, "
@@ -477,6 +516,7 @@ QVector<Movie*> Database::moviesInDirectory(DirectoryPath path)
 
 void Database::clearAllConcerts()
 {
+    m_searchIndex->clear(LibrarySearchIndex::MediaType::Concert);
     QSqlQuery query(db());
     query.prepare("DELETE FROM concerts");
     query.exec();
@@ -490,6 +530,9 @@ void Database::clearAllConcerts()
 
 void Database::clearConcertsInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Clear concerts");
+    m_searchIndex->removeSelected(
+        LibrarySearchIndex::MediaType::Concert, "SELECT idConcert FROM concerts WHERE path=:path", path.toString());
     QSqlQuery query(db());
     query.prepare("DELETE FROM concertFiles WHERE idConcert IN (SELECT idConcert FROM concerts WHERE path=:path)");
     query.bindValue(":path", path.toString().toUtf8());
@@ -501,6 +544,7 @@ void Database::clearConcertsInDirectory(DirectoryPath path)
 
 void Database::add(Concert* concert, DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Add concert");
     QSqlQuery query(db());
     query.prepare("INSERT INTO concerts(content, inSeparateFolder, path) "
                   "VALUES(:content, :inSeparateFolder, :path)");
@@ -517,6 +561,7 @@ void Database::add(Concert* concert, DirectoryPath path)
         query.exec();
     }
     concert->setDatabaseId(insertId);
+    m_searchIndex->index(LibrarySearchIndex::MediaType::Concert, insertId, LibrarySearchIndex::document(*concert));
 }
 
 void Database::update(Concert* concert)
@@ -536,10 +581,14 @@ void Database::update(Concert* concert)
         query.bindValue(":file", file.toString().toUtf8());
         query.exec();
     }
+
+    m_searchIndex->index(
+        LibrarySearchIndex::MediaType::Concert, concert->databaseId(), LibrarySearchIndex::document(*concert));
 }
 
 QVector<Concert*> Database::concertsInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Load concerts");
     QVector<Concert*> concerts;
     QSqlQuery query(db());
     QSqlQuery queryFiles(db());
@@ -566,6 +615,7 @@ QVector<Concert*> Database::concertsInDirectory(DirectoryPath path)
 
 void Database::add(TvShow* show, DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Add TV show");
     QSqlQuery query(db());
     query.prepare("INSERT INTO shows(dir, content, path) "
                   "VALUES(:dir, :content, :path)");
@@ -574,6 +624,8 @@ void Database::add(TvShow* show, DirectoryPath path)
     query.bindValue(":path", path.toString().toUtf8());
     query.exec();
     show->setDatabaseId(query.lastInsertId().toInt());
+    m_searchIndex->index(
+        LibrarySearchIndex::MediaType::TvShow, show->databaseId(), LibrarySearchIndex::document(*show));
 
     query.prepare("SELECT showMissingEpisodes, hideSpecialsInMissingEpisodes FROM showsSettings WHERE dir=:dir");
     query.bindValue(":dir", show->dir().toString().toUtf8());
@@ -647,6 +699,7 @@ void Database::setHideSpecialsInMissingEpisodes(TvShow* show, bool hideSpecials)
 
 void Database::add(TvShowEpisode* episode, DirectoryPath path, int idShow)
 {
+    ELCH_TRACE_SCOPE("database", "Add episode");
     QSqlQuery query(db());
     query.prepare("INSERT INTO episodes(content, idShow, path, seasonNumber, episodeNumber) "
                   "VALUES(:content, :idShow, :path, :seasonNumber, :episodeNumber)");
@@ -684,6 +737,9 @@ void Database::update(TvShow* show)
     query.bindValue(":tvdbid", show->tvdbId().toString());
     query.bindValue(":url", show->episodeGuideUrl().isEmpty() ? "" : show->episodeGuideUrl());
     query.exec();
+
+    m_searchIndex->index(
+        LibrarySearchIndex::MediaType::TvShow, show->databaseId(), LibrarySearchIndex::document(*show));
 }
 
 void Database::update(TvShowEpisode* episode)
@@ -722,6 +778,7 @@ int Database::showCount(DirectoryPath path)
 
 QVector<TvShow*> Database::showsInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Load TV shows");
     QVector<TvShow*> shows;
     QSqlQuery query(db());
     query.prepare("SELECT idShow, dir, content, path FROM shows WHERE path=:path");
@@ -752,6 +809,7 @@ QVector<TvShow*> Database::showsInDirectory(DirectoryPath path)
 
 QVector<TvShowEpisode*> Database::episodes(int idShow)
 {
+    ELCH_TRACE_SCOPE("database", "Load episodes");
     QVector<TvShowEpisode*> episodes;
     QSqlQuery query(db());
     QSqlQuery queryFiles(db());
@@ -779,6 +837,7 @@ QVector<TvShowEpisode*> Database::episodes(int idShow)
 
 void Database::clearAllTvShows()
 {
+    m_searchIndex->clear(LibrarySearchIndex::MediaType::TvShow);
     QSqlQuery query(db());
     query.prepare("DELETE FROM shows");
     query.exec();
@@ -796,6 +855,9 @@ void Database::clearAllTvShows()
 
 void Database::clearTvShowsInDirectory(DirectoryPath path)
 {
+    ELCH_TRACE_SCOPE("database", "Clear TV shows");
+    m_searchIndex->removeSelected(
+        LibrarySearchIndex::MediaType::TvShow, "SELECT idShow FROM shows WHERE path=:path", path.toString());
     QSqlQuery query(db());
     query.prepare("DELETE FROM shows WHERE path=:path");
     query.bindValue(":path", path.toString().toUtf8());
@@ -818,6 +880,7 @@ void Database::clearTvShowInDirectory(DirectoryPath path)
         return;
     }
     int idShow = query.value(0).toInt();
+    m_searchIndex->remove(LibrarySearchIndex::MediaType::TvShow, idShow);
 
     query.prepare("DELETE FROM episodeFiles WHERE idEpisode IN (SELECT idEpisode FROM episodes WHERE idShow=:idShow)");
     query.bindValue(":idShow", idShow);
@@ -1123,3 +1186,23 @@ QVector<Album*> Database::albums(Artist* artist)
     }
     return albums;
 }
+
+bool Database::hasSearchIndex() const
+{
+    return m_searchIndex->isAvailable();
+}
+
+QVector<int> Database::searchMovies(const QString& text, LibrarySearchIndex::Columns columns) const
+{
+    return m_searchIndex->search(LibrarySearchIndex::MediaType::Movie, text, columns);
+}
+
+QVector<int> Database::searchConcerts(const QString& text, LibrarySearchIndex::Columns columns) const
+{
+    return m_searchIndex->search(LibrarySearchIndex::MediaType::Concert, text, columns);
+}
+
+QVector<int> Database::searchTvShows(const QString& text, LibrarySearchIndex::Columns columns) const
+{
+    return m_searchIndex->search(LibrarySearchIndex::MediaType::TvShow, text, columns);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "data/LibrarySearchIndex.h"
 #include "file/Path.h"
 #include "globals/Globals.h"
 #include "tv_shows/TvDbId.h"
@@ -9,6 +10,7 @@
 #include <QString>
 #include <QStringList>
 #include <QVector>
+#include <memory>
 
 class Album;
 class Artist;
@@ -30,6 +32,7 @@ public:
     void clearMoviesInDirectory(mediaelch::DirectoryPath path);
     void add(Movie* movie, mediaelch::DirectoryPath path);
     void update(Movie* movie);
+    void remove(Movie* movie);
     QVector<Movie*> moviesInDirectory(mediaelch::DirectoryPath path);
 
     void clearAllConcerts();
@@ -76,7 +79,17 @@ public:
     void setLabel(const mediaelch::FileList& fileNames, ColorLabel color);
     ColorLabel getLabel(const mediaelch::FileList& fileNames);
 
+    /// \brief Returns false if SQLite does not support full-text search.
+    /// The search functions below always return an empty list in that case.
+    bool hasSearchIndex() const;
+    /// \brief Database ids of all movies matching the text.
+    /// \see LibrarySearchIndex::search()
+    QVector<int> searchMovies(const QString& text, mediaelch::LibrarySearchIndex::Columns columns) const;
+    QVector<int> searchConcerts(const QString& text, mediaelch::LibrarySearchIndex::Columns columns) const;
+    QVector<int> searchTvShows(const QString& text, mediaelch::LibrarySearchIndex::Columns columns) const;
+
 private:
     QSqlDatabase* m_db;
+    std::unique_ptr<mediaelch::LibrarySearchIndex> m_searchIndex;
     void updateDbVersion(int version);
 };
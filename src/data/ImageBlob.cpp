@@ -0,0 +1,187 @@
+#include "data/ImageBlob.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QTemporaryDir>
+#include <QTemporaryFile>
+#include <utility>
+
+namespace mediaelch {
+
+namespace {
+
+/// Shared by the store and all entries so that it outlives the last entry.
+struct ImageBlobStore
+{
+    ImageBlobStore() : directory(QDir::tempPath() + "/MediaElch-images-XXXXXX")
+    {
+        if (!directory.isValid()) {
+            qWarning() << "[ImageBlob] Could not create a temporary directory, images are kept in memory";
+        }
+    }
+
+    QString filePath(const QByteArray& hash) const
+    {
+        return directory.path() + "/" + QString::fromLatin1(hash.toHex());
+    }
+
+    QMutex mutex;
+    QTemporaryDir directory;
+    QHash<QByteArray, std::weak_ptr<const ImageBlobEntry>> entries;
+};
+
+std::shared_ptr<ImageBlobStore> imageBlobStore()
+{
+    static auto store = std::make_shared<ImageBlobStore>();
+    return store;
+}
+
+} // namespace
+
+struct ImageBlobEntry
+{
+    ImageBlobEntry(std::shared_ptr<ImageBlobStore> blobStore, QByteArray blobHash, int blobSize) :
+        store{std::move(blobStore)}, hash{std::move(blobHash)}, size{blobSize}
+    {
+    }
+
+    ~ImageBlobEntry()
+    {
+        QMutexLocker locker(&store->mutex);
+        // The same image may have been stored again after this entry's last
+        // handle was released. In that case, the file belongs to the new entry.
+        auto it = store->entries.find(hash);
+        if (it != store->entries.end() && it.value().expired()) {
+            store->entries.erase(it);
+            if (isOnDisk) {
+                QFile::remove(store->filePath(hash));
+            }
+        }
+    }
+
+    std::shared_ptr<ImageBlobStore> store;
+    QByteArray hash;
+    int size = 0;
+    bool isOnDisk = false;
+    /// Only used if the data couldn't be written to disk.
+    QByteArray data;
+};
+
+ImageBlob::ImageBlob(const QByteArray& data)
+{
+    if (data.isNull()) {
+        return;
+    }
+
+    std::shared_ptr<ImageBlobStore> store = imageBlobStore();
+    const QByteArray hash = hashOf(data);
+    {
+        QMutexLocker locker(&store->mutex);
+        m_entry = store->entries.value(hash).lock();
+        if (m_entry != nullptr) {
+            return;
+        }
+    }
+
+    // Written without holding the lock, because images are stored from the GUI thread. The files
+    // are only temporary and aren't synced to disk (as QSaveFile::commit() would). They get a
+    // unique name first because another thread may store the same image at the same time.
+    QString tempFilePath;
+    if (store->directory.isValid() && !data.isEmpty()) {
+        QTemporaryFile file(store->filePath(hash) + ".XXXXXX");
+        file.setAutoRemove(false);
+        if (file.open()) {
+            tempFilePath = file.fileName();
+            if (file.write(data) != data.size()) {
+                file.remove();
+                tempFilePath.clear();
+            }
+        }
+    }
+
+    QMutexLocker locker(&store->mutex);
+    m_entry = store->entries.value(hash).lock();
+    if (m_entry != nullptr) {
+        if (!tempFilePath.isEmpty()) {
+            QFile::remove(tempFilePath);
+        }
+        return;
+    }
+
+    auto entry = std::make_shared<ImageBlobEntry>(store, hash, data.size());
+    if (!tempFilePath.isEmpty()) {
+        const QString filePath = store->filePath(hash);
+        // A file of a previous entry may still exist if it could not be removed.
+        QFile::remove(filePath);
+        entry->isOnDisk = QFile::rename(tempFilePath, filePath);
+        if (!entry->isOnDisk) {
+            QFile::remove(tempFilePath);
+        }
+    }
+    if (!entry->isOnDisk) {
+        entry->data = data;
+    }
+    store->entries.insert(hash, entry);
+    m_entry = entry;
+}
+
+int ImageBlob::size() const
+{
+    return isNull() ? 0 : m_entry->size;
+}
+
+QByteArray ImageBlob::hash() const
+{
+    return isNull() ? QByteArray() : m_entry->hash;
+}
+
+QByteArray ImageBlob::data() const
+{
+    if (isNull()) {
+        return QByteArray();
+    }
+    if (!m_entry->isOnDisk) {
+        return m_entry->data;
+    }
+    QFile file(m_entry->store->filePath(m_entry->hash));
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "[ImageBlob] Could not read stored image:" << file.fileName();
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+bool ImageBlob::hasSameData(const QByteArray& data) const
+{
+    return !isNull() && !data.isNull() && m_entry->size == data.size() && m_entry->hash == hashOf(data);
+}
+
+bool ImageBlob::operator==(const ImageBlob& other) const
+{
+    return m_entry == other.m_entry || (!isNull() && !other.isNull() && hash() == other.hash());
+}
+
+QByteArray ImageBlob::hashOf(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+int ImageBlob::storedCount()
+{
+    std::shared_ptr<ImageBlobStore> store = imageBlobStore();
+    QMutexLocker locker(&store->mutex);
+    int count = 0;
+    for (const auto& entry : store->entries) {
+        if (!entry.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace mediaelch
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <QByteArray>
+#include <memory>
+
+namespace mediaelch {
+
+struct ImageBlobEntry;
+
+/// \brief Handle to image data that is kept in a temporary directory instead of memory.
+///
+/// Downloaded images (posters, fanart, actor images, ...) are only written to the
+/// media directory when an item is saved. Until then they used to be held in memory,
+/// which adds up to gigabytes after multi-scraping a few hundred items.
+///
+/// ImageBlob writes the data to a temporary file named after its SHA-1 hash and only
+/// keeps a reference-counted handle. Identical images share the same file. The file
+/// is removed once the last handle is destroyed. Use data() to read the image again,
+/// e.g. for rendering or saving. If the data can't be written to disk, it is kept
+/// in memory instead.
+///
+/// \par Example
+/// \code{cpp}
+///   ImageBlob poster(downloadedBytes);
+///   QImage image = QImage::fromData(poster.data());
+/// \endcode
+class ImageBlob
+{
+public:
+    /// \brief Creates a null blob.
+    ImageBlob() = default;
+    /// \brief Stores the given data. A null QByteArray results in a null blob.
+    explicit ImageBlob(const QByteArray& data);
+
+    bool isNull() const { return m_entry == nullptr; }
+    int size() const;
+    /// \brief SHA-1 hash of the data. Empty for null blobs.
+    QByteArray hash() const;
+    /// \brief Reads the data. Returns a null QByteArray for null blobs and if the data could not be read.
+    QByteArray data() const;
+    /// \brief Returns true if the blob stores the given data. Neither reads nor stores any data.
+    bool hasSameData(const QByteArray& data) const;
+
+    bool operator==(const ImageBlob& other) const;
+    bool operator!=(const ImageBlob& other) const { return !(*this == other); }
+
+    static QByteArray hashOf(const QByteArray& data);
+    /// \brief Number of distinct images that are currently stored.
+    static int storedCount();
+
+private:
+    std::shared_ptr<const ImageBlobEntry> m_entry;
+};
+
+} // namespace mediaelch
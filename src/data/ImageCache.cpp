@@ -8,6 +8,7 @@
 
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "log/Tracer.h"
 #include "settings/Settings.h"
 
 ImageCache::ImageCache(QObject* parent) : QObject(parent)
@@ -39,6 +40,7 @@ ImageCache* ImageCache::instance(QObject* parent)
 
 QImage ImageCache::image(mediaelch::FilePath path, int width, int height, int& origWidth, int& origHeight)
 {
+    ELCH_TRACE_SCOPE("image", "Image cache lookup");
     if (!m_cacheDir.isValid()) {
         return scaledImage(helper::getImage(path), width, height);
     }
@@ -110,6 +112,7 @@ void ImageCache::invalidateImages(mediaelch::FilePath path)
 
 QSize ImageCache::imageSize(mediaelch::FilePath path)
 {
+    ELCH_TRACE_SCOPE("image", "Image size lookup");
     if (!m_cacheDir.isValid()) {
         return helper::getImage(path).size();
     }
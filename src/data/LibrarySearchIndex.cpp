@@ -0,0 +1,242 @@
+#include "data/LibrarySearchIndex.h"
+
+#include "concerts/Concert.h"
+#include "movies/Movie.h"
+#include "tv_shows/TvShow.h"
+
+#include <QDebug>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <utility>
+
+namespace mediaelch {
+
+namespace {
+
+/// \brief SQL expression for the text of the first XML element with the given name in the column, or ''.
+QString xmlElementSql(const QString& column, const QString& element)
+{
+    const QString start = QStringLiteral("'<%1>'").arg(element);
+    const QString end = QStringLiteral("'</%1>'").arg(element);
+    return QStringLiteral("CASE WHEN instr(%1, %2) > 0 AND instr(%1, %3) > instr(%1, %2) "
+                          "THEN substr(%1, instr(%1, %2) + %4, instr(%1, %3) - instr(%1, %2) - %4) ELSE '' END")
+        .arg(column, start, end, QString::number(element.length() + 2));
+}
+
+} // namespace
+
+LibrarySearchIndex::LibrarySearchIndex(QSqlDatabase db) : m_db{std::move(db)}
+{
+}
+
+bool LibrarySearchIndex::create()
+{
+    QSqlQuery query(m_db);
+    for (MediaType type : {MediaType::Movie, MediaType::Concert, MediaType::TvShow}) {
+        // "unicode61" matches "Amelie" for "Amélie"; file paths are split at slashes and dots.
+        const bool created = query.exec(QStringLiteral("CREATE VIRTUAL TABLE IF NOT EXISTS %1 USING fts5("
+                                                       "title, originalTitle, paths, "
+                                                       "tokenize='unicode61 remove_diacritics 1');")
+                                            .arg(tableName(type)));
+        if (!created) {
+            qWarning() << "[LibrarySearchIndex] Full-text search is not available:" << query.lastError().text();
+            m_isAvailable = false;
+            return false;
+        }
+    }
+    m_isAvailable = true;
+    return true;
+}
+
+void LibrarySearchIndex::index(MediaType type, int id, const Document& document)
+{
+    if (!m_isAvailable || id < 0) {
+        return;
+    }
+    remove(type, id);
+
+    QSqlQuery query(m_db);
+    query.prepare(QStringLiteral("INSERT INTO %1(rowid, title, originalTitle, paths) "
+                                 "VALUES(:id, :title, :originalTitle, :paths)")
+                      .arg(tableName(type)));
+    query.bindValue(":id", id);
+    query.bindValue(":title", document.title);
+    query.bindValue(":originalTitle", document.originalTitle);
+    query.bindValue(":paths", document.paths.join('\n'));
+    if (!query.exec()) {
+        qWarning() << "[LibrarySearchIndex] Could not index item" << id << query.lastError().text();
+    }
+}
+
+void LibrarySearchIndex::remove(MediaType type, int id)
+{
+    if (!m_isAvailable) {
+        return;
+    }
+    QSqlQuery query(m_db);
+    query.prepare(QStringLiteral("DELETE FROM %1 WHERE rowid=:id").arg(tableName(type)));
+    query.bindValue(":id", id);
+    query.exec();
+}
+
+void LibrarySearchIndex::removeSelected(MediaType type, const QString& idSelect, const QString& path)
+{
+    if (!m_isAvailable) {
+        return;
+    }
+    QSqlQuery query(m_db);
+    query.prepare(QStringLiteral("DELETE FROM %1 WHERE rowid IN (%2)").arg(tableName(type), idSelect));
+    if (idSelect.contains(":path")) {
+        query.bindValue(":path", path.toUtf8());
+    }
+    query.exec();
+}
+
+void LibrarySearchIndex::clear(MediaType type)
+{
+    if (!m_isAvailable) {
+        return;
+    }
+    QSqlQuery query(m_db);
+    query.exec(QStringLiteral("DELETE FROM %1").arg(tableName(type)));
+}
+
+void LibrarySearchIndex::indexCachedItems()
+{
+    if (!m_isAvailable) {
+        return;
+    }
+
+    struct CacheTable
+    {
+        MediaType type;
+        QString table;
+        QString id;
+        /// NFO element that is indexed as the original title
+        QString originalTitle;
+        /// SQL expression for the item's paths
+        QString paths;
+    };
+    const QVector<CacheTable> tables{
+        {MediaType::Movie,
+            "movies",
+            "idMovie",
+            "originaltitle",
+            "(SELECT group_concat(CAST(F.file AS TEXT), char(10)) FROM movieFiles F WHERE F.idMovie=C.idMovie)"},
+        {MediaType::Concert,
+            "concerts",
+            "idConcert",
+            "artist",
+            "(SELECT group_concat(CAST(F.file AS TEXT), char(10)) FROM concertFiles F WHERE F.idConcert=C.idConcert)"},
+        {MediaType::TvShow, "shows", "idShow", "showtitle", "CAST(C.dir AS TEXT)"},
+    };
+
+    // The cache stores the NFO content of each item, so the titles are read from it. Items without
+    // an NFO file are found by their paths until they are indexed again on the next scan or save.
+    const QString content = QStringLiteral("CAST(C.content AS TEXT)");
+    const QString title = xmlElementSql(content, "title");
+    QSqlQuery query(m_db);
+    for (const CacheTable& cache : tables) {
+        clear(cache.type);
+        const bool indexed =
+            query.exec(QStringLiteral("INSERT INTO %1(rowid, title, originalTitle, paths) "
+                                      "SELECT C.%2, CASE WHEN %3 <> '' THEN %3 ELSE %4 END, %5, %4 FROM %6 C")
+                           .arg(tableName(cache.type),
+                               cache.id,
+                               title,
+                               cache.paths,
+                               xmlElementSql(content, cache.originalTitle),
+                               cache.table));
+        if (!indexed) {
+            qWarning() << "[LibrarySearchIndex] Could not index cached items:" << query.lastError().text();
+        }
+    }
+}
+
+QVector<int> LibrarySearchIndex::search(MediaType type, const QString& text, Columns columns) const
+{
+    QVector<int> ids;
+    QString expression = matchExpression(text);
+    if (!m_isAvailable || expression.isEmpty()) {
+        return ids;
+    }
+    switch (columns) {
+    case Columns::Titles: expression = QStringLiteral("{title originalTitle} : (%1)").arg(expression); break;
+    case Columns::Paths: expression = QStringLiteral("paths : (%1)").arg(expression); break;
+    }
+
+    QSqlQuery query(m_db);
+    query.setForwardOnly(true);
+    query.prepare(QStringLiteral("SELECT rowid FROM %1 WHERE %1 MATCH :expression").arg(tableName(type)));
+    query.bindValue(":expression", expression);
+    if (!query.exec()) {
+        qWarning() << "[LibrarySearchIndex] Search failed:" << query.lastError().text();
+        return ids;
+    }
+    while (query.next()) {
+        ids << query.value(0).toInt();
+    }
+    return ids;
+}
+
+QString LibrarySearchIndex::matchExpression(const QString& text)
+{
+    // Split the same way as the "unicode61" tokenizer so that all words are plain
+    // FTS5 strings and no user input is interpreted as query syntax.
+    QStringList terms;
+    QString word;
+    const auto addWord = [&]() {
+        if (!word.isEmpty()) {
+            terms << QStringLiteral("\"%1\"*").arg(word);
+            word.clear();
+        }
+    };
+    for (const QChar c : text) {
+        if (c.isLetterOrNumber()) {
+            word += c;
+        } else {
+            addWord();
+        }
+    }
+    addWord();
+    return terms.join(' ');
+}
+
+LibrarySearchIndex::Document LibrarySearchIndex::document(const Movie& movie)
+{
+    Document document;
+    document.title = movie.name();
+    document.originalTitle = movie.originalName();
+    document.paths = movie.files().toStringList();
+    return document;
+}
+
+LibrarySearchIndex::Document LibrarySearchIndex::document(const Concert& concert)
+{
+    Document document;
+    document.title = concert.name();
+    document.originalTitle = concert.artist();
+    document.paths = concert.files().toStringList();
+    return document;
+}
+
+LibrarySearchIndex::Document LibrarySearchIndex::document(const TvShow& show)
+{
+    Document document;
+    document.title = show.title();
+    document.originalTitle = show.showTitle();
+    document.paths = QStringList{show.dir().toString()};
+    return document;
+}
+
+QString LibrarySearchIndex::tableName(MediaType type)
+{
+    switch (type) {
+    case MediaType::Movie: return QStringLiteral("movieSearch");
+    case MediaType::Concert: return QStringLiteral("concertSearch");
+    case MediaType::TvShow: return QStringLiteral("showSearch");
+    }
+    return QStringLiteral("movieSearch");
+}
+
+} // namespace mediaelch
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class Concert;
+class Movie;
+class TvShow;
+
+namespace mediaelch {
+
+/// \brief Full-text index of the library stored in SQLite FTS5 tables.
+///
+/// There is one FTS5 table per media type whose rowid is the database id of
+/// the movie, concert or TV show, e.g. `movies.idMovie`. Searching the index
+/// returns only the matching ids, so that filtering does not have to look at
+/// each loaded object.
+///
+/// The index is kept in sync by Database. If SQLite was built without FTS5,
+/// isAvailable() returns false and nothing is indexed.
+///
+/// \par Example
+/// \code{cpp}
+///   LibrarySearchIndex index(db);
+///   index.create();
+///   using Columns = LibrarySearchIndex::Columns;
+///   QVector<int> ids = index.search(LibrarySearchIndex::MediaType::Movie, "star wa", Columns::Titles);
+/// \endcode
+class LibrarySearchIndex
+{
+public:
+    enum class MediaType
+    {
+        Movie,
+        Concert,
+        TvShow
+    };
+
+    /// \brief Columns that are searched.
+    enum class Columns
+    {
+        /// The title and the original title
+        Titles,
+        /// Paths of the item's files
+        Paths
+    };
+
+    /// \brief Searchable content of a single item.
+    struct Document
+    {
+        QString title;
+        QString originalTitle;
+        QStringList paths;
+    };
+
+    explicit LibrarySearchIndex(QSqlDatabase db);
+
+    /// \brief Creates the FTS5 tables if they don't exist.
+    /// \return False if FTS5 is not supported by the SQLite library.
+    bool create();
+    bool isAvailable() const { return m_isAvailable; }
+
+    /// \brief Adds the document or replaces the existing one with the same id.
+    void index(MediaType type, int id, const Document& document);
+    void remove(MediaType type, int id);
+    /// \brief Removes all documents whose id is returned by the given SELECT statement.
+    /// The statement may use the placeholder ":path".
+    void removeSelected(MediaType type, const QString& idSelect, const QString& path);
+    void clear(MediaType type);
+    /// \brief Indexes all movies, concerts and TV shows of the database's cache tables.
+    /// Used when upgrading a cache that was created without the index.
+    void indexCachedItems();
+
+    /// \brief Returns the ids of all items that contain words starting with the words in
+    /// the given text, in no particular order.
+    QVector<int> search(MediaType type, const QString& text, Columns columns) const;
+
+    /// \brief Creates an FTS5 MATCH expression that requires all words of the text as prefixes.
+    /// Returns an empty string if the text does not contain any words.
+    static QString matchExpression(const QString& text);
+
+    static Document document(const Movie& movie);
+    static Document document(const Concert& concert);
+    static Document document(const TvShow& show);
+
+private:
+    static QString tableName(MediaType type);
+
+    QSqlDatabase m_db;
+    bool m_isAvailable = false;
+};
+
+} // namespace mediaelch
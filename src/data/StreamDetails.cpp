@@ -7,6 +7,7 @@
 #include <QProcess>
 
 #include "data/MediaInfoFile.h"
+#include "log/Tracer.h"
 
 StreamDetails::StreamDetails(QObject* parent, mediaelch::FileList files) :
     QObject(parent),
@@ -123,6 +124,7 @@ void StreamDetails::loadWithLibrary()
         }
     }
 
+    ELCH_TRACE_SCOPE("mediainfo", "Probe media file", filePath.toString());
     MediaInfoFile mi(filePath.toString());
 
     std::chrono::seconds duration{0};
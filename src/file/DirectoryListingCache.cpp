@@ -0,0 +1,81 @@
+#include "file/DirectoryListingCache.h"
+
+#include <QDir>
+#include <QFileInfo>
+
+namespace {
+
+thread_local mediaelch::DirectoryListingCache* s_currentCache = nullptr;
+
+/// Key for lookups: Windows and macOS file systems are usually case-insensitive.
+QString lookupKey(const QString& name)
+{
+#if defined(Q_OS_WIN) || defined(Q_OS_MAC)
+    return name.toCaseFolded();
+#else
+    return name;
+#endif
+}
+
+} // namespace
+
+namespace mediaelch {
+
+DirectoryListingCache::Scope::Scope(DirectoryListingCache& cache) : m_previous{s_currentCache}
+{
+    s_currentCache = &cache;
+}
+
+DirectoryListingCache::Scope::~Scope()
+{
+    s_currentCache = m_previous;
+}
+
+bool DirectoryListingCache::Listing::contains(const QString& fileName) const
+{
+    return lookup.contains(lookupKey(fileName));
+}
+
+const DirectoryListingCache::Listing& DirectoryListingCache::listing(const QString& directory)
+{
+    const QString key = lookupKey(QDir::cleanPath(directory));
+    auto it = m_listings.find(key);
+    if (it != m_listings.end()) {
+        return it.value();
+    }
+
+    Listing listing;
+    listing.files =
+        QDir(directory).entryList(QDir::Files | QDir::Hidden | QDir::System, QDir::Name | QDir::IgnoreCase);
+    listing.lookup.reserve(listing.files.size());
+    for (const QString& file : listing.files) {
+        listing.lookup.insert(lookupKey(file));
+    }
+    return m_listings.insert(key, listing).value();
+}
+
+bool DirectoryListingCache::containsFile(const QString& filePath)
+{
+    const QString path = QDir::cleanPath(filePath);
+    const int slash = path.lastIndexOf('/');
+    if (slash == -1) {
+        return QFileInfo(filePath).isFile();
+    }
+    const QString directory = (slash == 0) ? QStringLiteral("/") : path.left(slash);
+    return listing(directory).contains(path.mid(slash + 1));
+}
+
+DirectoryListingCache* DirectoryListingCache::current()
+{
+    return s_currentCache;
+}
+
+bool DirectoryListingCache::isFile(const QString& filePath)
+{
+    if (s_currentCache != nullptr) {
+        return s_currentCache->containsFile(filePath);
+    }
+    return QFileInfo(filePath).isFile();
+}
+
+} // namespace mediaelch
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+namespace mediaelch {
+
+/// \brief Caches directory listings so that each directory is read at most once.
+///
+/// File searchers look up NFO files, artwork and subtitles for every media file.
+/// In flat directories with thousands of files, listing the directory (or calling
+/// stat) for every single media file is expensive, e.g. on network shares.
+///
+/// The cache is not thread-safe. It is meant to be owned by a single scan and to be
+/// activated for the scanning thread using DirectoryListingCache::Scope. Code that
+/// checks for files can then use DirectoryListingCache::isFile() which falls back to
+/// the file system if no cache is active for the current thread.
+///
+/// \par Example
+/// \code{cpp}
+///   DirectoryListingCache cache;
+///   DirectoryListingCache::Scope scope(cache);
+///   bool exists = DirectoryListingCache::isFile("/path/to/movie.nfo");
+/// \endcode
+class DirectoryListingCache
+{
+public:
+    struct Listing
+    {
+        /// All files in the directory (including hidden ones), sorted by name ignoring case.
+        QStringList files;
+        /// File names used for lookups. Case-folded on case-insensitive file systems.
+        QSet<QString> lookup;
+
+        /// \brief Returns true if the directory contains a file with the given name.
+        bool contains(const QString& fileName) const;
+    };
+
+    /// \brief Activates a cache for the current thread until the scope is left.
+    class Scope
+    {
+    public:
+        explicit Scope(DirectoryListingCache& cache);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        DirectoryListingCache* m_previous;
+    };
+
+    /// \brief Returns the listing of the given directory. The directory is read on first access.
+    const Listing& listing(const QString& directory);
+    /// \brief Returns true if the file exists (according to the cached listing of its directory).
+    bool containsFile(const QString& filePath);
+
+    /// \brief Returns the cache that is active for the current thread or nullptr.
+    static DirectoryListingCache* current();
+    /// \brief Checks whether filePath is a file using the active cache or the file system.
+    static bool isFile(const QString& filePath);
+
+private:
+    QHash<QString, Listing> m_listings;
+};
+
+} // namespace mediaelch
@@ -0,0 +1,197 @@
+#include "file/FileCopier.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStorageInfo>
+
+#ifdef Q_OS_LINUX
+#include <cerrno>
+#include <cstring>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace mediaelch {
+
+namespace {
+
+/// Buffer size if the kernel can't copy the file. Large buffers reduce the
+/// number of system calls and let network file systems send large requests.
+constexpr int bufferSize = 4 * 1024 * 1024;
+
+#ifdef Q_OS_LINUX
+
+/// Bytes copied by the kernel per call. Only limits the progress' granularity.
+constexpr qint64 kernelChunkSize = 64 * 1024 * 1024;
+
+enum class KernelCopy
+{
+    Done,
+    Failed,
+    /// Nothing was copied; the file has to be copied in userspace.
+    Unsupported
+};
+
+KernelCopy kernelCopy(int sourceFd, int targetFd, qint64 size, const FileCopier::ProgressCallback& progress)
+{
+#ifdef FICLONE
+    if (::ioctl(targetFd, FICLONE, sourceFd) == 0) {
+        if (progress) {
+            progress(size);
+        }
+        return KernelCopy::Done;
+    }
+#endif
+
+#ifdef SYS_copy_file_range
+    qint64 copied = 0;
+    while (copied < size) {
+        const auto chunk = static_cast<size_t>(qMin(kernelChunkSize, size - copied));
+        // Called via syscall() because glibc only has a wrapper since version 2.27.
+        const auto count = ::syscall(SYS_copy_file_range, sourceFd, nullptr, targetFd, nullptr, chunk, 0U);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (copied == 0
+                && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP || errno == EBADF)) {
+                return KernelCopy::Unsupported;
+            }
+            qWarning() << "[FileCopier] copy_file_range failed:" << std::strerror(errno);
+            return KernelCopy::Failed;
+        }
+        if (count == 0) {
+            if (copied == 0) {
+                // Some file systems, e.g. procfs or FUSE, report success without copying anything.
+                return KernelCopy::Unsupported;
+            }
+            // The source file is shorter than expected.
+            break;
+        }
+        copied += count;
+        if (progress) {
+            progress(count);
+        }
+    }
+    return copied == size ? KernelCopy::Done : KernelCopy::Failed;
+#else
+    Q_UNUSED(sourceFd);
+    Q_UNUSED(targetFd);
+    Q_UNUSED(size);
+    Q_UNUSED(progress);
+    return KernelCopy::Unsupported;
+#endif
+}
+
+#endif
+
+bool bufferedCopy(QFile& source, QFile& target, qint64 size, const FileCopier::ProgressCallback& progress)
+{
+    QByteArray buffer(bufferSize, Qt::Uninitialized);
+    qint64 copied = 0;
+    while (true) {
+        const qint64 count = source.read(buffer.data(), buffer.size());
+        if (count < 0) {
+            qWarning() << "[FileCopier] Could not read file:" << source.fileName() << source.errorString();
+            return false;
+        }
+        if (count == 0) {
+            break;
+        }
+        if (target.write(buffer.constData(), count) != count) {
+            qWarning() << "[FileCopier] Could not write file:" << target.fileName() << target.errorString();
+            return false;
+        }
+        copied += count;
+        if (progress) {
+            progress(count);
+        }
+    }
+    return copied == size;
+}
+
+bool copyContent(QFile& source, QFile& target, const FileCopier::Options& options)
+{
+    const qint64 size = source.size();
+#ifdef Q_OS_LINUX
+    switch (kernelCopy(source.handle(), target.handle(), size, options.progress)) {
+    case KernelCopy::Done: return true;
+    case KernelCopy::Failed: return false;
+    case KernelCopy::Unsupported: break;
+    }
+#endif
+    return bufferedCopy(source, target, size, options.progress);
+}
+
+} // namespace
+
+bool FileCopier::copy(const QString& source, const QString& target, const Options& options)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    // Fails if the target exists, without a race between checking and creating it.
+    const QIODevice::OpenMode targetMode = QIODevice::WriteOnly | QIODevice::NewOnly;
+#else
+    const QIODevice::OpenMode targetMode = QIODevice::WriteOnly;
+    if (QFileInfo::exists(target)) {
+        qWarning() << "[FileCopier] Target file already exists:" << target;
+        return false;
+    }
+#endif
+
+    QFile sourceFile(source);
+    if (!sourceFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "[FileCopier] Could not open file:" << source << sourceFile.errorString();
+        return false;
+    }
+    QFile targetFile(target);
+    if (!targetFile.open(targetMode)) {
+        qWarning() << "[FileCopier] Could not create file:" << target << targetFile.errorString();
+        return false;
+    }
+
+    bool copied = copyContent(sourceFile, targetFile, options) && targetFile.flush();
+    targetFile.close();
+    sourceFile.close();
+
+    if (copied && options.verify && checksum(source) != checksum(target)) {
+        qWarning() << "[FileCopier] Checksums differ after copying" << source << "to" << target;
+        copied = false;
+    }
+    if (!copied) {
+        targetFile.remove();
+        return false;
+    }
+
+    QFile::setPermissions(target, QFile::permissions(source));
+    return true;
+}
+
+QByteArray FileCopier::checksum(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    if (!hash.addData(&file)) {
+        return {};
+    }
+    return hash.result();
+}
+
+QString FileCopier::device(const QString& path)
+{
+    QFileInfo info(path);
+    QDir dir = info.isDir() ? QDir(info.absoluteFilePath()) : info.absoluteDir();
+    while (!dir.exists() && dir.cdUp()) {
+    }
+    const QStorageInfo storage(dir);
+    return storage.device() + "\n" + storage.rootPath();
+}
+
+} // namespace mediaelch
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <functional>
+
+namespace mediaelch {
+
+/// \brief Copies large files, e.g. when importing downloaded movies.
+///
+/// On Linux, the target file first tries to share the source's data blocks
+/// (reflink, supported by e.g. Btrfs and XFS). Otherwise the kernel copies the
+/// data without passing it through MediaElch (copy_file_range), which also lets
+/// network file systems copy on the server. If neither is available, the file
+/// is copied with a large buffer.
+///
+/// Existing target files are never overwritten. Incomplete target files are
+/// removed if copying fails.
+class FileCopier
+{
+public:
+    /// \brief Called with the number of bytes that were copied since the last call.
+    /// Called from the copying thread.
+    using ProgressCallback = std::function<void(qint64)>;
+
+    struct Options
+    {
+        /// Compare checksums of the source and the target file after copying.
+        bool verify = false;
+        ProgressCallback progress;
+    };
+
+    /// \brief Copies the source file to target. Returns true on success.
+    static bool copy(const QString& source, const QString& target, const Options& options = Options{});
+
+    /// \brief Returns the checksum of the file's content or an empty array if it can't be read.
+    static QByteArray checksum(const QString& path);
+
+    /// \brief Returns an identifier of the device the path is stored on.
+    /// Paths that do not exist yet are looked up by their nearest existing parent directory.
+    static QString device(const QString& path);
+};
+
+} // namespace mediaelch
@@ -0,0 +1,151 @@
+#include "file/FileNameMatcher.h"
+
+#include <QDebug>
+
+namespace mediaelch {
+
+namespace {
+
+QRegularExpression keywordPattern(const QString& keyword)
+{
+    return QRegularExpression(QRegularExpression::escape(keyword), QRegularExpression::CaseInsensitiveOption);
+}
+
+/// Numbered backreferences refer to other groups once patterns are merged.
+bool canBeMerged(const QRegularExpression& pattern)
+{
+    static const QRegularExpression backreference(R"(\\(?:[1-9]|g|k))");
+    const QRegularExpression::PatternOptions options = pattern.patternOptions();
+    return (options == QRegularExpression::NoPatternOption
+               || options == QRegularExpression::CaseInsensitiveOption)
+           && !backreference.match(pattern.pattern()).hasMatch();
+}
+
+} // namespace
+
+void FileNameMatcher::RuleSet::add(Rule rule, QRegularExpression pattern)
+{
+    int index = 0;
+    for (const Alternative& alternative : alternatives) {
+        if (alternative.rule == rule) {
+            ++index;
+        }
+    }
+    alternatives.append(Alternative{rule, index, std::move(pattern), -1});
+}
+
+void FileNameMatcher::RuleSet::compile()
+{
+    merged = QRegularExpression();
+    isMerged = false;
+    if (alternatives.isEmpty()) {
+        return;
+    }
+
+    QStringList parts;
+    int group = 1;
+    for (Alternative& alternative : alternatives) {
+        if (!canBeMerged(alternative.pattern)) {
+            return;
+        }
+        // An inline option only applies to the rest of the enclosing group.
+        const bool isCaseInsensitive =
+            alternative.pattern.patternOptions().testFlag(QRegularExpression::CaseInsensitiveOption);
+        parts << QStringLiteral("(%1%2)").arg(isCaseInsensitive ? "(?i)" : "", alternative.pattern.pattern());
+        alternative.group = group;
+        group += 1 + alternative.pattern.captureCount();
+    }
+
+    QRegularExpression candidate(parts.join('|'));
+    if (!candidate.isValid()) {
+        qWarning() << "[FileNameMatcher] Patterns can't be merged:" << candidate.errorString();
+        return;
+    }
+    candidate.optimize();
+    merged = candidate;
+    isMerged = true;
+}
+
+FileNameMatcher::Match FileNameMatcher::RuleSet::match(const QString& name) const
+{
+    if (isMerged) {
+        const QRegularExpressionMatch result = merged.match(name);
+        if (!result.hasMatch()) {
+            return {};
+        }
+        for (const Alternative& alternative : alternatives) {
+            if (result.capturedStart(alternative.group) >= 0) {
+                return Match{alternative.rule, alternative.index};
+            }
+        }
+        return {};
+    }
+
+    for (const Alternative& alternative : alternatives) {
+        if (alternative.pattern.isValid() && alternative.pattern.match(name).hasMatch()) {
+            return Match{alternative.rule, alternative.index};
+        }
+    }
+    return {};
+}
+
+void FileNameMatcher::addFilePattern(const QRegularExpression& pattern)
+{
+    m_fileRules.add(Rule::ExcludedFile, pattern);
+}
+
+void FileNameMatcher::addFolderPattern(const QRegularExpression& pattern)
+{
+    m_folderRules.add(Rule::ExcludedFolder, pattern);
+}
+
+void FileNameMatcher::addFileKeywords(Rule rule, const QStringList& keywords)
+{
+    for (const QString& keyword : keywords) {
+        m_fileRules.add(rule, keywordPattern(keyword));
+    }
+}
+
+void FileNameMatcher::addFolderKeywords(Rule rule, const QStringList& keywords)
+{
+    for (const QString& keyword : keywords) {
+        m_folderRules.add(rule, keywordPattern(keyword));
+    }
+}
+
+void FileNameMatcher::addFolderNames(Rule rule, const QStringList& names)
+{
+    int index = 0;
+    for (const Match& match : m_folderNames) {
+        if (match.rule == rule) {
+            ++index;
+        }
+    }
+    for (const QString& name : names) {
+        m_folderNames.insert(name.toCaseFolded(), Match{rule, index++});
+    }
+}
+
+void FileNameMatcher::compile()
+{
+    m_fileRules.compile();
+    m_folderRules.compile();
+}
+
+FileNameMatcher::Match FileNameMatcher::matchFile(const QString& fileName) const
+{
+    return m_fileRules.match(fileName);
+}
+
+FileNameMatcher::Match FileNameMatcher::matchFolder(const QString& folderName) const
+{
+    if (!m_folderNames.isEmpty()) {
+        const auto it = m_folderNames.constFind(folderName.toCaseFolded());
+        if (it != m_folderNames.constEnd()) {
+            return it.value();
+        }
+    }
+    return m_folderRules.match(folderName);
+}
+
+} // namespace mediaelch
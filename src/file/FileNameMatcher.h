@@ -0,0 +1,100 @@
+#pragma once
+
+#include <QHash>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Matches file and folder names against many rules at once.
+///
+/// File searchers check each name against the user's exclude patterns and
+/// against built-in rules, e.g. for trailers or ".actors" folders. Instead of
+/// running one regular expression per rule, all file rules are merged into a
+/// single alternation that is JIT-compiled by PCRE2, so each name is scanned
+/// once, independent of the number of rules. Folder names are additionally
+/// looked up in a hash set of exact names.
+///
+/// Rules are added first; compile() must be called before matching. Matching
+/// is thread-safe. Patterns that can't be merged (e.g. because they use
+/// backreferences) are matched one after another.
+///
+/// \par Example
+/// \code{cpp}
+///   FileNameMatcher matcher;
+///   matcher.addFilePattern(QRegularExpression("^\\."));
+///   matcher.addFileKeywords(FileNameMatcher::Rule::MovieExtra, {"-trailer"});
+///   matcher.compile();
+///   matcher.matchFile("Movie-Trailer.mkv").rule; // Rule::MovieExtra
+/// \endcode
+class FileNameMatcher
+{
+public:
+    enum class Rule
+    {
+        None,
+        /// A user-defined exclude pattern for file names
+        ExcludedFile,
+        /// A user-defined exclude pattern for folder names
+        ExcludedFolder,
+        /// Extras of a movie, e.g. trailers
+        MovieExtra,
+        /// Folders that never contain media files themselves, e.g. ".actors"
+        SkippedFolder
+    };
+
+    struct Match
+    {
+        Rule rule = Rule::None;
+        /// Index of the rule's pattern, keyword or name in the order it was added for that rule.
+        int index = -1;
+
+        bool hasMatch() const { return rule != Rule::None; }
+    };
+
+    /// \brief Adds a user-defined exclude pattern for file names (Rule::ExcludedFile).
+    void addFilePattern(const QRegularExpression& pattern);
+    /// \brief Adds a user-defined exclude pattern for folder names (Rule::ExcludedFolder).
+    void addFolderPattern(const QRegularExpression& pattern);
+    /// \brief Adds case-insensitive keywords that match anywhere in a file name.
+    void addFileKeywords(Rule rule, const QStringList& keywords);
+    /// \brief Adds case-insensitive keywords that match anywhere in a folder name.
+    void addFolderKeywords(Rule rule, const QStringList& keywords);
+    /// \brief Adds case-insensitive folder names that must match exactly.
+    void addFolderNames(Rule rule, const QStringList& names);
+
+    /// \brief Builds the merged expressions. Must be called again after adding rules.
+    void compile();
+
+    Match matchFile(const QString& fileName) const;
+    Match matchFolder(const QString& folderName) const;
+
+private:
+    struct Alternative
+    {
+        Rule rule;
+        int index;
+        QRegularExpression pattern;
+        /// Capture group of this alternative in the merged expression.
+        int group;
+    };
+
+    struct RuleSet
+    {
+        QVector<Alternative> alternatives;
+        QRegularExpression merged;
+        bool isMerged = false;
+
+        void add(Rule rule, QRegularExpression pattern);
+        void compile();
+        Match match(const QString& name) const;
+    };
+
+    RuleSet m_fileRules;
+    RuleSet m_folderRules;
+    QHash<QString, Match> m_folderNames;
+};
+
+} // namespace mediaelch
@@ -0,0 +1,228 @@
+#include "file/FileWriteBatch.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QStorageInfo>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentRun>
+#include <utility>
+
+namespace mediaelch {
+
+namespace {
+
+/// State of a file after MediaElch wrote it. Used to compare new content
+/// with a file's content without reading the file again.
+struct WrittenFile
+{
+    qint64 size = -1;
+    QDateTime lastModified;
+    QByteArray hash;
+};
+
+/// Files may be written by several batches (and threads), e.g. by a "save all".
+QMutex s_writtenFilesMutex;
+QHash<QString, WrittenFile> s_writtenFiles;
+/// The hashes are only an optimization. Forget them instead of growing without limit.
+constexpr int maxWrittenFiles = 20000;
+
+QByteArray contentHash(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+void rememberWrittenFile(const QString& path, const QByteArray& hash)
+{
+    const QFileInfo info(path);
+    QMutexLocker locker(&s_writtenFilesMutex);
+    if (s_writtenFiles.size() >= maxWrittenFiles) {
+        s_writtenFiles.clear();
+    }
+    s_writtenFiles.insert(path, {info.size(), info.lastModified(), hash});
+}
+
+void forgetWrittenFile(const QString& path)
+{
+    QMutexLocker locker(&s_writtenFilesMutex);
+    s_writtenFiles.remove(path);
+}
+
+bool hasContent(const QString& path, const QByteArray& data, const QByteArray& hash)
+{
+    const QFileInfo info(path);
+    if (!info.isFile() || info.size() != data.size()) {
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&s_writtenFilesMutex);
+        const auto written = s_writtenFiles.constFind(path);
+        if (written != s_writtenFiles.constEnd() && written->size == info.size()
+            && written->lastModified == info.lastModified()) {
+            return written->hash == hash;
+        }
+    }
+
+    // Not written by us or modified since: compare with the file's content.
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    if (file.readAll() != data) {
+        return false;
+    }
+    rememberWrittenFile(path, hash);
+    return true;
+}
+
+FileWriteBatch::Result removeIfExists(const QString& path)
+{
+    forgetWrittenFile(path);
+    if (!QFileInfo::exists(path)) {
+        return FileWriteBatch::Result::Unchanged;
+    }
+    if (!QFile::remove(path)) {
+        qWarning() << "[FileWriteBatch] Could not remove file:" << path;
+        return FileWriteBatch::Result::Failed;
+    }
+    return FileWriteBatch::Result::Removed;
+}
+
+/// Returns the thread pool for batches writing to the file system of the given path.
+/// Each pool has a single thread: parallel writes mostly compete for the same disk or
+/// network share, and batches writing the same file must be executed in order.
+QThreadPool* ioThreadPool(const QString& path)
+{
+    static QMutex mutex;
+    static QHash<QString, QThreadPool*> pools;
+
+    // The directory may not exist yet, e.g. "extrafanart". Its parent's file system is used instead.
+    QDir dir = QFileInfo(path).absoluteDir();
+    while (!dir.exists() && dir.cdUp()) {
+    }
+    const QString fileSystem = QStorageInfo(dir).rootPath();
+
+    QMutexLocker locker(&mutex);
+    QThreadPool*& pool = pools[fileSystem];
+    if (pool == nullptr) {
+        pool = new QThreadPool();
+        pool->setMaxThreadCount(1);
+    }
+    return pool;
+}
+
+} // namespace
+
+int FileWriteBatch::writeFile(const QString& path, const QByteArray& data)
+{
+    Operation operation;
+    operation.path = path;
+    operation.data = data;
+    return add(std::move(operation));
+}
+
+int FileWriteBatch::writeTextFile(const QString& path, const QByteArray& data)
+{
+    Operation operation;
+    operation.path = path;
+    operation.data = data;
+    operation.text = true;
+    return add(std::move(operation));
+}
+
+int FileWriteBatch::removeFile(const QString& path)
+{
+    Operation operation;
+    operation.path = path;
+    operation.remove = true;
+    return add(std::move(operation));
+}
+
+int FileWriteBatch::add(Operation operation)
+{
+    m_operations.append(std::move(operation));
+    return m_operations.size() - 1;
+}
+
+bool FileWriteBatch::isPathFree(const QString& path) const
+{
+    for (int i = m_operations.size() - 1; i >= 0; --i) {
+        if (m_operations[i].path == path) {
+            return m_operations[i].remove;
+        }
+    }
+    return !QFileInfo::exists(path);
+}
+
+QVector<FileWriteBatch::Result> FileWriteBatch::execute() const
+{
+    QVector<Result> results;
+    results.reserve(m_operations.size());
+    for (const Operation& operation : m_operations) {
+        if (operation.remove) {
+            results.append(removeIfExists(operation.path));
+            continue;
+        }
+#ifdef Q_OS_WIN
+        // Same conversion as QIODevice::Text
+        if (operation.text) {
+            QByteArray data = operation.data;
+            data.replace("\n", "\r\n");
+            results.append(writeIfChanged(operation.path, data));
+            continue;
+        }
+#endif
+        results.append(writeIfChanged(operation.path, operation.data));
+    }
+    return results;
+}
+
+QFuture<QVector<FileWriteBatch::Result>> FileWriteBatch::executeAsync() const
+{
+    const FileWriteBatch batch = *this;
+    const QString path = m_operations.isEmpty() ? QString() : m_operations.first().path;
+    return QtConcurrent::run(ioThreadPool(path), [batch]() { return batch.execute(); });
+}
+
+FileWriteBatch::Result FileWriteBatch::writeIfChanged(const QString& path, const QByteArray& data)
+{
+    const QByteArray hash = contentHash(data);
+    if (hasContent(path, data, hash)) {
+        return Result::Unchanged;
+    }
+
+    const QDir dir = QFileInfo(path).dir();
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+
+    QSaveFile file(path);
+    // Directories in which we can't create the temporary file are written directly.
+    file.setDirectWriteFallback(true);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "[FileWriteBatch] Could not open file for writing:" << path << file.errorString();
+        return Result::Failed;
+    }
+    if (file.write(data) != data.size()) {
+        qWarning() << "[FileWriteBatch] Could not write file:" << path << file.errorString();
+        file.cancelWriting();
+        return Result::Failed;
+    }
+    if (!file.commit()) {
+        qWarning() << "[FileWriteBatch] Could not save file:" << path << file.errorString();
+        return Result::Failed;
+    }
+
+    rememberWrittenFile(path, hash);
+    return Result::Written;
+}
+
+} // namespace mediaelch
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFuture>
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief File writes and removals that belong to one item, e.g. a movie's NFO files and artwork.
+///
+/// Operations are executed in the order they were added. Writes are skipped if
+/// the file already has the given content, so that saving an unchanged item
+/// does not touch the file system (and does not trigger rescans of media centers
+/// or network shares). All other writes go to a temporary file that replaces the
+/// target file once it was written completely, see QSaveFile.
+///
+/// \par Example
+/// \code{cpp}
+///   FileWriteBatch batch;
+///   const int nfo = batch.writeTextFile("/movies/Alien/movie.nfo", xml);
+///   batch.writeFile("/movies/Alien/poster.jpg", poster);
+///   const auto results = batch.executeAsync().result();
+///   bool saved = FileWriteBatch::succeeded(results.at(nfo));
+/// \endcode
+class FileWriteBatch
+{
+public:
+    enum class Result
+    {
+        Written,
+        /// The file already had the given content or the file to remove did not exist.
+        Unchanged,
+        Removed,
+        Failed
+    };
+
+    struct Operation
+    {
+        QString path;
+        QByteArray data;
+        bool remove = false;
+        bool text = false;
+    };
+
+    /// \brief Adds a binary write and returns the index of its result.
+    int writeFile(const QString& path, const QByteArray& data);
+    /// \brief Adds a write in text mode, i.e. with native line endings, and returns the index of its result.
+    int writeTextFile(const QString& path, const QByteArray& data);
+    /// \brief Adds a removal and returns the index of its result.
+    int removeFile(const QString& path);
+
+    bool isEmpty() const { return m_operations.isEmpty(); }
+    const QVector<Operation>& operations() const { return m_operations; }
+
+    /// \brief Returns true if no file will exist at the path after the operations added so far.
+    /// Only the batch's own operations and the file system's current state are considered.
+    bool isPathFree(const QString& path) const;
+
+    /// \brief Executes all operations in the calling thread.
+    QVector<Result> execute() const;
+    /// \brief Executes all operations in a background I/O thread.
+    /// Each file system has its own thread so that slow network shares don't block
+    /// writes to local disks. Batches for the same file system are executed one after
+    /// another in the order of executeAsync() calls, so later writes to a file win.
+    /// The file system is determined by the batch's first operation.
+    QFuture<QVector<Result>> executeAsync() const;
+
+    static bool succeeded(Result result) { return result != Result::Failed; }
+
+    /// \brief Writes the data to the file unless the file already has this content.
+    static Result writeIfChanged(const QString& path, const QByteArray& data);
+
+private:
+    int add(Operation operation);
+
+    QVector<Operation> m_operations;
+};
+
+} // namespace mediaelch
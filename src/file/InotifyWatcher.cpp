@@ -0,0 +1,233 @@
+#include "file/InotifyWatcher.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QSocketNotifier>
+
+#ifdef Q_OS_LINUX
+#include <cerrno>
+#include <cstring>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace mediaelch {
+
+namespace {
+
+constexpr std::chrono::milliseconds defaultDebounceInterval{2000};
+/// Changes are reported at the latest after this many debounce intervals.
+constexpr int maxDebounceIntervals = 10;
+
+#ifdef Q_OS_LINUX
+constexpr uint32_t watchMask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ONLYDIR
+                               | IN_DONT_FOLLOW;
+/// Events that change a directory because of a file in it. IN_CREATE is left out
+/// because the file may still be written; IN_CLOSE_WRITE follows once it's done.
+constexpr uint32_t fileChangeMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM;
+#endif
+
+} // namespace
+
+InotifyWatcher::InotifyWatcher(QObject* parent) : QObject(parent)
+{
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(static_cast<int>(defaultDebounceInterval.count()));
+    connect(&m_debounceTimer, &QTimer::timeout, this, &InotifyWatcher::onDebounceTimeout);
+
+#ifdef Q_OS_LINUX
+    m_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0) {
+        qWarning() << "[InotifyWatcher] Could not initialize inotify:" << std::strerror(errno);
+        return;
+    }
+    m_notifier = new QSocketNotifier(m_fd, QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &InotifyWatcher::onEvents);
+#endif
+}
+
+InotifyWatcher::~InotifyWatcher()
+{
+#ifdef Q_OS_LINUX
+    if (m_fd >= 0) {
+        // Closing the descriptor removes all watches.
+        ::close(m_fd);
+    }
+#endif
+}
+
+bool InotifyWatcher::isSupported()
+{
+#ifdef Q_OS_LINUX
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool InotifyWatcher::watchTree(const QString& path)
+{
+    if (m_fd < 0 || !addWatch(path)) {
+        return false;
+    }
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        addWatch(it.next());
+    }
+    qDebug() << "[InotifyWatcher] Watching" << m_watches.count() << "directories";
+    return true;
+}
+
+void InotifyWatcher::clear()
+{
+#ifdef Q_OS_LINUX
+    for (auto it = m_watches.constBegin(); it != m_watches.constEnd(); ++it) {
+        ::inotify_rm_watch(m_fd, it.key());
+    }
+#endif
+    m_watches.clear();
+    m_changedDirectories.clear();
+    m_debounceTimer.stop();
+    m_pendingSince.invalidate();
+    m_watchLimitReached = false;
+}
+
+void InotifyWatcher::setDebounceInterval(std::chrono::milliseconds interval)
+{
+    m_debounceTimer.setInterval(static_cast<int>(interval.count()));
+}
+
+bool InotifyWatcher::addWatch(const QString& path)
+{
+#ifdef Q_OS_LINUX
+    const int wd = ::inotify_add_watch(m_fd, QFile::encodeName(path).constData(), watchMask);
+    if (wd < 0) {
+        if (errno == ENOSPC && !m_watchLimitReached) {
+            m_watchLimitReached = true;
+            qWarning() << "[InotifyWatcher] inotify watch limit reached; increase fs.inotify.max_user_watches";
+        } else if (errno != ENOSPC) {
+            qWarning() << "[InotifyWatcher] Could not watch" << path << std::strerror(errno);
+        }
+        return false;
+    }
+    m_watches.insert(wd, path);
+    return true;
+#else
+    Q_UNUSED(path);
+    return false;
+#endif
+}
+
+void InotifyWatcher::addTree(const QString& path)
+{
+    addWatch(path);
+    markChanged(path);
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString directory = it.next();
+        addWatch(directory);
+        markChanged(directory);
+    }
+}
+
+void InotifyWatcher::removeTree(const QString& path)
+{
+    const QString prefix = path + "/";
+    for (auto it = m_watches.begin(); it != m_watches.end();) {
+        if (it.value() == path || it.value().startsWith(prefix)) {
+            markChanged(it.value());
+#ifdef Q_OS_LINUX
+            ::inotify_rm_watch(m_fd, it.key());
+#endif
+            it = m_watches.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void InotifyWatcher::markChanged(const QString& directory)
+{
+    m_changedDirectories.insert(directory);
+}
+
+void InotifyWatcher::onEvents()
+{
+#ifdef Q_OS_LINUX
+    // NOLINTNEXTLINE: inotify requires a buffer that is aligned for inotify_event
+    alignas(inotify_event) char buffer[16 * 1024];
+    while (true) {
+        const ssize_t length = ::read(m_fd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0U) {
+                // Events were lost: report everything as changed.
+                qWarning() << "[InotifyWatcher] Event queue overflow";
+                for (const QString& directory : m_watches) {
+                    markChanged(directory);
+                }
+                continue;
+            }
+            if ((event->mask & IN_IGNORED) != 0U) {
+                m_watches.remove(event->wd);
+                continue;
+            }
+
+            const QString directory = m_watches.value(event->wd);
+            if (directory.isEmpty()) {
+                continue;
+            }
+            const bool isDirectory = (event->mask & IN_ISDIR) != 0U;
+            if (!isDirectory && (event->mask & fileChangeMask) == 0U) {
+                continue;
+            }
+            markChanged(directory);
+            if (event->len == 0 || !isDirectory) {
+                continue;
+            }
+
+            const QString path = directory + "/" + QFile::decodeName(event->name);
+            if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0U) {
+                addTree(path);
+            } else if ((event->mask & (IN_DELETE | IN_MOVED_FROM)) != 0U) {
+                removeTree(path);
+            }
+        }
+    }
+#endif
+
+    if (m_changedDirectories.isEmpty()) {
+        return;
+    }
+    if (!m_pendingSince.isValid()) {
+        m_pendingSince.start();
+    }
+    if (m_pendingSince.elapsed() >= qint64(m_debounceTimer.interval()) * maxDebounceIntervals) {
+        onDebounceTimeout();
+        return;
+    }
+    m_debounceTimer.start();
+}
+
+void InotifyWatcher::onDebounceTimeout()
+{
+    m_debounceTimer.stop();
+    m_pendingSince.invalidate();
+    if (m_changedDirectories.isEmpty()) {
+        return;
+    }
+    QStringList directories = m_changedDirectories.toList();
+    m_changedDirectories.clear();
+    directories.sort();
+    emit sigDirectoriesChanged(directories);
+}
+
+} // namespace mediaelch
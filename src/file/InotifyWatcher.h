@@ -0,0 +1,75 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <chrono>
+
+class QSocketNotifier;
+
+namespace mediaelch {
+
+/// \brief Watches directory trees for added, removed and renamed files using inotify.
+///
+/// Unlike QFileSystemWatcher, which opens a file descriptor per directory on
+/// some platforms and keeps a list of all paths, one inotify instance handles
+/// all directories. Subdirectories that are created or moved into a watched
+/// tree are watched as well.
+///
+/// Events are collected and reported once no further events arrived for the
+/// debounce interval, e.g. after a release was completely moved into the
+/// library. Files are reported once they were closed after writing, so that
+/// files which are still being copied are not picked up.
+///
+/// Only supported on Linux. On other systems, watchTree() always fails.
+class InotifyWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit InotifyWatcher(QObject* parent = nullptr);
+    ~InotifyWatcher() override;
+
+    static bool isSupported();
+
+    /// \brief Watches the directory and all of its subdirectories.
+    /// Returns false if the directory can't be watched at all.
+    bool watchTree(const QString& path);
+    /// \brief Stops watching all directories. Pending changes are discarded.
+    void clear();
+    int watchCount() const { return m_watches.count(); }
+
+    void setDebounceInterval(std::chrono::milliseconds interval);
+
+signals:
+    /// \brief Directories whose entries changed since the last signal.
+    /// Directories that were removed or moved away are included as well.
+    void sigDirectoriesChanged(QStringList directories);
+
+private slots:
+    void onEvents();
+    void onDebounceTimeout();
+
+private:
+    bool addWatch(const QString& path);
+    /// \brief Watches the new directory tree and marks all of its directories as changed.
+    void addTree(const QString& path);
+    void removeTree(const QString& path);
+    void markChanged(const QString& directory);
+
+    int m_fd = -1;
+    QSocketNotifier* m_notifier = nullptr;
+    /// Watch descriptor -> watched directory
+    QHash<int, QString> m_watches;
+    QSet<QString> m_changedDirectories;
+    QTimer m_debounceTimer;
+    /// Time since the oldest unreported change. Changes are reported after some time
+    /// even if events keep arriving, e.g. while a large download is extracted.
+    QElapsedTimer m_pendingSince;
+    bool m_watchLimitReached = false;
+};
+
+} // namespace mediaelch
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "data/ImageBlob.h"
+
 #include <QDebug>
 #include <QMetaType>
 #include <QString>
@@ -10,7 +12,7 @@ struct Actor
     QString name;
     QString role;
     QString thumb;
-    QByteArray image;
+    mediaelch::ImageBlob image;
     QString id;
     int order = 0; // used by Kodi NFO
     bool imageHasChanged = false;
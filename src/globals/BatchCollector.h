@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QVector>
+
+#include <functional>
+#include <utility>
+
+namespace mediaelch {
+
+/// \brief Collects items produced on a worker thread and hands them out in batches.
+///
+/// A batch is handed out as soon as the cadence has elapsed since the last batch
+/// or if the maximum batch size is reached, whichever comes first. The flush function
+/// usually emits a queued signal so that the GUI thread only has to handle a few
+/// batches per second instead of one event per item.
+///
+/// \par Example
+/// \code{cpp}
+///   BatchCollector<Movie*> collector([this](QVector<Movie*> movies) { emit moviesBatchLoaded(movies); });
+///   for (Movie* movie : movies) {
+///       collector.add(movie);
+///   }
+///   collector.flush();
+/// \endcode
+template<class T>
+class BatchCollector
+{
+public:
+    using FlushFunction = std::function<void(QVector<T>)>;
+
+    explicit BatchCollector(FlushFunction flush, int cadenceMs = 100, int maxBatchSize = 250) :
+        m_flush{std::move(flush)}, m_cadenceMs{cadenceMs}, m_maxBatchSize{maxBatchSize}
+    {
+        m_timer.start();
+    }
+
+    /// \brief Adds the item to the current batch. May flush the batch.
+    void add(T item)
+    {
+        m_batch.append(std::move(item));
+        if (m_batch.size() >= m_maxBatchSize || m_timer.elapsed() >= m_cadenceMs) {
+            flush();
+        }
+    }
+
+    /// \brief Hands out all pending items, regardless of the cadence.
+    void flush()
+    {
+        m_timer.restart();
+        if (m_batch.isEmpty()) {
+            return;
+        }
+        QVector<T> batch;
+        batch.swap(m_batch);
+        m_flush(std::move(batch));
+    }
+
+    /// \brief Number of items that were not yet handed out.
+    int pendingCount() const { return m_batch.size(); }
+
+private:
+    FlushFunction m_flush;
+    int m_cadenceMs;
+    int m_maxBatchSize;
+    QElapsedTimer m_timer;
+    QVector<T> m_batch;
+};
+
+} // namespace mediaelch
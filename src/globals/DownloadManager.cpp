@@ -230,7 +230,7 @@ void DownloadManager::startNextDownload()
         download.data = data;
 
         if (download.actor != nullptr && download.imageType == ImageType::Actor && (download.movie == nullptr)) {
-            download.actor->image = data;
+            download.actor->image = mediaelch::ImageBlob(data);
 
         } else if (download.imageType == ImageType::TvShowEpisodeThumb && !download.directDownload) {
             download.episode->setThumbnailImage(data);
@@ -335,7 +335,7 @@ void DownloadManager::downloadFinished()
 
     if (m_currentDownloadElement.actor != nullptr && m_currentDownloadElement.imageType == ImageType::Actor
         && m_currentDownloadElement.movie == nullptr) {
-        m_currentDownloadElement.actor->image = data;
+        m_currentDownloadElement.actor->image = mediaelch::ImageBlob(data);
 
     } else if (m_currentDownloadElement.imageType == ImageType::TvShowEpisodeThumb
                && !m_currentDownloadElement.directDownload) {
@@ -67,6 +67,7 @@ private:
     // \todo Refactor into atomic
     bool m_downloading = false;
     QMutex m_mutex;
-    QTimer m_timer;
+    // Child of this object so that it follows moveToThread(), e.g. for movies created by file searchers.
+    QTimer m_timer{this};
     int m_retries = 0;
 };
@@ -17,6 +17,7 @@
 #include <QPainter>
 #include <QPushButton>
 #include <QRegExp>
+#include <QRegularExpression>
 #include <QSpinBox>
 #include <QWidget>
 
@@ -220,31 +221,34 @@ QString& sanitizeFileName(QString& fileName)
 
 QString stackedBaseName(const QString& fileName)
 {
-    QString baseName = fileName;
-    QRegExp rx1a(R"((.*)([ _\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _\.-]*[0-9]+)(.*)(\.[^.]+)$)", Qt::CaseInsensitive);
-    QRegExp rx1b("(.*)([ _\\.-]+)$");
-    QRegExp rx2a("(.*)([ _\\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _.-]*[a-d])(.*)(\\.[^.]+)$", Qt::CaseInsensitive);
-    QRegExp rx2b("(.*)([ _\\.-]+)$");
-
-    QVector<QVector<QRegExp>> regex;
-    regex << (QVector<QRegExp>() << rx1a << rx1b);
-    regex << (QVector<QRegExp>() << rx2a << rx2b);
-
-    for (const QVector<QRegExp>& rx : regex) {
-        if (rx.at(0).indexIn(fileName) != -1) {
-            QString title = rx.at(0).cap(1);
-            QString volume = rx.at(0).cap(2);
-            /*QString ignore = rx.at(0).cap(3);
-            QString extension = rx.at(0).cap(4);*/
-            while (rx.at(1).indexIn(title) != -1) {
-                title = rx.at(1).capturedTexts().at(1);
-                volume.prepend(rx.at(1).capturedTexts().at(2));
+    // Compiled once: this function is called for every file of every multi-file movie folder.
+    static const QVector<QRegularExpression> volumePatterns = []() {
+        QVector<QRegularExpression> patterns{
+            QRegularExpression(R"(^(.*)([ _\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _\.-]*[0-9]+)(.*)(\.[^.]+)$)",
+                QRegularExpression::CaseInsensitiveOption),
+            QRegularExpression(R"(^(.*)([ _\.-]*(?:cd|dvd|p(?:ar)?t|dis[ck])[ _.-]*[a-d])(.*)(\.[^.]+)$)",
+                QRegularExpression::CaseInsensitiveOption)};
+        for (QRegularExpression& pattern : patterns) {
+            pattern.optimize();
+        }
+        return patterns;
+    }();
+
+    for (const QRegularExpression& rx : volumePatterns) {
+        const QRegularExpressionMatch match = rx.match(fileName);
+        if (match.hasMatch()) {
+            QString title = match.captured(1);
+            // Remove trailing separators
+            int length = title.length();
+            while (length > 0 && QStringLiteral(" _.-").contains(title.at(length - 1))) {
+                --length;
             }
+            title.truncate(length);
             return title;
         }
     }
 
-    return baseName;
+    return fileName;
 }
 
 QString appendArticle(const QString& text)
@@ -2,14 +2,17 @@
 #include "ui_ImageDialog.h"
 
 #include <QBuffer>
+#include <QCache>
 #include <QDebug>
 #include <QFileDialog>
+#include <QFutureWatcher>
 #include <QLabel>
 #include <QMovie>
 #include <QPainter>
 #include <QSize>
 #include <QStandardPaths>
 #include <QTimer>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/qmath.h>
 
 #include "concerts/Concert.h"
@@ -26,6 +29,36 @@
 #include "ui/main/MainWindow.h"
 #include "ui/small_widgets/ImageLabel.h"
 
+namespace {
+
+struct ScaledPreview
+{
+    QImage image;
+    QImage scaled;
+};
+
+/// Decoded preview images by thumbnail URL, shared by all image dialogs so that
+/// reopening the dialog for the same item does not download the previews again.
+/// Only used in the GUI thread. The cost is in KiB.
+QCache<QUrl, QImage>& previewCache()
+{
+    static QCache<QUrl, QImage> cache(128 * 1024);
+    return cache;
+}
+
+/// Runs in a worker thread: decodes the image if data is given and scales it to the given width.
+ScaledPreview scalePreview(const QByteArray& data, QImage image, int width)
+{
+    ScaledPreview preview;
+    preview.image = data.isEmpty() ? std::move(image) : QImage::fromData(data);
+    if (!preview.image.isNull()) {
+        preview.scaled = preview.image.scaledToWidth(width, Qt::SmoothTransformation);
+    }
+    return preview;
+}
+
+} // namespace
+
 ImageDialog::ImageDialog(QWidget* parent) : QDialog(parent), ui(new Ui::ImageDialog)
 {
     ui->setupUi(this);
@@ -66,7 +99,6 @@ ImageDialog::ImageDialog(QWidget* parent) : QDialog(parent), ui(new Ui::ImageDia
     ui->labelSpinner->setMovie(movie);
     clearSearch();
     setImageType(ImageType::MoviePoster);
-    m_currentDownloadReply = nullptr;
     m_multiSelection = false;
 
     QPixmap zoomOut(":/img/zoom_out.png");
@@ -285,6 +317,7 @@ void ImageDialog::setDownloads(QVector<Poster> downloads, bool initial)
     if (initial) {
         m_defaultElements = downloads;
     }
+    const int firstIndex = m_elements.size();
     for (const Poster& poster : downloads) {
         DownloadElement d;
         d.originalUrl = poster.originalUrl;
@@ -295,12 +328,24 @@ void ImageDialog::setDownloads(QVector<Poster> downloads, bool initial)
         if (!poster.language.isEmpty()) {
             d.hint.append(" (" + poster.language + ")");
         }
+        const QImage* cached = previewCache().object(d.thumbUrl);
+        if (cached != nullptr) {
+            d.image = *cached;
+            d.downloaded = true;
+        }
         m_elements.append(d);
     }
     ui->labelLoading->setVisible(true);
     ui->labelSpinner->setVisible(true);
+    if (ui->table->columnCount() != calcColumnCount()) {
+        renderTable();
+    } else {
+        // Only add the new cells; existing previews are kept.
+        for (int i = firstIndex, n = m_elements.size(); i < n; i++) {
+            setupCell(i);
+        }
+    }
     startNextDownload();
-    renderTable();
     if (downloads.count() == 0) {
         ui->stackedWidget->setCurrentIndex(2);
     }
@@ -312,67 +357,127 @@ mediaelch::network::NetworkManager* ImageDialog::network()
 }
 
 /**
- * \brief Starts the next download if there is one
+ * \brief Starts downloads of previews until maxParallelDownloads are running
  */
 void ImageDialog::startNextDownload()
 {
-    qDebug() << "[ImageDialog] Start next download";
-
-    int nextIndex = -1;
-    for (int i = 0, n = m_elements.size(); i < n; i++) {
-        if (!m_elements[i].downloaded) {
-            nextIndex = i;
-            break;
+    for (int i = 0, n = m_elements.size(); i < n && m_runningDownloads < maxParallelDownloads; i++) {
+        DownloadElement& element = m_elements[i];
+        if (element.downloaded || element.reply != nullptr) {
+            continue;
         }
+        QNetworkReply* reply = network()->get(mediaelch::network::requestWithDefaults(element.thumbUrl));
+        element.reply = reply;
+        ++m_runningDownloads;
+        const int generation = m_generation;
+        connect(reply, &QNetworkReply::finished, this, [this, reply, i, generation]() { //
+            downloadFinished(reply, i, generation);
+        });
     }
 
-    if (nextIndex == -1) {
+    if (m_runningDownloads == 0) {
         ui->labelLoading->setVisible(false);
         ui->labelSpinner->setVisible(false);
-        return;
     }
-    m_currentDownloadIndex = nextIndex;
-    m_currentDownloadReply = network()->get(mediaelch::network::requestWithDefaults(m_elements[nextIndex].thumbUrl));
-    connect(m_currentDownloadReply, &QNetworkReply::finished, this, &ImageDialog::downloadFinished);
 }
 
 /**
  * \brief Called when a download has finished
- * Renders the table and displays the downloaded image and starts the next download
- */
-void ImageDialog::downloadFinished()
-{
-    if (m_currentDownloadReply->error() == QNetworkReply::NoError) {
-        m_elements[m_currentDownloadIndex].pixmap.loadFromData(m_currentDownloadReply->readAll());
-        helper::setDevicePixelRatio(m_elements[m_currentDownloadIndex].pixmap, helper::devicePixelRatio(this));
-
-        if (!m_elements[m_currentDownloadIndex].pixmap.isNull()) {
-            const int width = static_cast<int>((getColumnWidth() - 10) * helper::devicePixelRatio(this));
-            m_elements[m_currentDownloadIndex].scaledPixmap =
-                m_elements[m_currentDownloadIndex].pixmap.scaledToWidth(width, Qt::SmoothTransformation);
-            helper::setDevicePixelRatio(
-                m_elements[m_currentDownloadIndex].scaledPixmap, helper::devicePixelRatio(this));
-            m_elements[m_currentDownloadIndex].cellWidget->setImage(m_elements[m_currentDownloadIndex].scaledPixmap);
-            m_elements[m_currentDownloadIndex].cellWidget->setHint(
-                m_elements[m_currentDownloadIndex].resolution, m_elements[m_currentDownloadIndex].hint);
-        }
-        ui->table->resizeRowsToContents();
+ * Decodes the preview in a worker thread and starts the next download
+ */
+void ImageDialog::downloadFinished(QNetworkReply* reply, int index, int generation)
+{
+    reply->deleteLater();
+    // The elements have been cleared by aborting all downloads
+    if (generation != m_generation) {
+        return;
+    }
+
+    --m_runningDownloads;
+    // Mark item as downloaded even if there was an error to avoid an infinite loop.
+    m_elements[index].reply = nullptr;
+    m_elements[index].downloaded = true;
 
+    if (reply->error() == QNetworkReply::NoError) {
+        loadPreview(index, reply->readAll());
     } else {
-        showError(tr("Error while downloading one or more images: %1").arg(m_currentDownloadReply->errorString()));
-        qWarning() << "Network Error: " << m_currentDownloadReply->errorString() << " | "
-                   << m_currentDownloadReply->url();
+        showError(tr("Error while downloading one or more images: %1").arg(reply->errorString()));
+        qWarning() << "Network Error: " << reply->errorString() << " | " << reply->url();
     }
 
-    // It is possible that m_elements has been cleared by aborting all downloads
-    if (m_currentDownloadIndex < m_elements.size()) {
-        // Mark item as downloaded even if there was an error to avoid an infinite loop.
-        m_elements[m_currentDownloadIndex].downloaded = true;
-    }
-    m_currentDownloadReply->deleteLater();
     startNextDownload();
 }
 
+/**
+ * \brief Decodes (if data is not empty) and scales the preview of the given element in a worker thread
+ */
+void ImageDialog::loadPreview(int index, const QByteArray& data)
+{
+    DownloadElement& element = m_elements[index];
+    element.isScaling = true;
+
+    const int generation = m_generation;
+    const int width = previewWidth();
+    const QUrl thumbUrl = element.thumbUrl;
+    auto* watcher = new QFutureWatcher<ScaledPreview>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, index, generation, thumbUrl]() {
+        watcher->deleteLater();
+        const ScaledPreview preview = watcher->result();
+        if (generation != m_generation) {
+            return;
+        }
+        DownloadElement& current = m_elements[index];
+        current.isScaling = false;
+        if (preview.image.isNull()) {
+            return;
+        }
+        if (current.image.isNull()) {
+            current.image = preview.image;
+            const int cost = qMax(1, preview.image.bytesPerLine() * preview.image.height() / 1024);
+            previewCache().insert(thumbUrl, new QImage(preview.image), cost);
+        }
+        if (preview.scaled.width() != previewWidth()) {
+            // The preview size has changed in the meantime.
+            showPreview(index);
+            return;
+        }
+        current.scaledPixmap = QPixmap::fromImage(preview.scaled);
+        helper::setDevicePixelRatio(current.scaledPixmap, helper::devicePixelRatio(this));
+        updateCell(index);
+    });
+    watcher->setFuture(QtConcurrent::run(scalePreview, data, element.image, width));
+}
+
+/**
+ * \brief Shows the preview of the element in its cell, scales it first if the preview size has changed
+ */
+void ImageDialog::showPreview(int index)
+{
+    const DownloadElement& element = m_elements[index];
+    if (element.image.isNull() || element.isScaling) {
+        return;
+    }
+    if (element.scaledPixmap.isNull() || element.scaledPixmap.width() != previewWidth()) {
+        loadPreview(index, QByteArray());
+        return;
+    }
+    updateCell(index);
+}
+
+/**
+ * \brief Sets the scaled preview of the element on its cell widget
+ */
+void ImageDialog::updateCell(int index)
+{
+    const DownloadElement& element = m_elements[index];
+    if (element.cellWidget == nullptr || element.scaledPixmap.isNull()) {
+        return;
+    }
+    element.cellWidget->setImage(element.scaledPixmap);
+    element.cellWidget->setHint(element.resolution, element.hint);
+    ui->table->resizeRowToContents(index / ui->table->columnCount());
+}
+
 /**
  * \brief Renders the table
  */
@@ -388,27 +493,38 @@ void ImageDialog::renderTable()
     }
 
     for (int i = 0, n = m_elements.size(); i < n; i++) {
-        int row = (i - (i % cols)) / cols;
-        if (i % cols == 0) {
-            ui->table->insertRow(row);
-        }
-        auto item = new QTableWidgetItem;
-        item->setData(Qt::UserRole, m_elements[i].originalUrl);
-        auto label = new ImageLabel(ui->table);
-        if (!m_elements[i].pixmap.isNull()) {
-            const int width = static_cast<int>((getColumnWidth() - 10) * helper::devicePixelRatio(this));
-            QPixmap pixmap = m_elements[i].pixmap.scaledToWidth(width, Qt::SmoothTransformation);
-            helper::setDevicePixelRatio(pixmap, helper::devicePixelRatio(this));
-            label->setImage(pixmap);
-            label->setHint(m_elements[i].resolution, m_elements[i].hint);
-        }
-        m_elements[i].cellWidget = label;
-        ui->table->setItem(row, i % cols, item);
-        ui->table->setCellWidget(row, i % cols, label);
-        ui->table->resizeRowToContents(row);
+        setupCell(i);
     }
 }
 
+/**
+ * \brief Adds the cell of the element at the given index to the table
+ */
+void ImageDialog::setupCell(int index)
+{
+    const int cols = ui->table->columnCount();
+    const int row = index / cols;
+    if (row >= ui->table->rowCount()) {
+        ui->table->setRowCount(row + 1);
+    }
+    auto item = new QTableWidgetItem;
+    item->setData(Qt::UserRole, m_elements[index].originalUrl);
+    auto label = new ImageLabel(ui->table);
+    m_elements[index].cellWidget = label;
+    ui->table->setItem(row, index % cols, item);
+    ui->table->setCellWidget(row, index % cols, label);
+    showPreview(index);
+    ui->table->resizeRowToContents(row);
+}
+
+/**
+ * \brief Width of the scaled previews in device pixels
+ */
+int ImageDialog::previewWidth()
+{
+    return static_cast<int>((getColumnWidth() - 10) * helper::devicePixelRatio(this));
+}
+
 /**
  * \brief Calculates the number of columns that can be displayed
  * \return Number of columns that fit in the layout
@@ -417,7 +533,7 @@ int ImageDialog::calcColumnCount()
 {
     auto tableWidth = static_cast<qreal>(ui->table->size().width());
     auto columnWidth = static_cast<qreal>(getColumnWidth() + 4);
-    return qFloor(tableWidth / columnWidth);
+    return qMax(1, qFloor(tableWidth / columnWidth));
 }
 
 /**
@@ -532,17 +648,15 @@ void ImageDialog::cancelDownloads()
 {
     ui->labelLoading->setVisible(false);
     ui->labelSpinner->setVisible(false);
-    bool running = false;
+    // Aborted replies and pending previews of the old generation are ignored.
+    ++m_generation;
+    m_runningDownloads = 0;
     for (const DownloadElement& d : m_elements) {
-        if (!d.downloaded) {
-            running = true;
-            break;
+        if (d.reply != nullptr) {
+            d.reply->abort();
         }
     }
     m_elements.clear();
-    if (running) {
-        m_currentDownloadReply->abort();
-    }
 }
 
 /**
@@ -568,16 +682,11 @@ void ImageDialog::chooseLocalImage()
     DownloadElement d;
     d.originalUrl = fileName;
     d.thumbUrl = fileName;
-    d.downloaded = false;
+    d.image = QImage(fileName);
+    d.resolution = d.image.size();
+    d.downloaded = true;
     m_elements.append(d);
-
-    renderTable();
-    m_elements[index].pixmap = QPixmap(fileName);
-    m_elements[index].pixmap = m_elements[index].pixmap.scaledToWidth(getColumnWidth() - 10, Qt::SmoothTransformation);
-    m_elements[index].cellWidget->setImage(m_elements[index].pixmap);
-    m_elements[index].cellWidget->setHint(m_elements[index].pixmap.size());
-    ui->table->resizeRowsToContents();
-    m_elements[index].downloaded = true;
+    setupCell(index);
     if (m_multiSelection) {
         QByteArray ba;
         QFile file(fileName);
@@ -607,20 +716,13 @@ void ImageDialog::onImageDropped(QUrl url)
     DownloadElement d;
     d.originalUrl = url;
     d.thumbUrl = url;
-    d.downloaded = false;
-    m_elements.append(d);
-
-    renderTable();
-
     if (url.toString().startsWith("file://")) {
-        m_elements[index].pixmap = QPixmap(url.toLocalFile());
-        m_elements[index].pixmap =
-            m_elements[index].pixmap.scaledToWidth(getColumnWidth() - 10, Qt::SmoothTransformation);
-        m_elements[index].cellWidget->setImage(m_elements[index].pixmap);
-        m_elements[index].cellWidget->setHint(m_elements[index].pixmap.size());
+        d.image = QImage(url.toLocalFile());
+        d.resolution = d.image.size();
     }
-    ui->table->resizeRowsToContents();
-    m_elements[index].downloaded = true;
+    d.downloaded = true;
+    m_elements.append(d);
+    setupCell(index);
     if (m_multiSelection) {
         QByteArray ba;
         QFile file(url.toLocalFile());
@@ -646,7 +748,17 @@ void ImageDialog::onPreviewSizeChange(int value)
     ui->buttonZoomIn->setDisabled(value == ui->previewSizeSlider->maximum());
     Settings::instance()->settings()->setValue(
         QString("ImageDialog/PreviewSize_%1").arg(static_cast<int>(m_type)), value);
-    renderTable();
+    if (calcColumnCount() != ui->table->columnCount()) {
+        renderTable();
+        return;
+    }
+    // Same layout: only rescale the previews instead of rebuilding all cells.
+    for (int i = 0, n = ui->table->columnCount(); i < n; i++) {
+        ui->table->setColumnWidth(i, getColumnWidth());
+    }
+    for (int i = 0, n = m_elements.size(); i < n; i++) {
+        showPreview(i);
+    }
 }
 
 /**
@@ -9,6 +9,7 @@
 #include "tv_shows/SeasonNumber.h"
 
 #include <QDialog>
+#include <QImage>
 #include <QLabel>
 #include <QNetworkReply>
 #include <QResizeEvent>
@@ -63,7 +64,6 @@ protected:
     void resizeEvent(QResizeEvent* event) override;
 
 private slots:
-    void downloadFinished();
     void startNextDownload();
     void imageClicked(int row, int col);
     void chooseLocalImage();
@@ -87,9 +87,14 @@ private:
     {
         QUrl thumbUrl;
         QUrl originalUrl;
-        QPixmap pixmap;
+        /// Decoded preview image in its original size.
+        QImage image;
+        /// Preview scaled to the current column width.
         QPixmap scaledPixmap;
         bool downloaded = false;
+        /// True while the preview is decoded or scaled by a worker thread.
+        bool isScaling = false;
+        QNetworkReply* reply = nullptr;
         ImageLabel* cellWidget = nullptr;
         QSize resolution;
         QString hint;
@@ -101,9 +106,14 @@ private:
         constexpr static int isDefaultProvider = Qt::UserRole + 1;
     };
 
+    /// Number of preview images that are downloaded at the same time.
+    static constexpr int maxParallelDownloads = 6;
+
     mediaelch::network::NetworkManager m_network;
-    int m_currentDownloadIndex = 0;
-    QNetworkReply* m_currentDownloadReply = nullptr;
+    int m_runningDownloads = 0;
+    /// Incremented whenever m_elements is cleared so that late downloads and
+    /// previews of the old elements are discarded.
+    int m_generation = 0;
     ImageType m_imageType = ImageType::None;
     QVector<DownloadElement> m_elements;
     QUrl m_imageUrl;
@@ -125,6 +135,12 @@ private:
 
     mediaelch::network::NetworkManager* network();
     void renderTable();
+    void setupCell(int index);
+    void updateCell(int index);
+    void showPreview(int index);
+    void loadPreview(int index, const QByteArray& data);
+    void downloadFinished(QNetworkReply* reply, int index, int generation);
+    int previewWidth();
     int calcColumnCount();
     int getColumnWidth();
     void loadImagesFromProvider(QString id);
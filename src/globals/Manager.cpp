@@ -4,6 +4,7 @@
 #include <QDesktopServices>
 #include <QSqlQuery>
 
+#include "concerts/Concert.h"
 #include "globals/Globals.h"
 #include "media_centers/KodiXml.h"
 #include "media_centers/MediaCenterInterface.h"
@@ -50,6 +51,12 @@ Manager::Manager(QObject* parent) : QObject(parent)
     qRegisterMetaType<Album*>("Album*");
     qRegisterMetaType<Artist*>("Artist*");
     qRegisterMetaType<MusicModelItem*>("MusicModelItem*");
+
+    // Batches of the file searchers' worker threads
+    qRegisterMetaType<QVector<Movie*>>("QVector<Movie*>");
+    qRegisterMetaType<QVector<TvShow*>>("QVector<TvShow*>");
+    qRegisterMetaType<QVector<Concert*>>("QVector<Concert*>");
+    qRegisterMetaType<QVector<Artist*>>("QVector<Artist*>");
 }
 
 Manager* Manager::instance()
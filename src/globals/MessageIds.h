@@ -11,6 +11,7 @@ namespace Constants {
     const int ConcertFileSearcherProgressMessageId = 10005;
     const int TvShowUpdaterProgressMessageId       = 10006;
     const int MusicFileSearcherProgressMessageId   = 10007;
+    const int ExtractorProgressMessageId           = 10008;
     const int MovieProgressMessageId               = 20000;
     const int TvShowProgressMessageId              = 40000;
     const int EpisodeProgressMessageId             = 60000;
@@ -0,0 +1,67 @@
+#include "globals/StringPool.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+namespace mediaelch {
+
+namespace {
+
+struct Pool
+{
+    QMutex mutex;
+    QSet<QString> strings;
+};
+
+Pool& pool()
+{
+    static Pool instance;
+    return instance;
+}
+
+QString internLocked(Pool& p, const QString& string)
+{
+    auto it = p.strings.constFind(string);
+    if (it != p.strings.constEnd()) {
+        return *it;
+    }
+    // Detach from possibly larger buffers, e.g. from QString::mid() or XML readers
+    // that reserve capacity, so that only the characters are kept.
+    const QString copy(string.constData(), string.size());
+    p.strings.insert(copy);
+    return copy;
+}
+
+} // namespace
+
+QString StringPool::intern(const QString& string)
+{
+    if (string.isEmpty()) {
+        return string;
+    }
+    Pool& p = pool();
+    QMutexLocker locker(&p.mutex);
+    return internLocked(p, string);
+}
+
+QStringList StringPool::intern(const QStringList& strings)
+{
+    QStringList interned;
+    interned.reserve(strings.size());
+    Pool& p = pool();
+    QMutexLocker locker(&p.mutex);
+    for (const QString& string : strings) {
+        interned.append(string.isEmpty() ? string : internLocked(p, string));
+    }
+    return interned;
+}
+
+int StringPool::size()
+{
+    Pool& p = pool();
+    QMutexLocker locker(&p.mutex);
+    return p.strings.size();
+}
+
+} // namespace mediaelch
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+namespace mediaelch {
+
+/// \brief Process-wide pool of shared strings for small vocabularies.
+///
+/// Genres, studios, countries, tags, networks and actor names repeat across
+/// thousands of movies, TV shows and concerts. Interning a string returns a
+/// QString that shares its data with all other interned copies of the same text,
+/// so that each value is stored only once.
+///
+/// The pool is thread-safe and never shrinks.
+///
+/// \par Example
+/// \code{cpp}
+///   m_genres.append(StringPool::intern(genre));
+/// \endcode
+class StringPool
+{
+public:
+    /// \brief Returns a shared copy of the given string. Empty strings are not pooled.
+    static QString intern(const QString& string);
+    static QStringList intern(const QStringList& strings);
+
+    /// \brief Number of distinct strings in the pool.
+    static int size();
+};
+
+} // namespace mediaelch
@@ -0,0 +1,134 @@
+#include "imports/ExtractionQueue.h"
+
+#include <QtGlobal>
+#include <algorithm>
+#include <utility>
+
+namespace mediaelch {
+
+ExtractionQueue::ExtractionQueue(int maxParallelJobs) : m_maxParallelJobs{qMax(1, maxParallelJobs)}
+{
+}
+
+void ExtractionQueue::setMaxParallelJobs(int maxParallelJobs)
+{
+    m_maxParallelJobs = qMax(1, maxParallelJobs);
+}
+
+bool ExtractionQueue::add(Job job)
+{
+    if (isPending(job.name) || isRunning(job.name)) {
+        return false;
+    }
+    if (isIdle()) {
+        // A new batch of jobs starts: don't count finished jobs of earlier batches.
+        m_progress.clear();
+        m_sizes.clear();
+    }
+    m_progress.insert(job.name, 0);
+    m_sizes.insert(job.name, qMax<qint64>(1, job.size));
+    m_addedOrder.insert(job.name, m_nextOrder++);
+    insertPending(std::move(job));
+    return true;
+}
+
+bool ExtractionQueue::removePending(const QString& name)
+{
+    for (int i = 0; i < m_pending.size(); ++i) {
+        if (m_pending[i].name == name) {
+            m_pending.removeAt(i);
+            m_progress.remove(name);
+            m_sizes.remove(name);
+            m_addedOrder.remove(name);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ExtractionQueue::setPriority(const QString& name, int priority)
+{
+    for (int i = 0; i < m_pending.size(); ++i) {
+        if (m_pending[i].name == name) {
+            Job job = m_pending.takeAt(i);
+            job.priority = priority;
+            insertPending(std::move(job));
+            return true;
+        }
+    }
+    return false;
+}
+
+QVector<ExtractionQueue::Job> ExtractionQueue::takeStartableJobs()
+{
+    QVector<Job> jobs;
+    for (int i = 0; i < m_pending.size() && m_running.size() < m_maxParallelJobs;) {
+        if (isDeviceBusy(m_pending[i].device)) {
+            ++i;
+            continue;
+        }
+        Job job = m_pending.takeAt(i);
+        m_addedOrder.remove(job.name);
+        m_running.insert(job.name, job);
+        jobs.append(job);
+    }
+    return jobs;
+}
+
+void ExtractionQueue::finish(const QString& name)
+{
+    if (m_running.remove(name) > 0) {
+        m_progress.insert(name, 100);
+    }
+}
+
+void ExtractionQueue::setProgress(const QString& name, int percent)
+{
+    if (m_running.contains(name)) {
+        m_progress.insert(name, qBound(0, percent, 100));
+    }
+}
+
+int ExtractionQueue::totalProgress() const
+{
+    qint64 totalSize = 0;
+    qint64 doneSize = 0;
+    for (auto it = m_sizes.constBegin(); it != m_sizes.constEnd(); ++it) {
+        totalSize += it.value();
+        doneSize += it.value() * m_progress.value(it.key()) / 100;
+    }
+    if (totalSize == 0) {
+        return 100;
+    }
+    return static_cast<int>(doneSize * 100 / totalSize);
+}
+
+bool ExtractionQueue::isPending(const QString& name) const
+{
+    return std::any_of(m_pending.cbegin(), m_pending.cend(), [&name](const Job& job) { return job.name == name; });
+}
+
+void ExtractionQueue::insertPending(Job job)
+{
+    // Keep the pending jobs sorted by priority; equal priorities in the order they were added.
+    const auto isBefore = [this](const Job& a, const Job& b) {
+        if (a.priority != b.priority) {
+            return a.priority > b.priority;
+        }
+        return m_addedOrder.value(a.name) < m_addedOrder.value(b.name);
+    };
+    const auto pos = std::upper_bound(m_pending.begin(), m_pending.end(), job, isBefore);
+    m_pending.insert(pos, std::move(job));
+}
+
+bool ExtractionQueue::isDeviceBusy(const QString& device) const
+{
+    for (const Job& job : m_running) {
+        if (job.device == device) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace mediaelch
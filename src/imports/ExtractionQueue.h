@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Decides which archives are extracted at the same time.
+///
+/// Extracting an archive reads and writes large files on the archive's disk.
+/// Several extractions on the same disk mostly compete for it, so only one job
+/// per device runs at a time. Jobs on different devices run in parallel up to
+/// maxParallelJobs(). Jobs with a higher priority are started first; jobs with
+/// the same priority in the order they were added.
+///
+/// The queue only keeps track of jobs; Extractor runs them.
+class ExtractionQueue
+{
+public:
+    struct Job
+    {
+        /// Unique name of the job, e.g. the package's base name.
+        QString name;
+        /// Device of the archive, see FileCopier::device().
+        QString device;
+        /// Jobs with a higher priority are started first.
+        int priority = 0;
+        /// Size of the archive. Used to weight the job's progress.
+        qint64 size = 0;
+    };
+
+    explicit ExtractionQueue(int maxParallelJobs = 2);
+
+    void setMaxParallelJobs(int maxParallelJobs);
+    int maxParallelJobs() const { return m_maxParallelJobs; }
+
+    /// \brief Adds a job. Returns false if a job with the same name is already queued or running.
+    bool add(Job job);
+    /// \brief Removes a job that was not started yet. Returns false if there is no such job.
+    bool removePending(const QString& name);
+    /// \brief Changes the priority of a job that was not started yet. Returns false if there is no such job.
+    bool setPriority(const QString& name, int priority);
+    /// \brief Marks the jobs that can be started now as running and returns them.
+    QVector<Job> takeStartableJobs();
+    /// \brief Marks the running job as finished.
+    void finish(const QString& name);
+
+    void setProgress(const QString& name, int percent);
+    /// \brief Progress of all jobs that were added since the queue was idle, weighted by their size.
+    int totalProgress() const;
+
+    bool isPending(const QString& name) const;
+    bool isRunning(const QString& name) const { return m_running.contains(name); }
+    bool isIdle() const { return m_pending.isEmpty() && m_running.isEmpty(); }
+
+private:
+    bool isDeviceBusy(const QString& device) const;
+    void insertPending(Job job);
+
+    int m_maxParallelJobs;
+    /// Sorted by priority, then by the order in which the jobs were added.
+    QVector<Job> m_pending;
+    QHash<QString, quint64> m_addedOrder;
+    quint64 m_nextOrder = 0;
+    QHash<QString, Job> m_running;
+    /// Progress in percent of all jobs since the queue was idle.
+    QHash<QString, int> m_progress;
+    QHash<QString, qint64> m_sizes;
+};
+
+} // namespace mediaelch
@@ -4,6 +4,7 @@
 #include <QFileInfo>
 #include <QProcess>
 
+#include "file/FileCopier.h"
 #include "settings/Settings.h"
 
 Extractor::Extractor(QObject* parent) : QObject(parent)
@@ -17,12 +18,14 @@ Extractor::~Extractor()
     }
 }
 
-void Extractor::extract(QString baseName, QStringList files, QString password)
+void Extractor::extract(QString baseName, QStringList files, QString password, int priority)
 {
     QStringList rarFiles;
+    qint64 size = 0;
     for (const QString& file : files) {
         if (file.endsWith(".rar")) {
             rarFiles.append(file);
+            size += QFileInfo(file).size();
         }
     }
     if (rarFiles.isEmpty()) {
@@ -33,27 +36,55 @@ void Extractor::extract(QString baseName, QStringList files, QString password)
 
     std::sort(rarFiles.begin(), rarFiles.end());
 
-    QString unrar = Settings::instance()->importSettings().unrar();
-
-    if (!QFileInfo(unrar).isFile()) {
+    if (!QFileInfo(Settings::instance()->importSettings().unrar()).isFile()) {
         emit sigError(baseName, tr("Unrar not found"));
         emit sigFinished(baseName, false);
         return;
     }
 
-    QString file = rarFiles.first();
-    QFileInfo fi(file);
+    mediaelch::ExtractionQueue::Job job;
+    job.name = baseName;
+    // Archives are extracted into their own directory.
+    job.device = mediaelch::FileCopier::device(rarFiles.first());
+    job.priority = priority;
+    job.size = size;
+    m_queue.setMaxParallelJobs(Settings::instance()->advanced()->parallelExtractions());
+    if (!m_queue.add(job)) {
+        qDebug() << "[Extractor] Package is already being extracted:" << baseName;
+        return;
+    }
+
+    m_archives.insert(baseName, {rarFiles.first(), password});
+    emit sigQueueProgress(m_queue.totalProgress());
+    startJobs();
+}
+
+void Extractor::setPriority(QString baseName, int priority)
+{
+    m_queue.setPriority(baseName, priority);
+}
+
+void Extractor::startJobs()
+{
+    for (const mediaelch::ExtractionQueue::Job& job : m_queue.takeStartableJobs()) {
+        startProcess(job.name, m_archives.value(job.name));
+    }
+}
+
+void Extractor::startProcess(const QString& baseName, const Archive& archive)
+{
+    QFileInfo fi(archive.file);
 
     QStringList parameters;
     parameters << "x"
                << "-o+"
                << "-y";
-    if (!password.isEmpty()) {
-        parameters << "-p" + password;
+    if (!archive.password.isEmpty()) {
+        parameters << "-p" + archive.password;
     }
-    parameters << file;
-    // parameters << fi.path();
+    parameters << archive.file;
 
+    qDebug() << "[Extractor] Start extracting" << baseName;
     auto process = new QProcess(this);
     m_processes.append(process);
     connect(process, &QProcess::readyReadStandardOutput, this, &Extractor::onReadyRead);
@@ -62,8 +93,27 @@ void Extractor::extract(QString baseName, QStringList files, QString password)
     process->setProperty("baseName", baseName);
     process->setProperty("hasError", false);
     process->setWorkingDirectory(fi.path());
-    process->start(unrar, parameters);
-    process->waitForStarted(10000);
+    process->start(Settings::instance()->importSettings().unrar(), parameters);
+    if (!process->waitForStarted(10000)) {
+        m_processes.removeAll(process);
+        process->disconnect(this);
+        process->deleteLater();
+        emit sigError(baseName, process->errorString());
+        jobFinished(baseName, false);
+    }
+}
+
+void Extractor::jobFinished(const QString& baseName, bool success)
+{
+    m_queue.finish(baseName);
+    m_archives.remove(baseName);
+    emit sigFinished(baseName, success);
+    emit sigQueueProgress(m_queue.totalProgress());
+
+    startJobs();
+    if (m_queue.isIdle()) {
+        emit sigQueueFinished();
+    }
 }
 
 void Extractor::onReadyRead()
@@ -72,7 +122,11 @@ void Extractor::onReadyRead()
     QString msg = process->readAllStandardOutput();
     QRegExp rx("([0-9]*)%");
     if (rx.indexIn(msg) != -1) {
-        emit sigProgress(process->property("baseName").toString(), rx.cap(1).toInt());
+        const QString baseName = process->property("baseName").toString();
+        const int progress = rx.cap(1).toInt();
+        m_queue.setProgress(baseName, progress);
+        emit sigProgress(baseName, progress);
+        emit sigQueueProgress(m_queue.totalProgress());
     }
 }
 
@@ -93,11 +147,20 @@ void Extractor::onFinished(int exitCode, QProcess::ExitStatus status)
     auto* process = dynamic_cast<QProcess*>(QObject::sender());
     m_processes.removeAll(process);
     process->deleteLater();
-    emit sigFinished(process->property("baseName").toString(), !process->property("hasError").toBool());
+    jobFinished(process->property("baseName").toString(), !process->property("hasError").toBool());
 }
 
 void Extractor::stopExtraction(QString baseName)
 {
+    if (m_queue.removePending(baseName)) {
+        m_archives.remove(baseName);
+        emit sigFinished(baseName, false);
+        emit sigQueueProgress(m_queue.totalProgress());
+        if (m_queue.isIdle()) {
+            emit sigQueueFinished();
+        }
+        return;
+    }
     for (QProcess* process : m_processes) {
         if (process->property("baseName").toString() == baseName) {
             process->setProperty("hasError", true);
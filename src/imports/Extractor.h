@@ -1,11 +1,16 @@
 #pragma once
 
+#include "imports/ExtractionQueue.h"
+
+#include <QHash>
 #include <QObject>
 #include <QProcess>
 #include <QString>
 #include <QStringList>
 #include <QVector>
 
+/// \brief Extracts downloaded archives with unrar.
+/// Extractions are queued; mediaelch::ExtractionQueue decides which run at the same time.
 class Extractor : public QObject
 {
     Q_OBJECT
@@ -14,13 +19,21 @@ public:
     ~Extractor() override;
 
 public slots:
-    void extract(QString baseName, QStringList files, QString password);
+    /// \brief Queues the extraction of the package. Packages with a higher priority are extracted first.
+    void extract(QString baseName, QStringList files, QString password, int priority = 0);
+    /// \brief Changes the priority of a package that is queued but not extracted yet.
+    void setPriority(QString baseName, int priority);
+    /// \brief Stops a running extraction or removes it from the queue.
     void stopExtraction(QString baseName);
 
 signals:
     void sigProgress(QString, int);
     void sigFinished(QString, bool);
     void sigError(QString, QString);
+    /// \brief Progress of all queued and running extractions in percent.
+    void sigQueueProgress(int);
+    /// \brief Emitted once all queued extractions are finished.
+    void sigQueueFinished();
 
 private slots:
     void onReadyRead();
@@ -28,5 +41,17 @@ private slots:
     void onFinished(int exitCode, QProcess::ExitStatus status);
 
 private:
+    struct Archive
+    {
+        QString file;
+        QString password;
+    };
+
+    void startJobs();
+    void startProcess(const QString& baseName, const Archive& archive);
+    void jobFinished(const QString& baseName, bool success);
+
     QVector<QProcess*> m_processes;
+    mediaelch::ExtractionQueue m_queue;
+    QHash<QString, Archive> m_archives;
 };
@@ -1,7 +1,15 @@
 #include "FileWorker.h"
 
+#include "file/FileCopier.h"
+
 #include <QDebug>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QPair>
+#include <QThreadPool>
+#include <QVector>
+#include <QtConcurrent/QtConcurrentRun>
 
 FileWorker::FileWorker(QObject* parent) : QObject(parent)
 {
@@ -17,24 +25,83 @@ QMap<QString, QString> FileWorker::files()
     return m_files;
 }
 
+void FileWorker::setVerifyCopies(bool verify)
+{
+    m_verifyCopies = verify;
+}
+
 void FileWorker::copyFiles()
 {
-    QMapIterator<QString, QString> it(files());
-    while (it.hasNext()) {
-        it.next();
-        MyFile file(it.key());
-        file.copy(it.value());
-    }
-    emit sigFinished();
+    transferFiles(false);
 }
 
 void FileWorker::moveFiles()
 {
-    QMapIterator<QString, QString> it(files());
+    transferFiles(true);
+}
+
+void FileWorker::transferFiles(bool move)
+{
+    using mediaelch::FileCopier;
+    using FileList = QVector<QPair<QString, QString>>;
+
+    m_bytesTotal = 0;
+    m_bytesDone = 0;
+    m_percentDone = 0;
+    for (const QString& source : m_files.keys()) {
+        m_bytesTotal += QFileInfo(source).size();
+    }
+
+    // Files are grouped by their source and target devices. Each group is copied in its own thread.
+    QMap<QString, FileList> groups;
+    QMapIterator<QString, QString> it(m_files);
     while (it.hasNext()) {
         it.next();
-        MyFile file(it.key());
-        file.rename(it.value());
+        if (QFileInfo::exists(it.value())) {
+            qWarning() << "[FileWorker] Target file already exists:" << it.value();
+            continue;
+        }
+        // Moving files on the same file system doesn't need to copy them.
+        if (move && QDir().rename(it.key(), it.value())) {
+            addProgress(QFileInfo(it.value()).size());
+            continue;
+        }
+        groups[FileCopier::device(it.key()) + "\n" + FileCopier::device(it.value())].append({it.key(), it.value()});
+    }
+
+    FileCopier::Options options;
+    options.verify = m_verifyCopies;
+    options.progress = [this](qint64 bytes) { addProgress(bytes); };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMax(1, groups.size()));
+    for (const FileList& group : groups) {
+        QtConcurrent::run(&pool, [group, options, move]() {
+            for (const auto& file : group) {
+                if (!FileCopier::copy(file.first, file.second, options)) {
+                    qWarning() << "[FileWorker] Could not copy" << file.first << "to" << file.second;
+                    continue;
+                }
+                if (move && !QFile::remove(file.first)) {
+                    qWarning() << "[FileWorker] Could not remove moved file:" << file.first;
+                }
+            }
+        });
     }
+    pool.waitForDone();
+
     emit sigFinished();
 }
+
+void FileWorker::addProgress(qint64 bytes)
+{
+    const qint64 done = (m_bytesDone += bytes);
+    if (m_bytesTotal <= 0) {
+        return;
+    }
+    // Only report full percents; copying large files would emit thousands of signals otherwise.
+    const int percent = static_cast<int>(done * 100 / m_bytesTotal);
+    if (m_percentDone.exchange(percent) != percent) {
+        emit sigProgress(done, m_bytesTotal);
+    }
+}
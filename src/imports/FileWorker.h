@@ -1,10 +1,14 @@
 #pragma once
 
-#include "imports/MyFile.h"
-
 #include <QMap>
 #include <QObject>
+#include <atomic>
 
+/// \brief Copies or moves the files of an import in a worker thread.
+///
+/// Files are copied with mediaelch::FileCopier. Files whose source and target
+/// devices differ from those of other files are copied in parallel, files on
+/// the same devices one after another.
 class FileWorker : public QObject
 {
     Q_OBJECT
@@ -12,14 +16,24 @@ public:
     explicit FileWorker(QObject* parent = nullptr);
     void setFiles(QMap<QString, QString> files);
     QMap<QString, QString> files();
+    /// \brief Compare checksums of copied files with their source files.
+    void setVerifyCopies(bool verify);
 
 public slots:
     void copyFiles();
     void moveFiles();
 
 signals:
+    void sigProgress(qint64 bytesDone, qint64 bytesTotal);
     void sigFinished();
 
 private:
+    void transferFiles(bool move);
+    void addProgress(qint64 bytes);
+
     QMap<QString, QString> m_files;
+    bool m_verifyCopies = false;
+    qint64 m_bytesTotal = 0;
+    std::atomic<qint64> m_bytesDone{0};
+    std::atomic<int> m_percentDone{0};
 };
@@ -0,0 +1,181 @@
+#include "log/AsyncLogWriter.h"
+
+#include <QFileDevice>
+#include <QIODevice>
+#include <QMutexLocker>
+#include <QThread>
+
+namespace mediaelch {
+
+namespace {
+
+/// The writer thread is woken up once this many messages are queued.
+constexpr int batchSize = 512;
+/// Queued messages are written at least this often (in milliseconds).
+constexpr unsigned long flushInterval = 200;
+/// Maximum time that flushNow() waits for the lock (in milliseconds).
+constexpr int crashLockTimeout = 100;
+
+bool isDroppable(QtMsgType type)
+{
+    return type == QtDebugMsg || type == QtInfoMsg;
+}
+
+} // namespace
+
+class AsyncLogWriter::WriterThread : public QThread
+{
+public:
+    explicit WriterThread(AsyncLogWriter& writer) : m_writer{writer} { setObjectName("AsyncLogWriter"); }
+
+protected:
+    void run() override { m_writer.run(); }
+
+private:
+    AsyncLogWriter& m_writer;
+};
+
+AsyncLogWriter::AsyncLogWriter(QIODevice& device, int capacity) :
+    m_device{device}, m_capacity{capacity}, m_thread{std::make_unique<WriterThread>(*this)}
+{
+    m_queue.reserve(batchSize);
+    m_thread->start(QThread::LowPriority);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    stop();
+}
+
+bool AsyncLogWriter::write(QtMsgType type, QString message)
+{
+    QMutexLocker lock(&m_mutex);
+    if (m_isStopping) {
+        return false;
+    }
+    if (m_queue.size() >= m_capacity && isDroppable(type)) {
+        ++m_droppedCount;
+        return true;
+    }
+    m_queue.append(std::move(message));
+    ++m_queuedCount;
+    // Warnings and errors are written promptly; they may be the last message before a crash.
+    if (m_queue.size() == batchSize || !isDroppable(type)) {
+        m_wakeWriter.wakeOne();
+    }
+    return true;
+}
+
+void AsyncLogWriter::flush()
+{
+    QMutexLocker lock(&m_mutex);
+    if (QThread::currentThread() == m_thread.get()) {
+        // Waiting for ourselves would deadlock.
+        QVector<QString> batch;
+        writeQueue(lock, batch);
+        return;
+    }
+    const quint64 target = m_queuedCount;
+    m_wakeWriter.wakeOne();
+    while (m_writtenCount < target) {
+        m_batchWritten.wait(&m_mutex);
+    }
+}
+
+void AsyncLogWriter::flushNow()
+{
+    if (!m_mutex.tryLock(crashLockTimeout)) {
+        return;
+    }
+    // The lock is kept while writing so that the writer thread can't start another batch.
+    QVector<QString> batch;
+    batch.swap(m_queue);
+    const quint64 dropped = m_droppedCount - m_reportedDropCount;
+    m_reportedDropCount = m_droppedCount;
+    if (!batch.isEmpty() || dropped > 0) {
+        writeBatch(batch, dropped);
+        m_writtenCount += static_cast<quint64>(batch.size());
+    }
+    m_batchWritten.wakeAll();
+    m_mutex.unlock();
+}
+
+void AsyncLogWriter::stop()
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        if (m_isStopping) {
+            return;
+        }
+        m_isStopping = true;
+        m_wakeWriter.wakeOne();
+    }
+    if (QThread::currentThread() != m_thread.get()) {
+        m_thread->wait();
+    }
+}
+
+quint64 AsyncLogWriter::droppedCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_droppedCount;
+}
+
+quint64 AsyncLogWriter::writtenCount() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_writtenCount;
+}
+
+void AsyncLogWriter::run()
+{
+    QVector<QString> batch;
+    batch.reserve(batchSize);
+
+    QMutexLocker lock(&m_mutex);
+    while (true) {
+        if (m_queue.isEmpty() && !m_isStopping) {
+            m_wakeWriter.wait(&m_mutex, flushInterval);
+        }
+        const bool isStopping = m_isStopping;
+        writeQueue(lock, batch);
+        if (isStopping && m_queue.isEmpty()) {
+            return;
+        }
+    }
+}
+
+void AsyncLogWriter::writeQueue(QMutexLocker& lock, QVector<QString>& batch)
+{
+    // Swapping keeps the critical section short: the batch is written without the lock.
+    batch.swap(m_queue);
+    const quint64 dropped = m_droppedCount - m_reportedDropCount;
+    m_reportedDropCount = m_droppedCount;
+
+    if (!batch.isEmpty() || dropped > 0) {
+        lock.unlock();
+        writeBatch(batch, dropped);
+        lock.relock();
+        m_writtenCount += static_cast<quint64>(batch.size());
+        batch.clear();
+    }
+    m_batchWritten.wakeAll();
+}
+
+void AsyncLogWriter::writeBatch(const QVector<QString>& batch, quint64 dropped)
+{
+    QString text;
+    if (dropped > 0) {
+        text += QStringLiteral("[Log] Dropped %1 debug and info messages because the log buffer was full\n").arg(dropped);
+    }
+    for (const QString& message : batch) {
+        text += message;
+    }
+    m_device.write(text.toUtf8());
+    // QFile buffers writes; flush so that the log is complete if MediaElch crashes afterwards.
+    if (auto* file = qobject_cast<QFileDevice*>(&m_device)) {
+        file->flush();
+    }
+}
+
+} // namespace mediaelch
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <QWaitCondition>
+#include <QtGlobal>
+#include <memory>
+
+class QIODevice;
+
+namespace mediaelch {
+
+/// \brief Writes log messages to a device in a dedicated thread.
+///
+/// write() only appends the already formatted message to an in-memory buffer,
+/// so logging threads never wait for file I/O. The writer thread takes the
+/// whole buffer at once and writes it in a single batch, either when enough
+/// messages were queued or after a short interval.
+///
+/// The buffer is bounded: if it is full, debug and info messages are dropped
+/// and counted; a note with the number of dropped messages is written with the
+/// next batch. Warnings and errors are never dropped.
+///
+/// All queued messages are written by flush(), stop() and when the writer is
+/// destroyed. flush() may also be called by the writer thread itself, e.g. for
+/// a fatal message caused by writing the log; the messages are then written
+/// synchronously.
+///
+/// \par Example
+/// \code{cpp}
+///   AsyncLogWriter writer(logFile);
+///   writer.write(QtDebugMsg, "Scanning /movies\n");
+///   writer.flush();
+/// \endcode
+class AsyncLogWriter
+{
+public:
+    /// \param device Open device that messages are written to. Must outlive the writer.
+    /// \param capacity Maximum number of queued debug and info messages.
+    explicit AsyncLogWriter(QIODevice& device, int capacity = 20000);
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(const AsyncLogWriter&) = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+    /// \brief Queues the message. Thread-safe; does not wait for I/O.
+    /// \return False if the writer is stopped and the message was not queued.
+    bool write(QtMsgType type, QString message);
+    /// \brief Blocks until all messages queued so far are written to the device.
+    void flush();
+    /// \brief Writes all queued messages in the calling thread without waiting for the writer thread.
+    /// Best effort for crash handlers: gives up if the lock can't be taken within a short time,
+    /// e.g. because the crashed thread holds it. Not async-signal-safe.
+    void flushNow();
+    /// \brief Writes all queued messages and stops the writer thread.
+    /// Further messages are rejected by write(), so the device may be closed afterwards.
+    void stop();
+
+    quint64 droppedCount() const;
+    quint64 writtenCount() const;
+
+private:
+    class WriterThread;
+
+    void run();
+    /// Writes and removes all queued messages. The lock is released while writing.
+    void writeQueue(QMutexLocker& lock, QVector<QString>& batch);
+    void writeBatch(const QVector<QString>& batch, quint64 dropped);
+
+    QIODevice& m_device;
+    const int m_capacity;
+
+    mutable QMutex m_mutex;
+    QWaitCondition m_wakeWriter;
+    QWaitCondition m_batchWritten;
+    QVector<QString> m_queue;
+    quint64 m_queuedCount = 0;
+    quint64 m_writtenCount = 0;
+    quint64 m_droppedCount = 0;
+    quint64 m_reportedDropCount = 0;
+    bool m_isStopping = false;
+
+    std::unique_ptr<WriterThread> m_thread;
+};
+
+} // namespace mediaelch
@@ -1,10 +1,19 @@
 #include "log/Log.h"
 
+#include "log/AsyncLogWriter.h"
 #include "settings/Settings.h"
 
 #include <QMessageBox>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <initializer_list>
 
 static QFile data;
+// Read by messageHandler() in all threads. Writers are stopped by closeLogFile() but never
+// destroyed, because another thread may still use the pointer.
+static std::atomic<mediaelch::AsyncLogWriter*> asyncWriter{nullptr};
 
 #if defined(Q_OS_MAC) || defined(Q_OS_LINUX)
 #    include <unistd.h>
@@ -37,6 +46,46 @@ static bool is_stderr_tty()
 #endif
 }
 
+static std::terminate_handler previousTerminateHandler = nullptr;
+
+/// Best effort: the writer thread may not get the chance to write the last messages.
+static void flushLogOnCrash()
+{
+    mediaelch::AsyncLogWriter* writer = asyncWriter.load();
+    if (writer != nullptr) {
+        writer->flushNow();
+    }
+}
+
+static void onTerminate()
+{
+    flushLogOnCrash();
+    if (previousTerminateHandler != nullptr) {
+        previousTerminateHandler();
+    }
+    std::abort();
+}
+
+static void onCrashSignal(int signalNumber)
+{
+    flushLogOnCrash();
+    // Crash with the default handler, e.g. so that a core dump is written.
+    std::signal(signalNumber, SIG_DFL);
+    std::raise(signalNumber);
+}
+
+static void installCrashHandlers()
+{
+    static bool isInstalled = false;
+    if (isInstalled) {
+        return;
+    }
+    isInstalled = true;
+    previousTerminateHandler = std::set_terminate(onTerminate);
+    for (int signalNumber : {SIGSEGV, SIGABRT, SIGFPE, SIGILL}) {
+        std::signal(signalNumber, onCrashSignal);
+    }
+}
 
 namespace mediaelch {
 
@@ -83,12 +132,20 @@ void messageHandler(QtMsgType type, const QMessageLogContext& context, const QSt
     const QString newLine = "\n";
 #endif
 
-    QTextStream out(stderr);
-    if (data.isOpen()) {
-        out.setDevice(&data);
-    }
+    // Formatting must happen here, e.g. for the time stamp, but the file is written by another thread.
+    const QString message = qFormatLogMessage(type, context, msg) + newLine;
+    AsyncLogWriter* writer = asyncWriter.load();
+    if (writer != nullptr && writer->write(type, message)) {
+        if (type == QtFatalMsg) {
+            // Also safe in the writer thread: the remaining messages are then written synchronously.
+            writer->flush();
+        }
 
-    out << qFormatLogMessage(type, context, msg) << newLine;
+    } else {
+        // No log file or it was closed in the meantime.
+        QTextStream out(stderr);
+        out << message;
+    }
 
     if (type == QtFatalMsg) {
         abort();
@@ -101,13 +158,25 @@ bool openLogFile(const QString& filePath)
         return true;
     }
 
+    closeLogFile();
     data.setFileName(filePath);
-
-    return data.open(QFile::WriteOnly | QFile::Truncate);
+    if (!data.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+    // The previous writer, if any, is stopped and intentionally leaked, see asyncWriter.
+    asyncWriter.store(new AsyncLogWriter(data));
+    installCrashHandlers();
+    return true;
 }
 
 void closeLogFile()
 {
+    // Writes all remaining messages and stops the writer thread. Messages that are
+    // logged afterwards go to stderr.
+    AsyncLogWriter* writer = asyncWriter.load();
+    if (writer != nullptr) {
+        writer->stop();
+    }
     if (data.isOpen()) {
         data.close();
     }
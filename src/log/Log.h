@@ -17,6 +17,11 @@ void initLoggingPattern();
 /// messages are redirected to that.  Otherwise stderr is used.
 /// Repects QT_MESSAGE_PATTERN.
 ///
+/// The log file is written by a background thread, see AsyncLogWriter.
+/// Fatal messages are written before the application aborts. On crashes, i.e.
+/// std::terminate() or signals like SIGSEGV, queued messages are written on a
+/// best-effort basis, see AsyncLogWriter::flushNow().
+///
 /// \see initLoggingPattern()
 void messageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg);
 
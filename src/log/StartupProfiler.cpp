@@ -0,0 +1,51 @@
+#include "log/StartupProfiler.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+namespace mediaelch {
+
+namespace {
+
+bool s_enabled = false;
+QElapsedTimer s_startTimer;
+qint64 s_lastMark = 0;
+
+} // namespace
+
+void StartupProfiler::enable()
+{
+    s_enabled = true;
+    s_startTimer.start();
+    s_lastMark = 0;
+    qInfo() << "[StartupProfiler] Profiling startup";
+}
+
+bool StartupProfiler::isEnabled()
+{
+    return s_enabled;
+}
+
+void StartupProfiler::mark(const char* phase)
+{
+    if (!s_enabled) {
+        return;
+    }
+    const qint64 elapsed = s_startTimer.elapsed();
+    qInfo().noquote() << QStringLiteral("[StartupProfiler] %1 ms (at %2 ms): %3")
+                             .arg(elapsed - s_lastMark, 5)
+                             .arg(elapsed, 5)
+                             .arg(QString::fromUtf8(phase));
+    s_lastMark = elapsed;
+}
+
+void StartupProfiler::finish()
+{
+    if (!s_enabled) {
+        return;
+    }
+    qInfo() << "[StartupProfiler] Startup took" << s_startTimer.elapsed() << "ms";
+    s_enabled = false;
+}
+
+} // namespace mediaelch
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace mediaelch {
+
+/// \brief Logs how long each phase of MediaElch's startup takes.
+///
+/// Enabled by the command line option "--profile-startup". Each call to
+/// mark() logs the time since the previous mark and since the profiler was
+/// enabled. If the profiler is disabled, mark() does nothing.
+///
+/// \par Example
+/// \code{cpp}
+///   StartupProfiler::mark("Load settings");
+/// \endcode
+class StartupProfiler
+{
+public:
+    /// \brief Enables the profiler and starts measuring.
+    static void enable();
+    static bool isEnabled();
+
+    /// \brief Logs the duration of the phase that ended just now.
+    static void mark(const char* phase);
+    /// \brief Logs the total startup time and disables the profiler.
+    static void finish();
+};
+
+} // namespace mediaelch
@@ -0,0 +1,165 @@
+#include "log/Tracer.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <vector>
+
+namespace mediaelch {
+
+std::atomic<bool> Tracer::s_isEnabled{false};
+
+namespace {
+
+struct TraceEvent
+{
+    const char* category;
+    const char* name;
+    qint64 start;
+    qint64 duration;
+    int threadId;
+    QString detail;
+};
+
+struct TraceState
+{
+    QMutex mutex;
+    QElapsedTimer timer;
+    QString filePath;
+    std::vector<TraceEvent> events;
+    /// Thread names by trace thread id.
+    QHash<int, QString> threadNames;
+    int nextThreadId = 1;
+};
+
+TraceState& state()
+{
+    static TraceState s;
+    return s;
+}
+
+/// Small and stable thread ids are easier to read in trace viewers than native handles.
+/// Must be called with the state's mutex locked.
+int currentThreadId(TraceState& s)
+{
+    thread_local int id = 0;
+    if (id == 0) {
+        id = s.nextThreadId++;
+        QThread* thread = QThread::currentThread();
+        QString name = thread != nullptr ? thread->objectName() : QString();
+        if (QCoreApplication::instance() != nullptr && thread == QCoreApplication::instance()->thread()) {
+            name = QStringLiteral("Main");
+        } else if (name.isEmpty()) {
+            name = QStringLiteral("Thread %1").arg(id);
+        }
+        s.threadNames.insert(id, name);
+    }
+    return id;
+}
+
+QByteArray toJson(const QJsonObject& object)
+{
+    return QJsonDocument(object).toJson(QJsonDocument::Compact);
+}
+
+} // namespace
+
+bool Tracer::start(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCritical() << "[Tracer] Cannot write trace file:" << filePath;
+        return false;
+    }
+    file.close();
+
+    TraceState& s = state();
+    QMutexLocker lock(&s.mutex);
+    s.filePath = filePath;
+    s.events.clear();
+    s.timer.start();
+    s_isEnabled = true;
+    qInfo() << "[Tracer] Recording trace to" << filePath;
+    return true;
+}
+
+bool Tracer::stop()
+{
+    if (!isEnabled()) {
+        return false;
+    }
+    s_isEnabled = false;
+
+    TraceState& s = state();
+    QMutexLocker lock(&s.mutex);
+    std::vector<TraceEvent> events;
+    events.swap(s.events);
+
+    QFile file(s.filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCritical() << "[Tracer] Cannot write trace file:" << s.filePath;
+        return false;
+    }
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    bool isFirst = true;
+    const auto writeEvent = [&](const QJsonObject& event) {
+        if (!isFirst) {
+            file.write(",\n");
+        }
+        file.write(toJson(event));
+        isFirst = false;
+    };
+
+    for (auto it = s.threadNames.cbegin(); it != s.threadNames.cend(); ++it) {
+        writeEvent({{"name", "thread_name"},
+            {"ph", "M"},
+            {"pid", pid},
+            {"tid", it.key()},
+            {"args", QJsonObject{{"name", it.value()}}}});
+    }
+    for (const TraceEvent& event : events) {
+        QJsonObject object{{"name", event.name},
+            {"cat", event.category},
+            {"ph", "X"},
+            {"ts", event.start},
+            {"dur", event.duration},
+            {"pid", pid},
+            {"tid", event.threadId}};
+        if (!event.detail.isEmpty()) {
+            object.insert("args", QJsonObject{{"detail", event.detail}});
+        }
+        writeEvent(object);
+    }
+    file.write("\n]}\n");
+
+    qInfo() << "[Tracer] Wrote" << events.size() << "events to" << s.filePath;
+    return file.error() == QFileDevice::NoError;
+}
+
+qint64 Tracer::now()
+{
+    return state().timer.nsecsElapsed() / 1000;
+}
+
+void Tracer::addSpan(const char* category, const char* name, qint64 startTime, const QString& detail)
+{
+    if (!isEnabled()) {
+        return;
+    }
+    const qint64 end = now();
+    TraceState& s = state();
+    QMutexLocker lock(&s.mutex);
+    s.events.push_back(TraceEvent{category, name, startTime, end - startTime, currentThreadId(s), detail});
+}
+
+} // namespace mediaelch
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+namespace mediaelch {
+
+/// \brief Records timed spans and writes them as Chrome trace-event JSON.
+///
+/// Enabled by the command line option "--trace=<file>" of MediaElch and
+/// mediaelch-cli. The resulting file can be opened in chrome://tracing or
+/// https://ui.perfetto.dev and shows where the time of a session went,
+/// per thread.
+///
+/// Spans are recorded with TraceSpan or the ELCH_TRACE_SCOPE macro. If the
+/// tracer is disabled, a span only costs a check of an atomic flag.
+/// Category and name must be string literals: they are stored as pointers.
+///
+/// \par Example
+/// \code{cpp}
+///   Tracer::start("/tmp/mediaelch-trace.json");
+///   {
+///       ELCH_TRACE_SCOPE("nfo", "Load movie NFO", nfoFile);
+///       // ...
+///   }
+///   Tracer::stop();
+/// \endcode
+class Tracer
+{
+public:
+    /// \brief Starts recording. The trace is written to the given file by stop().
+    /// \return False if the file is not writable.
+    static bool start(const QString& filePath);
+    /// \brief Stops recording and writes all recorded events.
+    /// \return False if the trace could not be written or the tracer is not enabled.
+    static bool stop();
+
+    static bool isEnabled() { return s_isEnabled.load(std::memory_order_relaxed); }
+
+    /// \brief Microseconds since start() was called.
+    static qint64 now();
+    /// \brief Records a span that started at startTime (see now()) and ends now.
+    /// Useful for asynchronous operations, e.g. network requests.
+    static void addSpan(const char* category, const char* name, qint64 startTime, const QString& detail = QString());
+
+private:
+    static std::atomic<bool> s_isEnabled;
+};
+
+/// \brief Records the time from its construction until its destruction, see Tracer.
+class TraceSpan
+{
+public:
+    TraceSpan(const char* category, const char* name) : m_category{category}, m_name{name}
+    {
+        if (Tracer::isEnabled()) {
+            m_start = Tracer::now();
+        }
+    }
+
+    /// \brief Span with additional details, e.g. a file path, shown as argument in trace viewers.
+    /// detailFn returns the details as QString and is only called if the tracer is enabled.
+    template<typename DetailFn>
+    TraceSpan(const char* category, const char* name, DetailFn detailFn) : TraceSpan(category, name)
+    {
+        if (m_start >= 0) {
+            m_detail = detailFn();
+        }
+    }
+
+    ~TraceSpan()
+    {
+        if (m_start >= 0) {
+            Tracer::addSpan(m_category, m_name, m_start, m_detail);
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* m_category;
+    const char* m_name;
+    qint64 m_start = -1;
+    QString m_detail;
+};
+
+} // namespace mediaelch
+
+#define ELCH_TRACE_CONCAT_IMPL(a, b) a##b
+#define ELCH_TRACE_CONCAT(a, b) ELCH_TRACE_CONCAT_IMPL(a, b)
+#define ELCH_TRACE_EXPAND(x) x
+#define ELCH_TRACE_SELECT(_1, _2, _3, macro, ...) macro
+#define ELCH_TRACE_SCOPE_2(category, name)                                                                            \
+    const ::mediaelch::TraceSpan ELCH_TRACE_CONCAT(elchTraceSpan, __LINE__)(category, name)
+#define ELCH_TRACE_SCOPE_3(category, name, detail)                                                                    \
+    const ::mediaelch::TraceSpan ELCH_TRACE_CONCAT(elchTraceSpan, __LINE__)(                                         \
+        category, name, [&]() -> QString { return detail; })
+/// \brief Traces the current scope: ELCH_TRACE_SCOPE(category, name [, detail])
+/// The detail expression is only evaluated if the tracer is enabled.
+#define ELCH_TRACE_SCOPE(...)                                                                                          \
+    ELCH_TRACE_EXPAND(ELCH_TRACE_SELECT(__VA_ARGS__, ELCH_TRACE_SCOPE_3, ELCH_TRACE_SCOPE_2, )(__VA_ARGS__))
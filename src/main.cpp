@@ -11,6 +11,8 @@
 
 #include "Version.h"
 #include "log/Log.h"
+#include "log/StartupProfiler.h"
+#include "log/Tracer.h"
 #include "settings/Settings.h"
 #include "ui/main/MainWindow.h"
 
@@ -29,6 +31,31 @@ static void initLogFile()
         QObject::tr("The logfile %1 could not be openend for writing.").arg(logFile));
 }
 
+static void initTracing()
+{
+    // Accepts "--trace <file>" and "--trace=<file>" like mediaelch-cli. QCommandLineParser is not used
+    // because it would reject arguments that are handled by Qt itself, e.g. "-style".
+    const QStringList arguments = QCoreApplication::arguments();
+    const QString option = QStringLiteral("--trace");
+    for (int i = 1; i < arguments.size(); ++i) {
+        const QString& argument = arguments.at(i);
+        QString filePath;
+        if (argument == option) {
+            filePath = (i + 1 < arguments.size()) ? arguments.at(i + 1) : QString();
+        } else if (argument.startsWith(option + '=')) {
+            filePath = argument.mid(option.length() + 1);
+        } else {
+            continue;
+        }
+        if (filePath.isEmpty()) {
+            qCritical() << "[Tracer] Missing file path for --trace";
+        } else {
+            mediaelch::Tracer::start(filePath);
+        }
+        return;
+    }
+}
+
 static void loadStylesheet(QApplication& app)
 {
     QFile file(":/src/ui/default.css");
@@ -61,6 +88,11 @@ int main(int argc, char* argv[])
 {
     QApplication app(argc, argv);
 
+    if (QCoreApplication::arguments().contains(QStringLiteral("--profile-startup"))) {
+        mediaelch::StartupProfiler::enable();
+    }
+    initTracing();
+
     QCoreApplication::setOrganizationName(mediaelch::constants::OrganizationName);
     QCoreApplication::setApplicationName(mediaelch::constants::AppName);
     QCoreApplication::setApplicationVersion(mediaelch::constants::AppVersionFullStr);
@@ -77,21 +109,30 @@ int main(int argc, char* argv[])
     // "Manager" which instantiates all scrapers which themself add their settings
     // with translated values to the settings dialog.
     qInstallMessageHandler(mediaelch::messageHandler);
+    mediaelch::StartupProfiler::mark("Create settings and scrapers");
 
     // MediaElch localization
     setupTranslation(QLatin1String("qt"));
     setupTranslation(QLatin1String("MediaElch"));
+    mediaelch::StartupProfiler::mark("Load translations");
 
     // Load the system's settings, e.g. window position, etc.
     Settings::instance()->loadSettings();
+    mediaelch::StartupProfiler::mark("Load settings");
 
     initLogFile();
     loadStylesheet(app);
+    mediaelch::StartupProfiler::mark("Load stylesheet");
 
     MainWindow window;
     window.show();
+    mediaelch::StartupProfiler::mark("Show main window");
+    // Called once the event loop runs, i.e. the first frame was painted.
+    QTimer::singleShot(0, []() { mediaelch::StartupProfiler::finish(); });
+
     int ret = QApplication::exec();
 
+    mediaelch::Tracer::stop();
     mediaelch::closeLogFile();
 
     return ret;
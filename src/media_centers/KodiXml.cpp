@@ -1,9 +1,12 @@
 #include "KodiXml.h"
 
+#include "file/DirectoryListingCache.h"
+#include "file/FileWriteBatch.h"
 #include "globals/Globals.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "image/Image.h"
+#include "log/Tracer.h"
 #include "media_centers/kodi/AlbumXmlReader.h"
 #include "media_centers/kodi/AlbumXmlWriter.h"
 #include "media_centers/kodi/ArtistXmlReader.h"
@@ -42,9 +45,38 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QXmlStreamWriter>
+#include <algorithm>
 #include <array>
 #include <memory>
 
+namespace {
+
+/// Returns the first "fanartN.jpg" in the directory that is not used (and won't be used by the batch).
+QString extraFanartFilePath(const QDir& dir, const mediaelch::FileWriteBatch& batch)
+{
+    int num = 1;
+    while (!batch.isPathFree(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num))) {
+        ++num;
+    }
+    return dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num);
+}
+
+bool isAnyWriteSuccessful(const QVector<mediaelch::FileWriteBatch::Result>& results, const QVector<int>& writes)
+{
+    return std::any_of(writes.cbegin(), writes.cend(), [&results](int write) {
+        return mediaelch::FileWriteBatch::succeeded(results.at(write));
+    });
+}
+
+bool areAllWritesSuccessful(const QVector<mediaelch::FileWriteBatch::Result>& results, const QVector<int>& writes)
+{
+    return std::all_of(writes.cbegin(), writes.cend(), [&results](int write) {
+        return mediaelch::FileWriteBatch::succeeded(results.at(write));
+    });
+}
+
+} // namespace
+
 KodiXml::KodiXml(QObject* parent)
 {
     setParent(parent);
@@ -89,41 +121,48 @@ QByteArray KodiXml::getMovieXml(Movie* movie)
 bool KodiXml::saveMovie(Movie* movie)
 {
     qDebug() << "Save movie as Kodi NFO file; movie: " << movie->name();
-    QByteArray xmlContent = getMovieXml(movie);
-
     if (movie->files().isEmpty()) {
         qWarning() << "Movie has no files";
         return false;
     }
 
+    const mediaelch::FileWriteBatch batch = movieFileWrites(movie, movieNfoContent(movie));
+    if (!finishMovieSave(movie, batch, batch.executeAsync().result())) {
+        return false;
+    }
+
+    Manager::instance()->database()->update(movie);
+    return true;
+}
+
+QByteArray KodiXml::movieNfoContent(Movie* movie)
+{
+    return getMovieXml(movie);
+}
+
+mediaelch::FileWriteBatch KodiXml::movieFileWrites(Movie* movie, const QByteArray& xmlContent)
+{
+    mediaelch::FileWriteBatch batch;
+    if (movie->files().isEmpty()) {
+        qWarning() << "Movie has no files";
+        return batch;
+    }
+
     movie->setNfoContent(xmlContent);
 
-    bool saved = false;
     QFileInfo fi(movie->files().first().toString());
     for (auto dataFile : Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
         QString saveFileName = dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, movie->files().count() > 1);
         QString saveFilePath = fi.absolutePath() + "/" + saveFileName;
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        qDebug() << "Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "File could not be openend";
-        } else {
-            file.write(xmlContent);
-            file.close();
-            saved = true;
-        }
-    }
-    if (!saved) {
-        return false;
+        qDebug() << "Saving to" << saveFilePath;
+        batch.writeTextFile(saveFilePath, xmlContent);
     }
 
     for (const auto imageType : Movie::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (movie->images().imageHasChanged(imageType) && !movie->images().image(imageType).isNull()) {
+        const QByteArray image =
+            movie->images().imageHasChanged(imageType) ? movie->images().image(imageType) : QByteArray();
+        if (!image.isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, movie->files().count() > 1);
@@ -135,7 +174,7 @@ bool KodiXml::saveMovie(Movie* movie)
                     && (movie->discType() == DiscType::BluRay || movie->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                saveFile(getPath(movie).filePath(saveFileName), movie->images().image(imageType));
+                batch.writeFile(getPath(movie).filePath(saveFileName), image);
             }
         }
 
@@ -151,38 +190,50 @@ bool KodiXml::saveMovie(Movie* movie)
                     && (movie->discType() == DiscType::BluRay || movie->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                QFile(getPath(movie).filePath(saveFileName)).remove();
+                batch.removeFile(getPath(movie).filePath(saveFileName));
             }
         }
     }
 
     if (movie->inSeparateFolder() && !movie->files().isEmpty()) {
         for (const QString& file : movie->images().extraFanartsToRemove()) {
-            QFile::remove(file);
+            batch.removeFile(file);
         }
         QDir dir(movie->files().first().dir().toString() + "/extrafanart");
-        if (!dir.exists() && !movie->images().extraFanartToAdd().isEmpty()) {
-            QDir(movie->files().first().dir().toString()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : movie->images().extraFanartToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists()) {
-                ++num;
-            }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            batch.writeFile(extraFanartFilePath(dir, batch), img);
         }
     }
 
     for (const Actor* actor : movie->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(fi.absolutePath() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            batch.writeFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image.data());
+        }
+    }
+
+    return batch;
+}
+
+bool KodiXml::finishMovieSave(Movie* movie,
+    const mediaelch::FileWriteBatch& batch,
+    const QVector<mediaelch::FileWriteBatch::Result>& results)
+{
+    // The NFO files are the batch's only text files.
+    bool nfoWritten = false;
+    for (int i = 0; i < batch.operations().size() && i < results.size(); ++i) {
+        if (batch.operations().at(i).text && mediaelch::FileWriteBatch::succeeded(results.at(i))) {
+            nfoWritten = true;
+            break;
         }
     }
+    if (!nfoWritten) {
+        qWarning() << "NFO file could not be written";
+        return false;
+    }
 
+    QFileInfo fi(movie->files().first().toString());
     for (Subtitle* subtitle : movie->subtitles()) {
         if (subtitle->changed()) {
             QString subFileName = fi.completeBaseName();
@@ -210,8 +261,6 @@ bool KodiXml::saveMovie(Movie* movie)
         }
     }
 
-    Manager::instance()->database()->update(movie);
-
     return true;
 }
 
@@ -228,15 +277,14 @@ QString KodiXml::nfoFilePath(Movie* movie)
         return nfoFile;
     }
     QFileInfo fi(movie->files().first().toString());
-    if (!fi.isFile()) {
+    if (!mediaelch::DirectoryListingCache::isFile(fi.filePath())) {
         qWarning() << "First file of the movie is not readable" << movie->files().at(0);
         return nfoFile;
     }
 
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::MovieNfo)) {
         QString file = dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, movie->files().count() > 1);
-        QFileInfo nfoFi(fi.absolutePath() + "/" + file);
-        if (nfoFi.exists()) {
+        if (mediaelch::DirectoryListingCache::isFile(fi.absolutePath() + "/" + file)) {
             nfoFile = fi.absolutePath() + "/" + file;
             break;
         }
@@ -326,6 +374,7 @@ QString KodiXml::nfoFilePath(Concert* concert)
  */
 bool KodiXml::loadMovie(Movie* movie, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load movie NFO");
     movie->clear();
     movie->setChanged(false);
 
@@ -657,33 +706,21 @@ bool KodiXml::saveConcert(Concert* concert)
     concert->setNfoContent(xmlContent);
     Manager::instance()->database()->update(concert);
 
-    bool saved = false;
+    mediaelch::FileWriteBatch batch;
+    QVector<int> nfoWrites;
     QFileInfo fi(concert->files().first().toString());
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::ConcertNfo)) {
         QString saveFileName =
             dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, concert->files().size() > 1);
         QString saveFilePath = mediaelch::DirectoryPath(fi.absolutePath()).filePath(saveFileName);
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        qDebug() << "[KodiXml] Saving to" << file.fileName();
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "[KodiXml] File could not be openend";
-        } else {
-            file.write(xmlContent);
-            file.close();
-            saved = true;
-        }
-    }
-    if (!saved) {
-        return false;
+        qDebug() << "[KodiXml] Saving to" << saveFilePath;
+        nfoWrites << batch.writeTextFile(saveFilePath, xmlContent);
     }
 
     for (const auto imageType : Concert::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (concert->imageHasChanged(imageType) && !concert->image(imageType).isNull()) {
+        const QByteArray image = concert->imageHasChanged(imageType) ? concert->image(imageType) : QByteArray();
+        if (!image.isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, concert->files().size() > 1);
@@ -695,7 +732,7 @@ bool KodiXml::saveConcert(Concert* concert)
                     && (concert->discType() == DiscType::BluRay || concert->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                saveFile(getPath(concert).filePath(saveFileName), concert->image(imageType));
+                batch.writeFile(getPath(concert).filePath(saveFileName), image);
             }
         }
         if (concert->imagesToRemove().contains(imageType)) {
@@ -710,28 +747,25 @@ bool KodiXml::saveConcert(Concert* concert)
                     && (concert->discType() == DiscType::BluRay || concert->discType() == DiscType::Dvd)) {
                     saveFileName = "fanart.jpg";
                 }
-                QFile(getPath(concert).filePath(saveFileName)).remove();
+                batch.removeFile(getPath(concert).filePath(saveFileName));
             }
         }
     }
 
     if (concert->inSeparateFolder() && !concert->files().isEmpty()) {
         for (const QString& file : concert->extraFanartsToRemove()) {
-            QFile::remove(file);
+            batch.removeFile(file);
         }
         QDir dir(QFileInfo(concert->files().first().toString()).absolutePath() + "/extrafanart");
-        if (!dir.exists() && !concert->extraFanartImagesToAdd().isEmpty()) {
-            QDir(QFileInfo(concert->files().first().toString()).absolutePath()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : concert->extraFanartImagesToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists()) {
-                ++num;
-            }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            batch.writeFile(extraFanartFilePath(dir, batch), img);
         }
     }
 
+    if (!isAnyWriteSuccessful(batch.executeAsync().result(), nfoWrites)) {
+        qWarning() << "[KodiXml] NFO file could not be written";
+        return false;
+    }
     return true;
 }
 
@@ -742,6 +776,7 @@ bool KodiXml::saveConcert(Concert* concert)
  */
 bool KodiXml::loadConcert(Concert* concert, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load concert NFO");
     concert->clear();
     concert->setChanged(false);
 
@@ -825,6 +860,7 @@ QString KodiXml::actorImageName(TvShowEpisode* episode, Actor actor)
  */
 bool KodiXml::loadTvShow(TvShow* show, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load TV show NFO");
     show->clear();
     show->setChanged(false);
 
@@ -871,6 +907,7 @@ bool KodiXml::loadTvShow(TvShow* show, QString initialNfoContent)
  */
 bool KodiXml::loadTvShowEpisode(TvShowEpisode* episode, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load episode NFO");
     if (episode == nullptr) {
         qWarning() << "[KodiXml] Passed an empty (null) episode to loadTvShowEpisode";
         return false;
@@ -959,33 +996,25 @@ bool KodiXml::saveTvShow(TvShow* show)
     show->setNfoContent(xmlContent);
     Manager::instance()->database()->update(show);
 
+    mediaelch::FileWriteBatch batch;
+    QVector<int> nfoWrites;
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowNfo)) {
-        QString saveFilePath = show->dir().filePath(dataFile.saveFileName(""));
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "[KodiXml] Nfo file could not be openend for writing" << file.fileName();
-            return false;
-        }
-        file.write(xmlContent);
-        file.close();
+        nfoWrites << batch.writeTextFile(show->dir().filePath(dataFile.saveFileName("")), xmlContent);
     }
 
     for (const auto imageType : TvShow::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
-        if (show->imageHasChanged(imageType) && !show->image(imageType).isNull()) {
+        const QByteArray image = show->imageHasChanged(imageType) ? show->image(imageType) : QByteArray();
+        if (!image.isNull()) {
             for (auto dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName("");
-                saveFile(show->dir().filePath(saveFileName), show->image(imageType));
+                batch.writeFile(show->dir().filePath(saveFileName), image);
             }
         }
         if (show->imagesToRemove().contains(imageType)) {
             for (auto dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName("");
-                QFile(show->dir().filePath(saveFileName)).remove();
+                batch.removeFile(show->dir().filePath(saveFileName));
             }
         }
     }
@@ -993,17 +1022,19 @@ bool KodiXml::saveTvShow(TvShow* show)
     for (const auto imageType : TvShow::seasonImageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
         for (const SeasonNumber& season : show->seasons()) {
-            if (show->seasonImageHasChanged(season, imageType) && !show->seasonImage(season, imageType).isNull()) {
+            const QByteArray image =
+                show->seasonImageHasChanged(season, imageType) ? show->seasonImage(season, imageType) : QByteArray();
+            if (!image.isNull()) {
                 for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    saveFile(show->dir().filePath(saveFileName), show->seasonImage(season, imageType));
+                    batch.writeFile(show->dir().filePath(saveFileName), image);
                 }
             }
             if (show->imagesToRemove().contains(imageType)
                 && show->imagesToRemove().value(imageType).contains(season)) {
                 for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                     QString saveFileName = dataFile.saveFileName("", season);
-                    QFile(show->dir().filePath(saveFileName)).remove();
+                    batch.removeFile(show->dir().filePath(saveFileName));
                 }
             }
         }
@@ -1011,31 +1042,26 @@ bool KodiXml::saveTvShow(TvShow* show)
 
     if (show->dir().isValid()) {
         for (const QString& file : show->extraFanartsToRemove()) {
-            QFile::remove(file);
+            batch.removeFile(file);
         }
         QDir dir(show->dir().toString() + "/extrafanart");
-        if (!dir.exists() && !show->extraFanartImagesToAdd().isEmpty()) {
-            QDir(show->dir().toString()).mkdir("extrafanart");
-        }
         for (const QByteArray& img : show->extraFanartImagesToAdd()) {
-            int num = 1;
-            while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists()) {
-                ++num;
-            }
-            saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+            batch.writeFile(extraFanartFilePath(dir, batch), img);
         }
     }
 
     for (const Actor* actor : show->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(show->dir().toString() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(show->dir().toString() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            batch.writeFile(show->dir().toString() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image.data());
         }
     }
 
+    if (!areAllWritesSuccessful(batch.executeAsync().result(), nfoWrites)) {
+        qWarning() << "[KodiXml] Nfo file could not be written for TV show" << show->title();
+        return false;
+    }
     return true;
 }
 
@@ -1070,37 +1096,29 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
         Manager::instance()->database()->update(subEpisode);
     }
 
+    mediaelch::FileWriteBatch batch;
+    QVector<int> nfoWrites;
     QFileInfo fi(episode->files().first().toString());
     for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowEpisodeNfo)) {
         QString saveFileName =
             dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
-        QString saveFilePath = fi.absolutePath() + "/" + saveFileName;
-        QDir saveFileDir = QFileInfo(saveFilePath).dir();
-        if (!saveFileDir.exists()) {
-            saveFileDir.mkpath(".");
-        }
-        QFile file(saveFilePath);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "[KodiXml] Nfo file could not be opened for writing" << saveFileName;
-            return false;
-        }
-        file.write(xmlContent);
-        file.close();
+        nfoWrites << batch.writeTextFile(fi.absolutePath() + "/" + saveFileName, xmlContent);
     }
 
     fi.setFile(episode->files().first().toString());
-    if (episode->thumbnailImageChanged() && !episode->thumbnailImage().isNull()) {
+    const QByteArray thumbnail = episode->thumbnailImageChanged() ? episode->thumbnailImage() : QByteArray();
+    if (!thumbnail.isNull()) {
         if (helper::isBluRay(episode->files().at(0)) || helper::isDvd(episode->files().first())) {
             QDir dir = fi.dir();
             dir.cdUp();
-            saveFile(dir.absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            batch.writeFile(dir.absolutePath() + "/thumb.jpg", thumbnail);
         } else if (helper::isDvd(episode->files().first(), true)) {
-            saveFile(fi.dir().absolutePath() + "/thumb.jpg", episode->thumbnailImage());
+            batch.writeFile(fi.dir().absolutePath() + "/thumb.jpg", thumbnail);
         } else {
             for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
-                saveFile(fi.absolutePath() + "/" + saveFileName, episode->thumbnailImage());
+                batch.writeFile(fi.absolutePath() + "/" + saveFileName, thumbnail);
             }
         }
     }
@@ -1110,14 +1128,14 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
         if (helper::isBluRay(episode->files().first()) || helper::isDvd(episode->files().at(0))) {
             QDir dir = fi.dir();
             dir.cdUp();
-            QFile(dir.absolutePath() + "/thumb.jpg").remove();
+            batch.removeFile(dir.absolutePath() + "/thumb.jpg");
         } else if (helper::isDvd(episode->files().first(), true)) {
-            QFile(fi.dir().absolutePath() + "/thumb.jpg").remove();
+            batch.removeFile(fi.dir().absolutePath() + "/thumb.jpg");
         } else {
             for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::TvShowEpisodeThumb)) {
                 QString saveFileName =
                     dataFile.saveFileName(fi.fileName(), SeasonNumber::NoSeason, episode->files().count() > 1);
-                QFile(fi.absolutePath() + "/" + saveFileName).remove();
+                batch.removeFile(fi.absolutePath() + "/" + saveFileName);
             }
         }
     }
@@ -1125,14 +1143,16 @@ bool KodiXml::saveTvShowEpisode(TvShowEpisode* episode)
     fi.setFile(episode->files().first().toString());
     for (const Actor* actor : episode->actors()) {
         if (!actor->image.isNull()) {
-            QDir dir;
-            dir.mkdir(fi.absolutePath() + "/" + ".actors");
             QString actorName = actor->name;
             actorName = actorName.replace(" ", "_");
-            saveFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image);
+            batch.writeFile(fi.absolutePath() + "/" + ".actors" + "/" + actorName + ".jpg", actor->image.data());
         }
     }
 
+    if (!areAllWritesSuccessful(batch.executeAsync().result(), nfoWrites)) {
+        qWarning() << "[KodiXml] Nfo file could not be written for episode" << episode->title();
+        return false;
+    }
     return true;
 }
 
@@ -1247,12 +1267,7 @@ QImage KodiXml::movieSetBackdrop(QString setName)
  */
 void KodiXml::saveMovieSetPoster(QString setName, QImage poster)
 {
-    for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::MovieSetPoster)) {
-        QString fileName = movieSetFileName(setName, &dataFile);
-        if (!fileName.isEmpty()) {
-            poster.save(fileName, "jpg", 100);
-        }
-    }
+    saveMovieSetImage(setName, poster, DataFileType::MovieSetPoster);
 }
 
 /**
@@ -1260,28 +1275,24 @@ void KodiXml::saveMovieSetPoster(QString setName, QImage poster)
  */
 void KodiXml::saveMovieSetBackdrop(QString setName, QImage backdrop)
 {
-    for (DataFile dataFile : Settings::instance()->dataFiles(DataFileType::MovieSetBackdrop)) {
-        QString fileName = movieSetFileName(setName, &dataFile);
-        if (!fileName.isEmpty()) {
-            backdrop.save(fileName, "jpg", 100);
-        }
-    }
+    saveMovieSetImage(setName, backdrop, DataFileType::MovieSetBackdrop);
 }
 
-bool KodiXml::saveFile(QString filename, QByteArray data)
+void KodiXml::saveMovieSetImage(const QString& setName, const QImage& image, DataFileType dataFileType)
 {
-    QDir saveFileDir = QFileInfo(filename).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
-    }
-    QFile file(filename);
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "jpg", 100);
 
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(data);
-        file.close();
-        return true;
+    mediaelch::FileWriteBatch batch;
+    for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
+        QString fileName = movieSetFileName(setName, &dataFile);
+        if (!fileName.isEmpty()) {
+            batch.writeFile(fileName, data);
+        }
     }
-    return false;
+    batch.executeAsync().waitForFinished();
 }
 
 mediaelch::DirectoryPath KodiXml::getPath(const Movie* movie)
@@ -1396,8 +1407,7 @@ QString KodiXml::imageFileName(const Movie* movie, ImageType type, QVector<DataF
             }
         }
         mediaelch::DirectoryPath path = getPath(movie);
-        QFileInfo pFi(path.filePath(file));
-        if (pFi.isFile() || constructName) {
+        if (constructName || mediaelch::DirectoryListingCache::isFile(path.filePath(file))) {
             fileName = path.filePath(file);
             break;
         }
@@ -1542,6 +1552,7 @@ KodiXml::imageFileName(const TvShowEpisode* episode, ImageType type, QVector<Dat
 
 bool KodiXml::loadArtist(Artist* artist, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load artist NFO");
     artist->clear();
     artist->setHasChanged(false);
 
@@ -1578,6 +1589,7 @@ bool KodiXml::loadArtist(Artist* artist, QString initialNfoContent)
 
 bool KodiXml::loadAlbum(Album* album, QString initialNfoContent)
 {
+    ELCH_TRACE_SCOPE("nfo", "Load album NFO");
     if (album == nullptr) {
         return false;
     }
@@ -1690,19 +1702,9 @@ bool KodiXml::saveArtist(Artist* artist)
         return false;
     }
 
-    QDir saveFileDir = QFileInfo(fileName).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
-    }
-    {
-        QFile file(fileName);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            qWarning() << "[KodiXml] File could not be openend";
-            return false;
-        }
-        file.write(xmlContent);
-        file.close();
-    }
+    mediaelch::FileWriteBatch batch;
+    const int nfoWrite = batch.writeTextFile(fileName, xmlContent);
+
     for (const auto imageType : Artist::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
 
@@ -1710,34 +1712,32 @@ bool KodiXml::saveArtist(Artist* artist)
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
                 if (!saveFileName.isEmpty()) {
-                    QFile(artist->path().filePath(saveFileName)).remove();
+                    batch.removeFile(artist->path().filePath(saveFileName));
                 }
             }
         }
 
-        if (!artist->rawImage(imageType).isNull()) {
+        const QByteArray image = artist->rawImage(imageType);
+        if (!image.isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
-                saveFile(artist->path().filePath(saveFileName), artist->rawImage(imageType));
+                batch.writeFile(artist->path().filePath(saveFileName), image);
             }
         }
     }
 
     for (const QString& file : artist->extraFanartsToRemove()) {
-        QFile::remove(file);
+        batch.removeFile(file);
     }
     QDir dir(artist->path().subDir("extrafanart").toString());
-    if (!dir.exists() && !artist->extraFanartImagesToAdd().isEmpty()) {
-        QDir(artist->path().toString()).mkdir("extrafanart");
-    }
     for (const QByteArray& img : artist->extraFanartImagesToAdd()) {
-        int num = 1;
-        while (QFileInfo(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num)).exists()) {
-            ++num;
-        }
-        saveFile(dir.absolutePath() + "/" + QString("fanart%1.jpg").arg(num), img);
+        batch.writeFile(extraFanartFilePath(dir, batch), img);
     }
 
+    if (!areAllWritesSuccessful(batch.executeAsync().result(), {nfoWrite})) {
+        qWarning() << "[KodiXml] File could not be written:" << fileName;
+        return false;
+    }
     return true;
 }
 
@@ -1757,17 +1757,8 @@ bool KodiXml::saveAlbum(Album* album)
         return false;
     }
 
-    QDir saveFileDir = QFileInfo(nfoFileName).dir();
-    if (!saveFileDir.exists()) {
-        saveFileDir.mkpath(".");
-    }
-    QFile nfo(nfoFileName);
-    if (!nfo.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        qWarning() << "[KodiXml] File could not be openend";
-        return false;
-    }
-    nfo.write(xmlContent);
-    nfo.close();
+    mediaelch::FileWriteBatch batch;
+    const int nfoWrite = batch.writeTextFile(nfoFileName, xmlContent);
 
     for (const auto imageType : Album::imageTypes()) {
         DataFileType dataFileType = DataFile::dataFileTypeForImageType(imageType);
@@ -1776,29 +1767,25 @@ bool KodiXml::saveAlbum(Album* album)
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
                 if (!saveFileName.isEmpty()) {
-                    QFile(album->path().filePath(saveFileName)).remove();
+                    batch.removeFile(album->path().filePath(saveFileName));
                 }
             }
         }
 
-        if (!album->rawImage(imageType).isNull()) {
+        const QByteArray image = album->rawImage(imageType);
+        if (!image.isNull()) {
             for (DataFile dataFile : Settings::instance()->dataFiles(dataFileType)) {
                 QString saveFileName = dataFile.saveFileName(QString());
-                saveFile(album->path().filePath(saveFileName), album->rawImage(imageType));
+                batch.writeFile(album->path().filePath(saveFileName), image);
             }
         }
     }
 
     if (album->bookletModel()->hasChanged()) {
-        QDir dir(album->path().subDir("booklet").toString());
-        if (!dir.exists()) {
-            QDir(album->path().toString()).mkdir("booklet");
-        }
-
         // \todo: get filename from settings
         for (Image* image : album->bookletModel()->images()) {
             if (image->deletion() && !image->fileName().isEmpty()) {
-                QFile::remove(image->fileName());
+                batch.removeFile(image->fileName());
             } else if (!image->deletion()) {
                 image->load();
             }
@@ -1808,16 +1795,16 @@ bool KodiXml::saveAlbum(Album* album)
             if (!image->deletion()) {
                 QString imageFileName = "booklet" + QString("%1").arg(bookletNum, 2, 10, QChar('0')) + ".jpg";
                 QString imageFilePath = album->path().subDir("booklet").filePath(imageFileName);
-                QFile file(imageFilePath);
-                if (file.open(QIODevice::WriteOnly)) {
-                    file.write(image->rawData());
-                    file.close();
-                }
+                batch.writeFile(imageFilePath, image->rawData());
                 bookletNum++;
             }
         }
     }
 
+    if (!areAllWritesSuccessful(batch.executeAsync().result(), {nfoWrite})) {
+        qWarning() << "[KodiXml] File could not be written:" << nfoFileName;
+        return false;
+    }
     return true;
 }
 
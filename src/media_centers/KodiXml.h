@@ -31,6 +31,11 @@ public:
     // movies
     bool saveMovie(Movie* movie) override;
     bool loadMovie(Movie* movie, QString initialNfoContent = "") override;
+    QByteArray movieNfoContent(Movie* movie) override;
+    mediaelch::FileWriteBatch movieFileWrites(Movie* movie, const QByteArray& xmlContent) override;
+    bool finishMovieSave(Movie* movie,
+        const mediaelch::FileWriteBatch& batch,
+        const QVector<mediaelch::FileWriteBatch::Result>& results) override;
     // movie images (e.g. posters)
     QImage movieSetPoster(QString setName) override;
     QImage movieSetBackdrop(QString setName) override;
@@ -119,7 +124,7 @@ private:
     QByteArray getAlbumXml(Album* album);
     bool loadStreamDetails(StreamDetails* streamDetails, QDomDocument domDoc);
     void loadStreamDetails(StreamDetails* streamDetails, QDomElement elem);
-    bool saveFile(QString filename, QByteArray data);
+    void saveMovieSetImage(const QString& setName, const QImage& image, DataFileType dataFileType);
     mediaelch::DirectoryPath getPath(const Movie* movie);
     mediaelch::DirectoryPath getPath(const Concert* concert);
     QString movieSetFileName(QString setName, DataFile* dataFile);
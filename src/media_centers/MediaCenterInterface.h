@@ -1,5 +1,6 @@
 #pragma once
 
+#include "file/FileWriteBatch.h"
 #include "globals/Actor.h"
 #include "globals/Globals.h"
 #include "settings/DataFile.h"
@@ -42,6 +43,17 @@ public:
     // movies
     virtual bool saveMovie(Movie* movie) = 0;
     virtual bool loadMovie(Movie* movie, QString nfoContent = "") = 0;
+    // Steps of saveMovie() for saving several movies in parallel, see mediaelch::MovieSaveQueue.
+    // Unlike saveMovie(), they don't update the database.
+    /// \brief Returns the movie's NFO content. May be called from any thread while the movie is not modified.
+    virtual QByteArray movieNfoContent(Movie* movie) = 0;
+    /// \brief Returns all file writes of the movie, i.e. NFO files and artwork, and stores the NFO content.
+    virtual mediaelch::FileWriteBatch movieFileWrites(Movie* movie, const QByteArray& nfoContent) = 0;
+    /// \brief Finishes saving after the writes of movieFileWrites() were executed, e.g. renames subtitles.
+    /// \return Saving success
+    virtual bool finishMovieSave(Movie* movie,
+        const mediaelch::FileWriteBatch& batch,
+        const QVector<mediaelch::FileWriteBatch::Result>& results) = 0;
     // movie images (e.g. posters)
     virtual QImage movieSetPoster(QString setName) = 0;
     virtual QImage movieSetBackdrop(QString setName) = 0;
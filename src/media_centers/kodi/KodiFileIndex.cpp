@@ -0,0 +1,114 @@
+#include "media_centers/kodi/KodiFileIndex.h"
+
+#include <algorithm>
+
+namespace mediaelch {
+namespace kodi {
+
+void KodiFileIndex::insert(int id, const QString& kodiFile)
+{
+    QStringList files;
+    if (kodiFile.startsWith("stack://")) {
+        files = kodiFile.mid(8).split(" , ");
+    } else {
+        files << kodiFile;
+    }
+    m_entries.append({id, splitFiles(files)});
+    m_levelsBuilt.clear();
+}
+
+void KodiFileIndex::clear()
+{
+    m_entries.clear();
+    m_levels.clear();
+    m_levelsBuilt.clear();
+}
+
+int KodiFileIndex::findId(const QStringList& files) const
+{
+    if (files.isEmpty()) {
+        return -1;
+    }
+
+    const Files localFiles = splitFiles(files);
+    QVector<int> matches;
+    for (int level = 0; level <= maxLevel; ++level) {
+        const QString fileKey = key(localFiles, level);
+        matches = fileKey.isEmpty() ? QVector<int>{} : levelIndex(level).value(fileKey);
+        if (matches.count() <= 1) {
+            break;
+        }
+    }
+
+    if (matches.count() == 1) {
+        return matches.first();
+    }
+    if (matches.isEmpty()) {
+        return 0;
+    }
+    return -1;
+}
+
+QStringList KodiFileIndex::splitFile(const QString& file)
+{
+    // Windows file names must not contain /
+    if (file.contains("/")) {
+        return file.split("/");
+    }
+    return file.split("\\");
+}
+
+KodiFileIndex::Files KodiFileIndex::splitFiles(const QStringList& files)
+{
+    Files splitted;
+    splitted.reserve(files.count());
+    for (const QString& file : files) {
+        splitted.append(splitFile(file));
+    }
+    return splitted;
+}
+
+QString KodiFileIndex::key(const Files& files, int level)
+{
+    const int componentCount = level + 1;
+    QStringList suffixes;
+    suffixes.reserve(files.count());
+    for (const QStringList& parts : files) {
+        if (parts.count() < componentCount) {
+            return {};
+        }
+        suffixes << parts.mid(parts.count() - componentCount).join("/");
+    }
+
+    if (suffixes.count() == 1) {
+        return QStringLiteral("1\n") + suffixes.first().toLower();
+    }
+    // Stacks are compared case-sensitively and independent of their order.
+    std::sort(suffixes.begin(), suffixes.end());
+    return QString::number(suffixes.count()) + "\n" + suffixes.join("\n");
+}
+
+const QHash<QString, QVector<int>>& KodiFileIndex::levelIndex(int level) const
+{
+    if (m_levelsBuilt.isEmpty()) {
+        m_levels = QVector<QHash<QString, QVector<int>>>(maxLevel + 1);
+        m_levelsBuilt = QVector<bool>(maxLevel + 1, false);
+    }
+
+    QHash<QString, QVector<int>>& index = m_levels[level];
+    if (!m_levelsBuilt.at(level)) {
+        index.clear();
+        index.reserve(m_entries.count());
+        for (const Entry& entry : m_entries) {
+            const QString entryKey = key(entry.files, level);
+            if (!entryKey.isEmpty()) {
+                index[entryKey].append(entry.id);
+            }
+        }
+        m_levelsBuilt[level] = true;
+    }
+    return index;
+}
+
+} // namespace kodi
+} // namespace mediaelch
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace mediaelch {
+namespace kodi {
+
+/// \brief Index of Kodi's library items by their file paths.
+///
+/// Kodi and MediaElch may see the same files under different mount points,
+/// e.g. "smb://nas/movies/Alien/Alien.mkv" and "/mnt/movies/Alien/Alien.mkv".
+/// Items are therefore matched by the last path components: first only by
+/// the file name and, if that is ambiguous, by one more parent directory at
+/// a time (up to maxLevel). Single files are compared case-insensitively.
+/// Stacked files ("stack://a , b") match if all files match in any order.
+///
+/// Paths are split once on insertion. The lookup table of a level is built
+/// on first use, so a lookup is a single hash access per level instead of a
+/// scan over all items.
+class KodiFileIndex
+{
+public:
+    /// Number of parent directories that are compared at most.
+    static constexpr int maxLevel = 4;
+
+    /// \brief Adds the library item with the given id. kodiFile may be a "stack://" path.
+    void insert(int id, const QString& kodiFile);
+    void clear();
+    int count() const { return m_entries.count(); }
+
+    /// \brief Returns the id of the only item matching the given files.
+    /// Returns 0 if no item matches and -1 if the files are empty or
+    /// several items match even with maxLevel parent directories.
+    int findId(const QStringList& files) const;
+
+    /// \brief Splits the path at "/" or, if there is none, at "\".
+    static QStringList splitFile(const QString& file);
+
+private:
+    using Files = QVector<QStringList>;
+    struct Entry
+    {
+        int id;
+        Files files;
+    };
+
+    static Files splitFiles(const QStringList& files);
+    /// \brief Key of the files when comparing the last (level + 1) path components.
+    /// Returns an empty string if a file has not enough components.
+    static QString key(const Files& files, int level);
+    const QHash<QString, QVector<int>>& levelIndex(int level) const;
+
+    QVector<Entry> m_entries;
+    /// Lookup table per level. Built lazily and reset on insertion.
+    mutable QVector<QHash<QString, QVector<int>>> m_levels;
+    mutable QVector<bool> m_levelsBuilt;
+};
+
+} // namespace kodi
+} // namespace mediaelch
@@ -9,6 +9,7 @@
 
 #include "data/ImageCache.h"
 #include "globals/Helper.h"
+#include "globals/StringPool.h"
 #include "media_centers/MediaCenterInterface.h"
 #include "settings/Settings.h"
 
@@ -160,7 +161,7 @@ void Movie::clearImages()
 {
     m_movieImages.clearImages();
     for (auto& actor : m_crew.actors()) {
-        actor->image = QByteArray();
+        actor->image = mediaelch::ImageBlob();
     }
 }
 
@@ -822,7 +823,7 @@ void Movie::addCountry(QString country) // NOLINT // we require pass-by-value
     if (country.isEmpty()) {
         return;
     }
-    m_countries.append(country);
+    m_countries.append(mediaelch::StringPool::intern(country));
     setChanged(true);
 }
 
@@ -836,7 +837,7 @@ void Movie::addGenre(QString genre) // NOLINT // we require pass-by-value
     if (genre.isEmpty()) {
         return;
     }
-    m_genres.append(genre);
+    m_genres.append(mediaelch::StringPool::intern(genre));
     setChanged(true);
 }
 
@@ -850,7 +851,7 @@ void Movie::addStudio(QString studio) // NOLINT // we require pass-by-value
     if (studio.isEmpty()) {
         return;
     }
-    m_studios.append(studio);
+    m_studios.append(mediaelch::StringPool::intern(studio));
     setChanged(true);
 }
 
@@ -859,7 +860,7 @@ void Movie::addTag(QString tag) // NOLINT // we require pass-by-value
     if (m_tags.contains(tag)) {
         return;
     }
-    m_tags.append(tag);
+    m_tags.append(mediaelch::StringPool::intern(tag));
     setChanged(true);
 }
 
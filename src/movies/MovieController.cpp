@@ -40,12 +40,22 @@ MovieController::MovieController(Movie* parent) :
 }
 
 bool MovieController::saveData(MediaCenterInterface* mediaCenterInterface)
+{
+    beforeSave();
+    bool saved = mediaCenterInterface->saveMovie(m_movie);
+    afterSave(saved);
+    return saved;
+}
+
+void MovieController::beforeSave()
 {
     if (!m_movie->streamDetailsLoaded() && Settings::instance()->autoLoadStreamDetails()) {
         loadStreamDetailsFromFile();
     }
-    bool saved = mediaCenterInterface->saveMovie(m_movie);
+}
 
+void MovieController::afterSave(bool saved)
+{
     qDebug() << "[MovieController] Saved movie? =>" << saved;
     if (!m_infoLoaded) {
         m_infoLoaded = saved;
@@ -57,7 +67,6 @@ bool MovieController::saveData(MediaCenterInterface* mediaCenterInterface)
     for (Subtitle* subtitle : m_movie->subtitles()) {
         subtitle->setChanged(false);
     }
-    return saved;
 }
 
 bool MovieController::loadData(MediaCenterInterface* mediaCenterInterface, bool force, bool reloadFromNfo)
@@ -346,7 +355,7 @@ void MovieController::onDownloadFinished(DownloadManagerElement elem)
     emit sigDownloadProgress(m_movie, m_downloadsLeft, m_downloadsSize);
 
     if (!elem.data.isEmpty() && elem.imageType == ImageType::Actor) {
-        elem.actor->image = elem.data;
+        elem.actor->image = mediaelch::ImageBlob(elem.data);
     } else if (!elem.data.isEmpty() && elem.imageType == ImageType::MovieExtraFanart) {
         helper::resizeBackdrop(elem.data);
         m_movie->images().addExtraFanart(elem.data);
@@ -24,6 +24,11 @@ public:
     /// \param mediaCenterInterface MediaCenterInterface to use for saving
     /// \return Saving was successful or not
     bool saveData(MediaCenterInterface* mediaCenterInterface);
+    /// \brief Prepares the movie for saving, e.g. loads missing stream details. Part of saveData().
+    void beforeSave();
+    /// \brief Resets the movie's changed state after saving. Part of saveData().
+    /// \param saved Whether saving was successful
+    void afterSave(bool saved);
 
     /// \brief Loads the movies infos with the given MediaCenterInterface
     /// \param mediaCenterInterface MediaCenterInterface to use for loading
@@ -1,5 +1,6 @@
 #include "MovieCrew.h"
 
+#include "globals/StringPool.h"
 
 QString MovieCrew::writer() const
 {
@@ -42,7 +43,8 @@ void MovieCrew::setDirector(QString director)
 void MovieCrew::setActors(QVector<Actor> actors)
 {
     m_actors.clear();
-    for (const Actor& actor : actors) {
+    for (Actor& actor : actors) {
+        actor.name = mediaelch::StringPool::intern(actor.name);
         m_actors.push_back(std::make_unique<Actor>(actor));
     }
 }
@@ -52,6 +54,7 @@ void MovieCrew::addActor(Actor actor)
     if (actor.order == 0 && !m_actors.empty()) {
         actor.order = m_actors.back()->order + 1;
     }
+    actor.name = mediaelch::StringPool::intern(actor.name);
     m_actors.push_back(std::make_unique<Actor>(actor));
 }
 
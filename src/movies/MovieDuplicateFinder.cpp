@@ -0,0 +1,29 @@
+#include "movies/MovieDuplicateFinder.h"
+
+#include "movies/Movie.h"
+
+namespace mediaelch {
+
+QMap<Movie*, QVector<Movie*>> findMovieDuplicates(const QVector<Movie*>& movies,
+    const std::function<void(int)>& progress)
+{
+    QMap<Movie*, QVector<Movie*>> duplicateMovies;
+    int counter = 0;
+    for (Movie* movie : movies) {
+        QVector<Movie*> dups{movie};
+        for (Movie* subMovie : movies) {
+            if (movie != subMovie && subMovie->isDuplicate(movie)) {
+                dups.append(subMovie);
+            }
+        }
+        if (dups.count() > 1) {
+            duplicateMovies.insert(movie, dups);
+        }
+        if (progress) {
+            progress(++counter);
+        }
+    }
+    return duplicateMovies;
+}
+
+} // namespace mediaelch
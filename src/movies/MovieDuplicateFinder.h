@@ -0,0 +1,20 @@
+#pragma once
+
+#include <QMap>
+#include <QVector>
+
+#include <functional>
+
+class Movie;
+
+namespace mediaelch {
+
+/// \brief Finds movies that share their IMDb id, TMDb id or title, see Movie::isDuplicate().
+///
+/// Each movie with duplicates maps to a list that starts with the movie itself,
+/// followed by its duplicates in the order of the given movies.
+/// \param progress Called after each movie with the number of checked movies. May be empty.
+QMap<Movie*, QVector<Movie*>> findMovieDuplicates(const QVector<Movie*>& movies,
+    const std::function<void(int)>& progress = {});
+
+} // namespace mediaelch
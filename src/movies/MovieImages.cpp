@@ -14,43 +14,43 @@ void MovieImages::clear(QSet<MovieScraperInfo> infos)
 {
     if (infos.contains(MovieScraperInfo::Backdrop)) {
         m_backdrops.clear();
-        m_images.insert(ImageType::MovieBackdrop, QByteArray());
+        m_images.insert(ImageType::MovieBackdrop, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieBackdrop, false);
         m_imagesToRemove.removeOne(ImageType::MovieBackdrop);
     }
     if (infos.contains(MovieScraperInfo::CdArt)) {
         m_discArts.clear();
-        m_images.insert(ImageType::MovieCdArt, QByteArray());
+        m_images.insert(ImageType::MovieCdArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieCdArt, false);
         m_imagesToRemove.removeOne(ImageType::MovieCdArt);
     }
     if (infos.contains(MovieScraperInfo::ClearArt)) {
         m_clearArts.clear();
-        m_images.insert(ImageType::MovieClearArt, QByteArray());
+        m_images.insert(ImageType::MovieClearArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieClearArt, false);
         m_imagesToRemove.removeOne(ImageType::MovieClearArt);
     }
     if (infos.contains(MovieScraperInfo::Logo)) {
         m_logos.clear();
-        m_images.insert(ImageType::MovieLogo, QByteArray());
+        m_images.insert(ImageType::MovieLogo, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieLogo, false);
         m_imagesToRemove.removeOne(ImageType::MovieLogo);
     }
     if (infos.contains(MovieScraperInfo::Poster)) {
         m_posters.clear();
-        m_images.insert(ImageType::MoviePoster, QByteArray());
+        m_images.insert(ImageType::MoviePoster, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MoviePoster, false);
         m_numPrimaryLangPosters = 0;
         m_imagesToRemove.removeOne(ImageType::MoviePoster);
     }
 
     if (infos.contains(MovieScraperInfo::Banner)) {
-        m_images.insert(ImageType::MovieBanner, QByteArray());
+        m_images.insert(ImageType::MovieBanner, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieBanner, false);
         m_imagesToRemove.removeOne(ImageType::MovieBanner);
     }
     if (infos.contains(MovieScraperInfo::Thumb)) {
-        m_images.insert(ImageType::MovieThumb, QByteArray());
+        m_images.insert(ImageType::MovieThumb, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::MovieThumb, false);
         m_imagesToRemove.removeOne(ImageType::MovieThumb);
     }
@@ -103,7 +103,11 @@ QStringList MovieImages::extraFanartsToRemove()
 
 QVector<QByteArray> MovieImages::extraFanartToAdd()
 {
-    return m_extraFanartToAdd.toVector();
+    QVector<QByteArray> images;
+    for (const mediaelch::ImageBlob& image : m_extraFanartToAdd) {
+        images.append(image.data());
+    }
+    return images;
 }
 
 QVector<ImageType> MovieImages::imagesToRemove() const
@@ -167,13 +171,18 @@ void MovieImages::addLogo(Poster logo)
 
 void MovieImages::addExtraFanart(QByteArray fanart)
 {
-    m_extraFanartToAdd.append(fanart);
+    m_extraFanartToAdd.append(mediaelch::ImageBlob(fanart));
     m_movie.setChanged(true);
 }
 
 void MovieImages::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartToAdd.removeOne(fanart);
+    for (int i = 0; i < m_extraFanartToAdd.size(); ++i) {
+        if (m_extraFanartToAdd.at(i).hasSameData(fanart)) {
+            m_extraFanartToAdd.removeAt(i);
+            break;
+        }
+    }
     m_movie.setChanged(true);
 }
 
@@ -198,9 +207,9 @@ QVector<ExtraFanart> MovieImages::extraFanarts(MediaCenterInterface* mediaCenter
         f.path = file;
         fanarts.append(f);
     }
-    for (const QByteArray& img : m_extraFanartToAdd) {
+    for (const mediaelch::ImageBlob& img : m_extraFanartToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -215,7 +224,7 @@ void MovieImages::clearExtraFanartData()
 
 void MovieImages::removeImage(ImageType type)
 {
-    if (!m_images.value(type, QByteArray()).isNull()) {
+    if (!m_images.value(type).isNull()) {
         m_images.remove(type);
         m_hasImageChanged.insert(type, false);
     } else if (!m_imagesToRemove.contains(type)) {
@@ -226,7 +235,7 @@ void MovieImages::removeImage(ImageType type)
 
 QByteArray MovieImages::image(ImageType imageType) const
 {
-    return m_images.value(imageType, QByteArray());
+    return m_images.value(imageType).data();
 }
 
 bool MovieImages::imageHasChanged(ImageType imageType)
@@ -246,7 +255,7 @@ void MovieImages::setHasImage(ImageType imageType, bool has)
 
 void MovieImages::setImage(ImageType imageType, QByteArray image)
 {
-    m_images.insert(imageType, image);
+    m_images.insert(imageType, mediaelch::ImageBlob(image));
     m_hasImageChanged.insert(imageType, true);
     m_movie.setChanged(true);
 }
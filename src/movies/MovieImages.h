@@ -5,6 +5,7 @@
 #include <QString>
 #include <QVector>
 
+#include "data/ImageBlob.h"
 #include "globals/Globals.h"
 #include "globals/Poster.h"
 #include "globals/ScraperInfos.h"
@@ -65,10 +66,10 @@ private:
     int m_numPrimaryLangPosters{0};
     bool m_hasExtraFanarts{false};
 
-    QMap<ImageType, QByteArray> m_images;
+    QMap<ImageType, mediaelch::ImageBlob> m_images;
     QMap<ImageType, bool> m_hasImage;
     QMap<ImageType, bool> m_hasImageChanged;
-    QList<QByteArray> m_extraFanartToAdd;
+    QList<mediaelch::ImageBlob> m_extraFanartToAdd;
     QList<ImageType> m_imagesToRemove;
 
     Movie& m_movie;
@@ -6,6 +6,7 @@
 #include "globals/Globals.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "log/Tracer.h"
 
 MovieModel::MovieModel(QObject* parent) :
 #ifndef Q_OS_WIN
@@ -34,6 +35,34 @@ void MovieModel::addMovie(Movie* movie)
     connect(movie, &Movie::sigChanged, this, &MovieModel::onMovieChanged, Qt::UniqueConnection);
 }
 
+void MovieModel::addMovies(const QVector<Movie*>& movies)
+{
+    ELCH_TRACE_SCOPE("model", "Add movies to model");
+    if (movies.isEmpty()) {
+        return;
+    }
+    beginInsertRows(QModelIndex(), rowCount(), rowCount() + movies.size() - 1);
+    m_movies.append(movies);
+    endInsertRows();
+    for (Movie* movie : movies) {
+        connect(movie, &Movie::sigChanged, this, &MovieModel::onMovieChanged, Qt::UniqueConnection);
+    }
+}
+
+void MovieModel::removeMovies(const QVector<Movie*>& movies)
+{
+    for (Movie* movie : movies) {
+        const int row = m_movies.indexOf(movie);
+        if (row < 0) {
+            continue;
+        }
+        beginRemoveRows(QModelIndex(), row, row);
+        m_movies.removeAt(row);
+        endRemoveRows();
+        movie->deleteLater();
+    }
+}
+
 /**
  * \brief Called when a movies data has changed
  * Emits dataChanged
@@ -236,6 +265,7 @@ QModelIndex MovieModel::index(int row, int column, const QModelIndex& parent) co
  */
 void MovieModel::clear()
 {
+    ELCH_TRACE_SCOPE("model", "Clear movie model");
     if (m_movies.isEmpty()) {
         return;
     }
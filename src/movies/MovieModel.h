@@ -28,6 +28,10 @@ public:
     virtual QVector<Movie*> movies();
     Movie* movie(int row);
     void addMovie(Movie* movie);
+    /// \brief Adds all movies with a single row insertion.
+    void addMovies(const QVector<Movie*>& movies);
+    /// \brief Removes the movies from the model and deletes them.
+    void removeMovies(const QVector<Movie*>& movies);
     void update();
     void clear();
     int countNewMovies();
@@ -2,6 +2,7 @@
 
 #include <QDebug>
 
+#include "data/Database.h"
 #include "globals/Filter.h"
 #include "globals/Globals.h"
 #include "globals/Manager.h"
@@ -25,8 +26,14 @@ bool MovieProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceP
     }
 
     Movie* movie = movies.at(sourceRow);
+    const bool useSearchResults = !m_searchResults.isEmpty() && isInSearchIndex(movie);
     for (Filter* filter : m_filters) {
-        if (!filter->accepts(movie)) {
+        const auto searchResult = m_searchResults.constFind(filter);
+        if (useSearchResults && searchResult != m_searchResults.constEnd()) {
+            if (!searchResult->contains(movie->databaseId())) {
+                return false;
+            }
+        } else if (!filter->accepts(movie)) {
             return false;
         }
     }
@@ -104,12 +111,89 @@ void MovieProxyModel::setFilterDuplicates(bool filterDuplicates)
 }
 
 /**
- * \brief Sets active filters
+ * \brief Sets active filters. Title and filename filters are answered by the database's full-text
+ * index: words are matched as prefixes and the title filter also finds original titles.
  */
 void MovieProxyModel::setFilter(QVector<Filter*> filters, QString text)
 {
     m_filters = filters;
     m_filterText = text;
+    updateSearchResults();
+}
+
+void MovieProxyModel::setSourceModel(QAbstractItemModel* model)
+{
+    QAbstractItemModel* oldModel = sourceModel();
+    if (oldModel != nullptr) {
+        disconnect(oldModel, &QAbstractItemModel::rowsInserted, this, &MovieProxyModel::onSourceRowsInserted);
+        disconnect(oldModel, &QAbstractItemModel::dataChanged, this, &MovieProxyModel::onSourceDataChanged);
+    }
+    if (model != nullptr) {
+        // Connected before QSortFilterProxyModel's own connections so that new and
+        // changed rows are filtered linearly.
+        connect(model, &QAbstractItemModel::rowsInserted, this, &MovieProxyModel::onSourceRowsInserted);
+        connect(model, &QAbstractItemModel::dataChanged, this, &MovieProxyModel::onSourceDataChanged);
+    }
+    QSortFilterProxyModel::setSourceModel(model);
+}
+
+void MovieProxyModel::updateSearchResults()
+{
+    using mediaelch::LibrarySearchIndex;
+
+    m_searchResults.clear();
+    m_changedMovies.clear();
+    Database* database = Manager::instance()->database();
+    if (!database->hasSearchIndex()) {
+        return;
+    }
+    for (Filter* filter : m_filters) {
+        if (LibrarySearchIndex::matchExpression(filter->shortText()).isEmpty()) {
+            continue;
+        }
+        QVector<int> ids;
+        if (filter->isInfo(MovieFilters::Title)) {
+            ids = database->searchMovies(filter->shortText(), LibrarySearchIndex::Columns::Titles);
+        } else if (filter->isInfo(MovieFilters::Path)) {
+            ids = database->searchMovies(filter->shortText(), LibrarySearchIndex::Columns::Paths);
+        } else {
+            continue;
+        }
+        m_searchResults.insert(filter, QSet<int>::fromList(ids.toList()));
+    }
+}
+
+void MovieProxyModel::onSourceRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    markMoviesChanged(first, last);
+}
+
+void MovieProxyModel::onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight)
+{
+    markMoviesChanged(topLeft.row(), bottomRight.row());
+}
+
+/**
+ * \brief Search results don't include later changes of the movies: filter them linearly.
+ */
+void MovieProxyModel::markMoviesChanged(int first, int last)
+{
+    if (m_searchResults.isEmpty()) {
+        return;
+    }
+    const QVector<Movie*> movies = Manager::instance()->movieModel()->movies();
+    for (int row = qMax(0, first); row <= last && row < movies.count(); ++row) {
+        m_changedMovies.insert(movies.at(row));
+    }
+}
+
+/**
+ * \brief Whether the index knows the current state of the movie.
+ */
+bool MovieProxyModel::isInSearchIndex(Movie* movie) const
+{
+    return movie->databaseId() >= 0 && !movie->hasChanged() && !m_changedMovies.contains(movie);
 }
 
 /**
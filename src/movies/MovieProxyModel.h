@@ -2,6 +2,8 @@
 
 #include "globals/Filter.h"
 
+#include <QHash>
+#include <QSet>
 #include <QSortFilterProxyModel>
 
 /**
@@ -13,6 +15,7 @@ class MovieProxyModel : public QSortFilterProxyModel
 public:
     explicit MovieProxyModel(QObject* parent = nullptr);
     void setFilter(QVector<Filter*> filters, QString text);
+    void setSourceModel(QAbstractItemModel* model) override;
     void setSortBy(SortBy sortBy);
 
     bool filterDuplicates() const;
@@ -23,8 +26,19 @@ protected:
     bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
 
 private:
+    void updateSearchResults();
+    void onSourceRowsInserted(const QModelIndex& parent, int first, int last);
+    void onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight);
+    void markMoviesChanged(int first, int last);
+    bool isInSearchIndex(Movie* movie) const;
+
     QVector<Filter*> m_filters;
     QString m_filterText;
+    /// Database ids of the movies that match a text filter, for all filters that are answered
+    /// by the database's full-text index, see setFilter().
+    QHash<Filter*, QSet<int>> m_searchResults;
+    /// Movies that were added or changed since the index was queried. They are filtered linearly.
+    QSet<Movie*> m_changedMovies;
     SortBy m_sortBy;
     bool m_filterDuplicates;
 };
@@ -0,0 +1,165 @@
+#include "movies/MovieSaveQueue.h"
+
+#include "data/Database.h"
+#include "media_centers/MediaCenterInterface.h"
+#include "movies/Movie.h"
+#include "movies/MovieController.h"
+
+#include <QDebug>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
+
+namespace mediaelch {
+
+MovieSaveQueue::MovieSaveQueue(MediaCenterInterface& mediaCenter, Database* database, QObject* parent) :
+    QObject(parent), m_mediaCenter{mediaCenter}, m_database{database}
+{
+}
+
+MovieSaveQueue::~MovieSaveQueue()
+{
+    // Worker threads access the movies; don't leave them running.
+    m_pending.clear();
+    for (QFutureWatcherBase* watcher : findChildren<QFutureWatcherBase*>()) {
+        watcher->disconnect(this);
+        watcher->waitForFinished();
+    }
+}
+
+void MovieSaveQueue::save(const QVector<Movie*>& movies)
+{
+    if (m_running) {
+        qWarning() << "[MovieSaveQueue] Movies are already being saved";
+        return;
+    }
+
+    m_pending.clear();
+    m_savedMovies.clear();
+    for (Movie* movie : movies) {
+        m_pending.enqueue(movie);
+    }
+    m_inFlight = 0;
+    m_total = movies.count();
+    m_done = 0;
+    m_failed = 0;
+    m_canceled = false;
+    m_running = true;
+
+    qDebug() << "[MovieSaveQueue] Save" << m_total << "movies";
+    emit sigProgress(0, m_total);
+
+    if (m_pending.isEmpty()) {
+        finish();
+        return;
+    }
+    startNext();
+}
+
+void MovieSaveQueue::cancel()
+{
+    if (!m_running || m_canceled) {
+        return;
+    }
+    qDebug() << "[MovieSaveQueue] Canceled;" << m_pending.count() << "movies won't be saved";
+    m_canceled = true;
+    m_pending.clear();
+    if (m_inFlight == 0) {
+        finish();
+    }
+}
+
+void MovieSaveQueue::startNext()
+{
+    while (!m_pending.isEmpty() && m_inFlight < maxMoviesInFlight) {
+        QPointer<Movie> movie = m_pending.dequeue();
+        if (movie.isNull()) {
+            ++m_done;
+            ++m_failed;
+            continue;
+        }
+        ++m_inFlight;
+
+        movie->controller()->beforeSave();
+
+        auto* watcher = new QFutureWatcher<QByteArray>(this);
+        connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, movie]() {
+            watcher->deleteLater();
+            writeFiles(movie, watcher->result());
+        });
+        MediaCenterInterface* mediaCenter = &m_mediaCenter;
+        Movie* moviePtr = movie.data();
+        watcher->setFuture(
+            QtConcurrent::run([mediaCenter, moviePtr]() { return mediaCenter->movieNfoContent(moviePtr); }));
+    }
+
+    if (m_pending.isEmpty() && m_inFlight == 0) {
+        finish();
+    }
+}
+
+void MovieSaveQueue::writeFiles(QPointer<Movie> movie, const QByteArray& nfoContent)
+{
+    if (movie.isNull() || m_canceled) {
+        // Nothing was written yet: the movie keeps its changes.
+        itemDone();
+        return;
+    }
+
+    const FileWriteBatch batch = m_mediaCenter.movieFileWrites(movie.data(), nfoContent);
+    auto* watcher = new QFutureWatcher<QVector<FileWriteBatch::Result>>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, movie, batch]() {
+        watcher->deleteLater();
+        finishMovie(movie, batch, watcher->result());
+    });
+    watcher->setFuture(batch.executeAsync());
+}
+
+void MovieSaveQueue::finishMovie(QPointer<Movie> movie,
+    const FileWriteBatch& batch,
+    const QVector<FileWriteBatch::Result>& results)
+{
+    if (movie.isNull()) {
+        ++m_failed;
+        itemDone();
+        return;
+    }
+
+    const bool saved = !batch.isEmpty() && m_mediaCenter.finishMovieSave(movie.data(), batch, results);
+    movie->controller()->afterSave(saved);
+    if (saved) {
+        m_savedMovies.append(movie);
+    } else {
+        ++m_failed;
+    }
+    emit sigMovieSaved(movie.data(), saved);
+    itemDone();
+}
+
+void MovieSaveQueue::itemDone()
+{
+    --m_inFlight;
+    ++m_done;
+    emit sigProgress(m_done, m_total);
+    startNext();
+}
+
+void MovieSaveQueue::finish()
+{
+    if (m_database != nullptr && !m_savedMovies.isEmpty()) {
+        m_database->transaction();
+        for (const QPointer<Movie>& movie : m_savedMovies) {
+            if (!movie.isNull()) {
+                m_database->update(movie.data());
+            }
+        }
+        m_database->commit();
+    }
+
+    const int saved = m_savedMovies.count();
+    qDebug() << "[MovieSaveQueue] Saved" << saved << "movies;" << m_failed << "failed; canceled:" << m_canceled;
+    m_savedMovies.clear();
+    m_running = false;
+    emit sigFinished(saved, m_failed, m_canceled);
+}
+
+} // namespace mediaelch
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "file/FileWriteBatch.h"
+
+#include <QByteArray>
+#include <QObject>
+#include <QPointer>
+#include <QQueue>
+#include <QVector>
+
+class Database;
+class MediaCenterInterface;
+class Movie;
+
+namespace mediaelch {
+
+/// \brief Saves several movies in the background, e.g. for "save all".
+///
+/// Each movie passes through a pipeline of steps:
+///   1. Prepare the movie in the GUI thread, e.g. load missing stream details.
+///   2. Create the NFO content in a worker thread.
+///   3. Collect the movie's file writes in the GUI thread.
+///   4. Execute the writes in the I/O threads of the target file system, see FileWriteBatch.
+///   5. Finish saving (e.g. rename subtitles) and reset the movie's changed state.
+///
+/// Several movies are in the pipeline at once so that creating NFO files
+/// and writing files to different disks overlap. The database is updated
+/// in one transaction once all movies are saved.
+///
+/// Movies must not be modified while they are being saved.
+class MovieSaveQueue : public QObject
+{
+    Q_OBJECT
+public:
+    /// \param database Updated once all movies are saved. May be null, e.g. in tests.
+    MovieSaveQueue(MediaCenterInterface& mediaCenter, Database* database, QObject* parent = nullptr);
+    ~MovieSaveQueue() override;
+
+    /// \brief Saves the given movies. Must not be called while the queue is running.
+    void save(const QVector<Movie*>& movies);
+    /// \brief Stops saving movies that were not started yet.
+    /// Movies whose files are already being written are still saved. sigFinished() is emitted afterwards.
+    void cancel();
+    bool isRunning() const { return m_running; }
+
+signals:
+    void sigMovieSaved(Movie* movie, bool saved);
+    void sigProgress(int done, int total);
+    void sigFinished(int saved, int failed, bool canceled);
+
+private:
+    void startNext();
+    void writeFiles(QPointer<Movie> movie, const QByteArray& nfoContent);
+    void finishMovie(QPointer<Movie> movie,
+        const FileWriteBatch& batch,
+        const QVector<FileWriteBatch::Result>& results);
+    void itemDone();
+    void finish();
+
+    /// Number of movies that are in the pipeline at the same time.
+    static constexpr int maxMoviesInFlight = 8;
+
+    MediaCenterInterface& m_mediaCenter;
+    Database* m_database;
+    QQueue<QPointer<Movie>> m_pending;
+    QVector<QPointer<Movie>> m_savedMovies;
+    int m_inFlight = 0;
+    int m_total = 0;
+    int m_done = 0;
+    int m_failed = 0;
+    bool m_running = false;
+    bool m_canceled = false;
+};
+
+} // namespace mediaelch
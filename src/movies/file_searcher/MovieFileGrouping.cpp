@@ -0,0 +1,107 @@
+#include "movies/file_searcher/MovieFileGrouping.h"
+
+#include "globals/Helper.h"
+
+#include <QHash>
+#include <QRegExp>
+#include <algorithm>
+
+namespace mediaelch {
+
+void DiscStructureIndex::addDirectory(const QString& directory)
+{
+    m_directories.insert(directory);
+}
+
+bool DiscStructureIndex::containsFile(const QString& filePath) const
+{
+    if (m_directories.isEmpty()) {
+        return false;
+    }
+    // Check every parent directory of the file. Equivalent to checking
+    // filePath.startsWith(directory + "/") for all indexed directories.
+    for (int i = filePath.length() - 1; i >= 0; --i) {
+        const QChar c = filePath.at(i);
+        if ((c == '/' || c == '\\') && m_directories.contains(filePath.left(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QVector<QStringList> groupStackedFiles(const QStringList& files)
+{
+    QHash<QString, int> groupIndex;
+    QVector<QPair<QString, QStringList>> groups;
+
+    // Walk backwards so that the last file of a group becomes its first entry.
+    for (int i = files.size() - 1; i >= 0; --i) {
+        const QString stackedBase = helper::stackedBaseName(files.at(i));
+        auto it = groupIndex.constFind(stackedBase);
+        if (it == groupIndex.constEnd()) {
+            groupIndex.insert(stackedBase, groups.size());
+            groups.append({stackedBase, QStringList{files.at(i)}});
+        } else {
+            // Keep the list's order for all files but the first one.
+            QStringList& group = groups[it.value()].second;
+            group.insert(1, files.at(i));
+        }
+    }
+
+    std::sort(groups.begin(), groups.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    QVector<QStringList> result;
+    result.reserve(groups.size());
+    for (auto& group : groups) {
+        result.append(std::move(group.second));
+    }
+    return result;
+}
+
+QVector<QStringList> groupMultiPartFiles(const QStringList& sortedFiles)
+{
+    QRegExp rx("([\\-_\\s\\.\\(\\)]+((a|b|c|d|e|f)|((part|cd|xvid)"
+               "[\\-_\\s\\.\\(\\)]*\\d+))[\\-_\\s\\.\\(\\)]+)",
+        Qt::CaseInsensitive);
+
+    const int n = sortedFiles.size();
+    QVector<bool> isPart(n, false);
+    QVector<QStringList> groups;
+
+    for (int i = 0; i < n; ++i) {
+        const QString& file = sortedFiles.at(i);
+        if (isPart.at(i) || file.isEmpty()) {
+            continue;
+        }
+
+        QStringList movieFiles{file};
+
+        const int pos = rx.lastIndexIn(file);
+        if (pos != -1) {
+            const QString left = file.left(pos);
+            const QString right = file.mid(pos + rx.cap(0).size());
+            // All files starting with "left" are adjacent in the sorted list.
+            auto it = std::lower_bound(sortedFiles.cbegin(), sortedFiles.cend(), left);
+            for (; it != sortedFiles.cend() && it->startsWith(left); ++it) {
+                const int x = static_cast<int>(std::distance(sortedFiles.cbegin(), it));
+                if (x != i && !isPart.at(x) && it->endsWith(right)) {
+                    movieFiles << *it;
+                    isPart[x] = true;
+                }
+            }
+        }
+        groups.append(movieFiles);
+    }
+    return groups;
+}
+
+void addMovieFileRules(FileNameMatcher& matcher)
+{
+    const QStringList extraKeywords{
+        "-trailer", "-sample", "-behindthescenes", "-deleted", "-featurette", "-interview", "-scene", "-short"};
+    matcher.addFileKeywords(FileNameMatcher::Rule::MovieExtra, extraKeywords);
+    matcher.addFolderKeywords(FileNameMatcher::Rule::MovieExtra, extraKeywords);
+    matcher.addFolderNames(FileNameMatcher::Rule::SkippedFolder, {".actors", "extras", "extrafanart", "extrathumbs"});
+}
+
+} // namespace mediaelch
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "file/FileNameMatcher.h"
+
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Index of DVD or BluRay structure directories.
+///
+/// Looking up whether a file is inside one of the indexed directories only depends
+/// on the depth of the file's path and not on the number of indexed directories.
+class DiscStructureIndex
+{
+public:
+    /// \brief Add a directory that contains a disc structure, e.g. "/movies/Movie (2000)".
+    void addDirectory(const QString& directory);
+    /// \brief Returns true if the file is located (possibly nested) in one of the indexed directories.
+    /// \details Both "/" and "\" are treated as path separators.
+    bool containsFile(const QString& filePath) const;
+
+    bool isEmpty() const { return m_directories.isEmpty(); }
+
+private:
+    QSet<QString> m_directories;
+};
+
+/// \brief Groups files of a directory by their stacked base name (see helper::stackedBaseName()).
+///
+/// Files are grouped in a single pass. The groups are ordered by their base name.
+/// Inside a group, the file that comes last in the given list is the first one,
+/// followed by the remaining files in the list's order.
+QVector<QStringList> groupStackedFiles(const QStringList& files);
+
+/// \brief Groups multi-part files like "Movie-cd1.avi" and "Movie-cd2.avi".
+///
+/// Parts are detected by a "part", "cd", "xvid" or single-letter suffix. A file that was
+/// added as a part of a group does not start a group of its own. Groups are ordered by
+/// their first file.
+/// \param sortedFiles File names sorted with QStringList::sort(), i.e. case-sensitive.
+QVector<QStringList> groupMultiPartFiles(const QStringList& sortedFiles);
+
+/// \brief Adds the built-in rules of movie file searchers to the matcher.
+///
+/// Files and folders whose name contains e.g. "-trailer" are extras of a movie and
+/// not a movie themselves (Rule::MovieExtra). Folders like ".actors" or "extras"
+/// never contain movies (Rule::SkippedFolder). The matcher has to be compiled afterwards.
+void addMovieFileRules(FileNameMatcher& matcher);
+
+} // namespace mediaelch
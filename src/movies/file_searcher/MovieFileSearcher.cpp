@@ -1,6 +1,6 @@
 #include "MovieFileSearcher.h"
 
-#include <QApplication>
+#include <QCoreApplication>
 #include <QDebug>
 #include <QDirIterator>
 #include <QSqlQuery>
@@ -11,19 +11,80 @@
 #include <QtConcurrent/QtConcurrentRun>
 
 #include "data/Subtitle.h"
+#include "file/DirectoryListingCache.h"
+#include "file/FileNameMatcher.h"
+#include "globals/BatchCollector.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
+#include "log/Tracer.h"
+#include "movies/file_searcher/MovieFileGrouping.h"
+#include "movies/file_searcher/MovieLibraryWatcher.h"
+#include "settings/Settings.h"
+
+namespace {
+
+/// Returns the files of all subtitles in the given directory listing. A subtitle consists
+/// of a single file or of a ".sub" and ".idx" file pair (VobSub).
+QVector<QStringList> subtitleFiles(const mediaelch::DirectoryListingCache::Listing& listing)
+{
+    QVector<QStringList> subtitles;
+    for (const QString& fileName : listing.files) {
+        // Hidden files were never considered.
+        if (fileName.startsWith('.')) {
+            continue;
+        }
+        const bool isVobSub = fileName.endsWith(".sub", Qt::CaseInsensitive);
+        if (!isVobSub && !fileName.endsWith(".srt", Qt::CaseInsensitive)
+            && !fileName.endsWith(".smi", Qt::CaseInsensitive) && !fileName.endsWith(".ssa", Qt::CaseInsensitive)) {
+            continue;
+        }
+        QStringList files{fileName};
+        if (isVobSub) {
+            const QString idxFileName = fileName.left(fileName.length() - 4) + ".idx";
+            if (listing.contains(idxFileName)) {
+                files << idxFileName;
+            }
+        }
+        subtitles << files;
+    }
+    return subtitles;
+}
+
+} // namespace
 
 namespace mediaelch {
 
 MovieFileSearcher::MovieFileSearcher(QObject* parent) :
-    QObject(parent), m_progressMessageId{Constants::MovieFileSearcherProgressMessageId}, m_aborted{false}
+    QObject(parent),
+    m_progressMessageId{Constants::MovieFileSearcherProgressMessageId},
+    m_aborted{false},
+    m_libraryWatcher{new MovieLibraryWatcher(this)}
 {
+    connect(this,
+        &MovieFileSearcher::moviesBatchLoaded,
+        this,
+        &MovieFileSearcher::onMoviesBatchLoaded,
+        Qt::QueuedConnection);
+    connect(
+        this, &MovieFileSearcher::workerFinished, this, &MovieFileSearcher::onWorkerFinished, Qt::QueuedConnection);
+}
+
+MovieFileSearcher::~MovieFileSearcher()
+{
+    m_aborted = true;
+    m_worker.waitForFinished();
 }
 
 void MovieFileSearcher::reload(bool force)
 {
+    // Only one scan at a time. Deliver pending batches of a previous scan while
+    // m_aborted is still set so that they are discarded.
+    m_aborted = true;
+    m_worker.waitForFinished();
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+    m_libraryWatcher->stop();
+
     m_aborted = false;
     emit searchStarted(tr("Searching for Movies..."));
 
@@ -32,53 +93,123 @@ void MovieFileSearcher::reload(bool force)
     }
 
     Manager::instance()->movieModel()->clear();
-    m_lastModifications.clear();
 
-    QVector<MovieContents> moviesContent;
+    // The database can only be used from the GUI thread: Decide which directories have to be
+    // scanned and read all others from the cache before the worker is started.
+    QVector<SettingsDir> directoriesToScan;
     QVector<Movie*> dbMovies;
-    QStringList bluRays;
-    QStringList dvds;
-    int movieSum = 0;
+    for (const auto& movieDir : m_directories) {
+        const QString path = movieDir.path.path();
+        if (!movieDir.autoReload && !force) {
+            QVector<Movie*> moviesFromDb = Manager::instance()->database()->moviesInDirectory(path);
+            if (!moviesFromDb.isEmpty()) {
+                dbMovies.append(moviesFromDb);
+                continue;
+            }
+        }
+        Manager::instance()->database()->clearMoviesInDirectory(path);
+        directoriesToScan.append(movieDir);
+    }
 
     emit progress(0, 0, m_progressMessageId);
 
-    for (const auto& movieDir : m_directories) {
+    m_worker = QtConcurrent::run(this, &MovieFileSearcher::loadMovies, directoriesToScan, dbMovies);
+}
+
+void MovieFileSearcher::loadMovies(QVector<SettingsDir> directoriesToScan, QVector<Movie*> dbMovies)
+{
+    m_lastModifications.clear();
+
+    // Used for NFO, artwork and subtitle lookups of all scanned movies (see KodiXml).
+    DirectoryListingCache listingCache;
+    DirectoryListingCache::Scope listingCacheScope(listingCache);
+
+    QVector<MovieContents> moviesContent;
+    DiscStructureIndex bluRays;
+    DiscStructureIndex dvds;
+    int movieSum = dbMovies.count();
+
+    for (const auto& movieDir : directoriesToScan) {
         if (m_aborted) {
+            emit workerFinished();
             return;
         }
-        movieSum += loadMoviesFromDirectory(movieDir, force, moviesContent, dbMovies, bluRays, dvds);
+        movieSum += loadMoviesFromDirectory(movieDir, moviesContent, bluRays, dvds);
     }
 
     emit searchStarted(tr("Loading Movies..."));
 
     qDebug() << "Now processing files";
     int movieCounter = 0;
-    QVector<Movie*> movies = loadAndStoreMoviesContents(moviesContent, bluRays, dvds, movieSum, movieCounter);
+    loadMoviesContents(moviesContent, bluRays, dvds, listingCache, movieSum, movieCounter);
     if (m_aborted) {
+        emit workerFinished();
         return;
     }
     emit currentDir("");
 
+    BatchCollector<Movie*> collector([&](QVector<Movie*> movies) {
+        movieCounter += movies.count();
+        emit currentDir(movies.last()->name());
+        emit moviesBatchLoaded(movies, QString(), false);
+        emit progress(movieCounter, movieSum, m_progressMessageId);
+    });
+
+    // Movies from the database already live in the GUI thread. Loading their
+    // NFO data in parallel is fine, though.
     QtConcurrent::blockingMapped(dbMovies, MovieFileSearcher::loadMovieData);
 
     for (Movie* movie : dbMovies) {
         if (m_aborted) {
-            return;
+            break;
         }
-        movies.append(movie);
-        if (movieCounter % 20 == 0) {
-            emit currentDir(movie->name());
+        collector.add(movie);
+    }
+    collector.flush();
+
+    emit workerFinished();
+}
+
+void MovieFileSearcher::onMoviesBatchLoaded(QVector<Movie*> movies, QString directory, bool storeInDatabase)
+{
+    ELCH_TRACE_SCOPE("scan", "Store movie batch", directory);
+    if (m_aborted) {
+        for (Movie* movie : movies) {
+            movie->deleteLater();
         }
-        emit progress(++movieCounter, movieSum, m_progressMessageId);
+        return;
     }
 
-    for (Movie* movie : movies) {
-        Manager::instance()->movieModel()->addMovie(movie);
+    if (storeInDatabase) {
+        Database* database = Manager::instance()->database();
+        database->transaction();
+        for (Movie* movie : movies) {
+            movie->setParent(this);
+            movie->setLabel(database->getLabel(movie->files()));
+            database->add(movie, directory);
+        }
+        database->commit();
     }
 
-    if (!m_aborted) {
-        emit moviesLoaded();
+    Manager::instance()->movieModel()->addMovies(movies);
+}
+
+void MovieFileSearcher::onWorkerFinished()
+{
+    if (m_aborted) {
+        return;
+    }
+    if (Settings::instance()->advanced()->watchLibrary()) {
+        m_libraryWatcher->start(m_directories);
     }
+    emit moviesLoaded();
+}
+
+void MovieFileSearcher::moveToSearcherThread(Movie* movie)
+{
+    // Movies created in the worker thread have no parent so that they can be moved
+    // to the GUI thread. The parent is set once the batch arrives there.
+    movie->moveToThread(thread());
 }
 
 Movie* MovieFileSearcher::loadMovieData(Movie* movie)
@@ -112,7 +243,6 @@ void MovieFileSearcher::scanDir(QString startPath,
     bool separateFolders,
     bool firstScan)
 {
-    m_aborted = false;
     emit currentDir(path.mid(startPath.length()));
 
     QDir dir(path);
@@ -189,39 +319,15 @@ void MovieFileSearcher::scanDir(QString startPath,
     }
 
     /* detect movies with multiple files*/
-    QRegExp rx("([\\-_\\s\\.\\(\\)]+((a|b|c|d|e|f)|((part|cd|xvid)"
-               "[\\-_\\s\\.\\(\\)]*\\d+))[\\-_\\s\\.\\(\\)]+)",
-        Qt::CaseInsensitive);
-    for (int i = 0, n = files.size(); i < n; i++) {
+    for (const QStringList& group : groupMultiPartFiles(files)) {
         if (m_aborted) {
             return;
         }
-
         QStringList movieFiles;
-        QString file = files.at(i);
-        if (file.isEmpty()) {
-            continue;
-        }
-
-        movieFiles << QDir::toNativeSeparators(path + QDir::separator() + file);
-
-        int pos = rx.lastIndexIn(file);
-        if (pos != -1) {
-            QString left = file.left(pos);
-            QString right = file.mid(pos + rx.cap(0).size());
-            for (int x = 0; x < n; x++) {
-                QString subFile = files.at(x);
-                if (subFile != file) {
-                    if (subFile.startsWith(left) && subFile.endsWith(right)) {
-                        movieFiles << QDir::toNativeSeparators(path + QDir::separator() + subFile);
-                        files[x] = ""; // set an empty file name, this way we can skip this file in the main loop
-                    }
-                }
-            }
-        }
-        if (movieFiles.count() > 0) {
-            contents.append(movieFiles);
+        for (const QString& file : group) {
+            movieFiles << QDir::toNativeSeparators(path + QDir::separator() + file);
         }
+        contents.append(movieFiles);
     }
 }
 
@@ -240,28 +346,15 @@ QStringList MovieFileSearcher::getFiles(QString path)
 }
 
 int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
-    bool force,
     QVector<MovieContents>& moviesContent,
-    QVector<Movie*>& dbMovies,
-    QStringList& bluRays,
-    QStringList& dvds)
+    DiscStructureIndex& bluRays,
+    DiscStructureIndex& dvds)
 {
+    ELCH_TRACE_SCOPE("scan", "Scan movie directory", movieDir.path.path());
     QString path = movieDir.path.path();
     int movieSum = 0;
 
-    QVector<Movie*> moviesFromDb;
-    if (!movieDir.autoReload && !force) {
-        moviesFromDb = Manager::instance()->database()->moviesInDirectory(path);
-    }
-
-    if (!movieDir.autoReload && !force && moviesFromDb.count() != 0) {
-        dbMovies.append(moviesFromDb);
-        return moviesFromDb.count();
-    }
-
     emit currentDir(path);
-    QApplication::processEvents();
-    Manager::instance()->database()->clearMoviesInDirectory(path);
     QMap<QString, QStringList> contents;
     // No filter, no media files...
     if (!Settings::instance()->advanced()->movieFilters().hasFilter()) {
@@ -269,6 +362,12 @@ int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
     }
 
     qDebug() << "Scanning directory: " << movieDir.path;
+
+    // Exclude patterns, extras and special folders are checked in a single pass per name.
+    FileNameMatcher matcher = Settings::instance()->advanced()->excludeMatcher();
+    addMovieFileRules(matcher);
+    matcher.compile();
+
     QString lastDir;
     QDirIterator it(path,
         Settings::instance()->advanced()->movieFilters().filters(),
@@ -288,46 +387,16 @@ int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
         const bool isDir = it.fileInfo().isDir();
         bool isSpecialDir = false; // set to true for DVD or BluRay Structure
 
-        if (isFile && Settings::instance()->advanced()->isFileExcluded(fileName)) {
-            continue;
-        }
-        if (isDir && Settings::instance()->advanced()->isFolderExcluded(dirName)) {
+        if (isFile && matcher.matchFile(fileName).hasMatch()) {
             continue;
         }
-
-        // Skips Extras files
-        if (fileName.contains("-trailer", Qt::CaseInsensitive)            //
-            || fileName.contains("-sample", Qt::CaseInsensitive)          //
-            || fileName.contains("-behindthescenes", Qt::CaseInsensitive) //
-            || fileName.contains("-deleted", Qt::CaseInsensitive)         //
-            || fileName.contains("-featurette", Qt::CaseInsensitive)      //
-            || fileName.contains("-interview", Qt::CaseInsensitive)       //
-            || fileName.contains("-scene", Qt::CaseInsensitive)           //
-            || fileName.contains("-short", Qt::CaseInsensitive)) {
+        if (isDir
+            && (matcher.matchFolder(dirName).hasMatch()
+                || matcher.matchFolder(fileName).rule == FileNameMatcher::Rule::MovieExtra)) {
             continue;
         }
 
         if (isDir) {
-            // Skip actors folder
-            if (QString::compare(".actors", dirName, Qt::CaseInsensitive) == 0) {
-                continue;
-            }
-
-            // Skip extras folder
-            if (QString::compare("extras", dirName, Qt::CaseInsensitive) == 0) {
-                continue;
-            }
-
-            // Skip extra fanarts folder
-            if (QString::compare("extrafanart", dirName, Qt::CaseInsensitive) == 0) {
-                continue;
-            }
-
-            // Skip extra thumbs folder
-            if (QString::compare("extrathumbs", dirName, Qt::CaseInsensitive) == 0) {
-                continue;
-            }
-
             // Skip BluRay backup folder
             if (QString::compare("backup", dirName, Qt::CaseInsensitive) == 0
                 && QString::compare("index.bdmv", fileName, Qt::CaseInsensitive) == 0) {
@@ -348,7 +417,7 @@ int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
             if (QString::compare(bluRayDir.dirName(), "BDMV", Qt::CaseInsensitive) == 0) {
                 bluRayDir.cdUp();
             }
-            bluRays << bluRayDir.path();
+            bluRays.addDirectory(bluRayDir.path());
             isSpecialDir = true;
         }
         if (isDir && QString::compare("VIDEO_TS.IFO", fileName, Qt::CaseInsensitive) == 0) {
@@ -357,7 +426,7 @@ int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
             if (QString::compare(videoDir.dirName(), "VIDEO_TS", Qt::CaseInsensitive) == 0) {
                 videoDir.cdUp();
             }
-            dvds << videoDir.path();
+            dvds.addDirectory(videoDir.path());
             isSpecialDir = true;
         }
 
@@ -379,20 +448,29 @@ int MovieFileSearcher::loadMoviesFromDirectory(const SettingsDir& movieDir,
     return contents.count();
 }
 
-QVector<Movie*> MovieFileSearcher::loadAndStoreMoviesContents(QVector<MovieFileSearcher::MovieContents>& moviesContent,
-    QStringList& bluRays,
-    QStringList& dvds,
-    int& movieSum,
+void MovieFileSearcher::loadMoviesContents(QVector<MovieFileSearcher::MovieContents>& moviesContent,
+    DiscStructureIndex& bluRays,
+    DiscStructureIndex& dvds,
+    DirectoryListingCache& listingCache,
+    int movieSum,
     int& movieCounter)
 {
-    QVector<Movie*> movies;
+    ELCH_TRACE_SCOPE("scan", "Create movies");
+    // Subtitles of a directory are shared by all movies in that directory.
+    QHash<QString, QVector<QStringList>> subtitlesInDirectory;
+
     for (const MovieContents& con : moviesContent) {
-        Manager::instance()->database()->transaction();
+        // All movies of a batch belong to the same movie directory.
+        BatchCollector<Movie*> collector([&](QVector<Movie*> movies) {
+            emit moviesBatchLoaded(movies, con.path, true);
+            emit progress(movieCounter, movieSum, m_progressMessageId);
+        });
+
         QMapIterator<QString, QStringList> itContents(con.contents);
         while (itContents.hasNext()) {
             if (m_aborted) {
-                Manager::instance()->database()->commit();
-                return movies;
+                collector.flush();
+                return;
             }
             itContents.next();
             QStringList files = itContents.value();
@@ -400,35 +478,29 @@ QVector<Movie*> MovieFileSearcher::loadAndStoreMoviesContents(QVector<MovieFileS
             DiscType discType = DiscType::Single;
 
             // BluRay handling
-            for (const QString& path : bluRays) {
-                if (!files.isEmpty()
-                    && (files.first().startsWith(path + "/") || files.first().startsWith(path + "\\"))) {
-                    QStringList f;
-                    for (const QString& file : files) {
-                        if (file.endsWith("index.bdmv", Qt::CaseInsensitive)) {
-                            f.append(file);
-                        }
+            if (!files.isEmpty() && bluRays.containsFile(files.first())) {
+                QStringList f;
+                for (const QString& file : files) {
+                    if (file.endsWith("index.bdmv", Qt::CaseInsensitive)) {
+                        f.append(file);
                     }
-                    files = f;
-                    discType = DiscType::BluRay;
-                    qDebug() << "It's a BluRay structure";
                 }
+                files = f;
+                discType = DiscType::BluRay;
+                qDebug() << "It's a BluRay structure";
             }
 
             // DVD handling
-            for (const QString& path : dvds) {
-                if (!files.isEmpty()
-                    && (files.first().startsWith(path + "/") || files.first().startsWith(path + "\\"))) {
-                    QStringList f;
-                    for (const QString& file : files) {
-                        if (file.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
-                            f.append(file);
-                        }
+            if (!files.isEmpty() && dvds.containsFile(files.first())) {
+                QStringList f;
+                for (const QString& file : files) {
+                    if (file.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
+                        f.append(file);
                     }
-                    files = f;
-                    discType = DiscType::Dvd;
-                    qDebug() << "It's a DVD structure";
                 }
+                files = f;
+                discType = DiscType::Dvd;
+                qDebug() << "It's a DVD structure";
             }
 
             if (files.isEmpty()) {
@@ -438,31 +510,28 @@ QVector<Movie*> MovieFileSearcher::loadAndStoreMoviesContents(QVector<MovieFileS
             if (files.count() == 1 || con.inSeparateFolder) {
                 // single file or in separate folder
                 files.sort();
-                auto* movie = new Movie(files, this);
+                auto* movie = new Movie(files);
                 movie->setInSeparateFolder(con.inSeparateFolder);
                 movie->setFileLastModified(m_lastModifications.value(files.at(0)));
                 movie->setDiscType(discType);
-                movie->setLabel(Manager::instance()->database()->getLabel(movie->files()));
                 movie->setChanged(false);
                 movie->controller()->loadData(Manager::instance()->mediaCenterInterface());
                 if (discType == DiscType::Single) {
                     QFileInfo mFi(files.first());
-                    for (const QFileInfo& subFi : mFi.dir().entryInfoList(
-                             QStringList{"*.sub", "*.srt", "*.smi", "*.ssa"}, QDir::Files | QDir::NoDotAndDotDot)) {
-                        QString subFileName = subFi.fileName().mid(mFi.completeBaseName().length() + 1);
+                    const QString movieDir = mFi.absolutePath();
+                    auto subtitlesIt = subtitlesInDirectory.constFind(movieDir);
+                    if (subtitlesIt == subtitlesInDirectory.constEnd()) {
+                        subtitlesIt =
+                            subtitlesInDirectory.insert(movieDir, subtitleFiles(listingCache.listing(movieDir)));
+                    }
+                    for (const QStringList& subFiles : subtitlesIt.value()) {
+                        QString subFileName = subFiles.first().mid(mFi.completeBaseName().length() + 1);
                         QStringList parts = subFileName.split(QRegExp(R"(\s+|\-+|\.+)"));
                         if (parts.isEmpty()) {
                             continue;
                         }
                         parts.takeLast();
 
-                        QStringList subFiles = QStringList() << subFi.fileName();
-                        if (QString::compare(subFi.suffix(), "sub", Qt::CaseInsensitive) == 0) {
-                            QFileInfo subIdxFi(subFi.absolutePath() + "/" + subFi.completeBaseName() + ".idx");
-                            if (subIdxFi.exists()) {
-                                subFiles << subIdxFi.fileName();
-                            }
-                        }
                         auto subtitle = new Subtitle(movie);
                         subtitle->setFiles(subFiles);
                         if (parts.contains("forced", Qt::CaseInsensitive)) {
@@ -476,48 +545,27 @@ QVector<Movie*> MovieFileSearcher::loadAndStoreMoviesContents(QVector<MovieFileS
                         movie->addSubtitle(subtitle, true);
                     }
                 }
-                Manager::instance()->database()->add(movie, con.path);
-                movies.append(movie);
-                // emit currentDir(movie->name());
+                moveToSearcherThread(movie);
+                collector.add(movie);
             } else {
-                QMap<QString, QStringList> stacked;
-                while (!files.isEmpty()) {
-                    QString file = files.takeLast();
-                    QString stackedBase = helper::stackedBaseName(file);
-                    stacked.insert(stackedBase, QStringList() << file);
-                    for (const QString& f : files) {
-                        if (helper::stackedBaseName(f) == stackedBase) {
-                            stacked[stackedBase].append(f);
-                            files.removeOne(f);
-                        }
-                    }
-                }
-                QMapIterator<QString, QStringList> it(stacked);
-                while (it.hasNext()) {
-                    it.next();
-                    if (it.value().isEmpty()) {
-                        continue;
-                    }
-                    QStringList stackedFiles = it.value();
+                for (const QStringList& group : groupStackedFiles(files)) {
+                    QStringList stackedFiles = group;
                     stackedFiles.sort();
-                    auto* movie = new Movie(stackedFiles, this);
+                    auto* movie = new Movie(stackedFiles);
                     movie->setInSeparateFolder(con.inSeparateFolder);
-                    movie->setFileLastModified(m_lastModifications.value(it.value().at(0)));
+                    movie->setFileLastModified(m_lastModifications.value(group.at(0)));
                     movie->controller()->loadData(Manager::instance()->mediaCenterInterface());
-                    movie->setLabel(Manager::instance()->database()->getLabel(movie->files()));
-                    Manager::instance()->database()->add(movie, con.path);
-                    movies.append(movie);
-                    // emit currentDir(movie->name());
+                    moveToSearcherThread(movie);
+                    collector.add(movie);
                 }
             }
-            emit progress(++movieCounter, movieSum, m_progressMessageId);
+            ++movieCounter;
             if (movieCounter % 20 == 0) {
                 emit currentDir("");
             }
         }
-        Manager::instance()->database()->commit();
+        collector.flush();
     }
-    return movies;
 }
 
 void MovieFileSearcher::abort()
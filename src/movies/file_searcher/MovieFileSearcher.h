@@ -1,18 +1,28 @@
 #pragma once
 
+#include "file/DirectoryListingCache.h"
 #include "movies/Movie.h"
+#include "movies/file_searcher/MovieFileGrouping.h"
 
 #include <QDir>
+#include <QFuture>
 #include <QHash>
 #include <QObject>
 #include <QTime>
 #include <QVector>
+#include <atomic>
 #include <memory>
 
 namespace mediaelch {
 
+class MovieLibraryWatcher;
+
 /// \brief Class responsible for (re-)loading all movies inside given directories.
 ///
+/// Directories are scanned and NFO files are loaded in a worker thread. Fully loaded
+/// movies are handed to the GUI thread in batches which are stored in the database and
+/// added to the movie model. moviesLoaded() is emitted once all batches were delivered.
+///
 /// \par Example
 /// \code{cpp}
 ///   MovieFileSearcher searcher;
@@ -23,7 +33,7 @@ class MovieFileSearcher : public QObject
     Q_OBJECT
 public:
     explicit MovieFileSearcher(QObject* parent = nullptr);
-    ~MovieFileSearcher() override = default;
+    ~MovieFileSearcher() override;
 
     /// \brief Sets the directories to scan for movies. Not readable directories are skipped.
     void setMovieDirectories(const QVector<SettingsDir>& directories);
@@ -45,6 +55,7 @@ public:
         bool firstScan = false);
 
 public slots:
+    /// \brief Starts (re-)loading all movies. Returns immediately; the scan runs in a worker thread.
     void reload(bool force);
     void abort();
 
@@ -54,6 +65,17 @@ signals:
     void moviesLoaded();
     void currentDir(QString);
 
+    /// \brief Emitted by the worker thread for each batch of loaded movies.
+    /// If storeInDatabase is true, the movies were read from disk and are not yet
+    /// stored in the database. Internal signal, don't connect to it.
+    void moviesBatchLoaded(QVector<Movie*> movies, QString directory, bool storeInDatabase);
+    /// \brief Emitted by the worker thread after the last batch. Internal signal.
+    void workerFinished();
+
+private slots:
+    void onMoviesBatchLoaded(QVector<Movie*> movies, QString directory, bool storeInDatabase);
+    void onWorkerFinished();
+
 private:
     struct MovieContents
     {
@@ -66,22 +88,30 @@ private:
 
     QStringList getFiles(QString path);
 
+    /// \brief Entry point of the worker thread.
+    void loadMovies(QVector<SettingsDir> directoriesToScan, QVector<Movie*> dbMovies);
+
     int loadMoviesFromDirectory(const SettingsDir& movieDir,
-        bool force,
         QVector<MovieContents>& moviesContent,
-        QVector<Movie*>& dbMovies,
-        QStringList& bluRays,
-        QStringList& dvds);
-    QVector<Movie*> loadAndStoreMoviesContents(QVector<MovieContents>& moviesContent,
-        QStringList& bluRays,
-        QStringList& dvds,
-        int& movieSum,
+        DiscStructureIndex& bluRays,
+        DiscStructureIndex& dvds);
+    void loadMoviesContents(QVector<MovieContents>& moviesContent,
+        DiscStructureIndex& bluRays,
+        DiscStructureIndex& dvds,
+        DirectoryListingCache& listingCache,
+        int movieSum,
         int& movieCounter);
 
+    /// \brief Moves a movie created in the worker thread to the searcher's thread.
+    void moveToSearcherThread(Movie* movie);
+
     QVector<SettingsDir> m_directories;
     int m_progressMessageId;
     QHash<QString, QDateTime> m_lastModifications;
-    bool m_aborted;
+    std::atomic<bool> m_aborted;
+    QFuture<void> m_worker;
+    /// Applies changes in the movie directories after a reload, see AdvancedSettings::watchLibrary().
+    MovieLibraryWatcher* m_libraryWatcher;
 };
 
 } // namespace mediaelch
@@ -0,0 +1,258 @@
+#include "movies/file_searcher/MovieLibraryWatcher.h"
+
+#include "data/Database.h"
+#include "file/InotifyWatcher.h"
+#include "globals/Manager.h"
+#include "movies/Movie.h"
+#include "movies/MovieModel.h"
+#include "movies/file_searcher/MovieFileGrouping.h"
+#include "settings/Settings.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QSet>
+
+namespace mediaelch {
+
+namespace {
+
+bool isInDirectory(const QString& path, const QString& directory)
+{
+    return path.startsWith(directory)
+           && (path.size() == directory.size() || path.at(directory.size()) == '/' || directory.endsWith('/'));
+}
+
+/// Directories that never contain movies themselves, see MovieFileSearcher.
+bool isSkippedDirectory(const QString& directory, const FileNameMatcher& matcher)
+{
+    if (matcher.matchFolder(QDir(directory).dirName()).hasMatch()) {
+        return true;
+    }
+    // Disc structures are only detected by a full reload.
+    for (const QString& part : directory.split('/')) {
+        if (QString::compare(part, "BDMV", Qt::CaseInsensitive) == 0
+            || QString::compare(part, "VIDEO_TS", Qt::CaseInsensitive) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+QSet<QString> MovieFileChanges::changedDirectories() const
+{
+    QSet<QString> directories;
+    for (auto it = newFiles.constBegin(); it != newFiles.constEnd(); ++it) {
+        directories.insert(it.key());
+    }
+    for (const QString& file : removedFiles) {
+        directories.insert(file.left(file.lastIndexOf('/')));
+    }
+    return directories;
+}
+
+MovieFileChanges findMovieFileChanges(const QStringList& directories,
+    const QSet<QString>& knownFiles,
+    const FileFilter& filter,
+    const FileNameMatcher& matcher)
+{
+    MovieFileChanges changes;
+
+    // A removed file changes its own directory; removed or moved directories are
+    // reported with all of their subdirectories, see InotifyWatcher.
+    QSet<QString> changedDirectories;
+    for (const QString& directory : directories) {
+        changedDirectories.insert(directory);
+    }
+    for (const QString& file : knownFiles) {
+        if (changedDirectories.contains(file.left(file.lastIndexOf('/'))) && !QFileInfo::exists(file)) {
+            changes.removedFiles.append(file);
+        }
+    }
+
+    for (const QString& directory : directories) {
+        const QDir dir(directory);
+        if (isSkippedDirectory(directory, matcher) || !dir.exists()) {
+            continue;
+        }
+        QStringList files;
+        for (const QString& fileName : filter.files(dir)) {
+            const QString path = dir.absoluteFilePath(fileName);
+            if (!knownFiles.contains(path) && !matcher.matchFile(fileName).hasMatch()) {
+                files.append(path);
+            }
+        }
+        if (!files.isEmpty()) {
+            changes.newFiles.insert(dir.absolutePath(), files);
+        }
+    }
+    return changes;
+}
+
+MovieLibraryWatcher::MovieLibraryWatcher(QObject* parent) : QObject(parent), m_watcher{new InotifyWatcher(this)}
+{
+    connect(m_watcher, &InotifyWatcher::sigDirectoriesChanged, this, &MovieLibraryWatcher::onDirectoriesChanged);
+}
+
+bool MovieLibraryWatcher::start(const QVector<SettingsDir>& directories)
+{
+    stop();
+    if (!InotifyWatcher::isSupported()) {
+        qInfo() << "[MovieLibraryWatcher] Watching movie directories is not supported on this system";
+        return false;
+    }
+
+    for (const SettingsDir& directory : directories) {
+        if (m_watcher->watchTree(directory.path.absolutePath())) {
+            m_directories.append(directory);
+        }
+    }
+    qInfo() << "[MovieLibraryWatcher] Watching" << m_directories.count() << "movie directories";
+    return !m_directories.isEmpty();
+}
+
+void MovieLibraryWatcher::stop()
+{
+    m_watcher->clear();
+    m_directories.clear();
+}
+
+void MovieLibraryWatcher::onDirectoriesChanged(QStringList directories)
+{
+    qDebug() << "[MovieLibraryWatcher] Changed directories:" << directories.count();
+
+    const AdvancedSettings* advanced = Settings::instance()->advanced();
+    if (!advanced->movieFilters().hasFilter()) {
+        return;
+    }
+    QStringList movieDirectories;
+    for (const QString& directory : directories) {
+        if (movieDirectory(directory) != nullptr) {
+            movieDirectories.append(directory);
+        }
+    }
+
+    QSet<QString> knownFiles;
+    for (Movie* movie : Manager::instance()->movieModel()->movies()) {
+        for (const FilePath& file : movie->files()) {
+            knownFiles.insert(file.toString());
+        }
+    }
+
+    // Same rules as MovieFileSearcher, checked in a single pass per name.
+    FileNameMatcher matcher = advanced->excludeMatcher();
+    addMovieFileRules(matcher);
+    matcher.compile();
+
+    const MovieFileChanges changes =
+        findMovieFileChanges(movieDirectories, knownFiles, advanced->movieFilters(), matcher);
+    const int removed = removeMissingMovies(changes.removedFiles);
+    const int added = addNewMovies(changes.newFiles);
+    if (removed > 0 || added > 0) {
+        qInfo() << "[MovieLibraryWatcher] Added" << added << "and removed" << removed << "movies";
+        emit sigLibraryChanged(added, removed);
+    }
+}
+
+const SettingsDir* MovieLibraryWatcher::movieDirectory(const QString& directory) const
+{
+    for (const SettingsDir& movieDir : m_directories) {
+        if (isInDirectory(directory, movieDir.path.absolutePath())) {
+            return &movieDir;
+        }
+    }
+    return nullptr;
+}
+
+int MovieLibraryWatcher::removeMissingMovies(const QStringList& removedFiles)
+{
+    if (removedFiles.isEmpty()) {
+        return 0;
+    }
+    QSet<QString> removed;
+    for (const QString& file : removedFiles) {
+        removed.insert(file);
+    }
+    QVector<Movie*> removedMovies;
+    for (Movie* movie : Manager::instance()->movieModel()->movies()) {
+        if (!movie->files().isEmpty() && removed.contains(movie->files().first().toString())) {
+            removedMovies.append(movie);
+        }
+    }
+    if (removedMovies.isEmpty()) {
+        return 0;
+    }
+
+    Database* database = Manager::instance()->database();
+    database->transaction();
+    for (Movie* movie : removedMovies) {
+        database->remove(movie);
+    }
+    database->commit();
+    Manager::instance()->movieModel()->removeMovies(removedMovies);
+    return removedMovies.count();
+}
+
+int MovieLibraryWatcher::addNewMovies(const QMap<QString, QStringList>& newFiles)
+{
+    if (newFiles.isEmpty()) {
+        return 0;
+    }
+
+    QSet<QString> directoriesWithMovies;
+    for (Movie* movie : Manager::instance()->movieModel()->movies()) {
+        if (!movie->files().isEmpty()) {
+            directoriesWithMovies.insert(QFileInfo(movie->files().first().toString()).absolutePath());
+        }
+    }
+
+    QVector<Movie*> newMovies;
+    QVector<QString> movieDirectories;
+    for (auto it = newFiles.constBegin(); it != newFiles.constEnd(); ++it) {
+        const SettingsDir* movieDir = movieDirectory(it.key());
+        if (movieDir == nullptr) {
+            continue;
+        }
+
+        QVector<QStringList> groups;
+        if (movieDir->separateFolders) {
+            // A new file next to an existing movie is most likely a part of it.
+            if (directoriesWithMovies.contains(it.key())) {
+                continue;
+            }
+            groups.append(it.value());
+        } else {
+            groups = groupStackedFiles(it.value());
+        }
+
+        for (QStringList group : groups) {
+            group.sort();
+            auto* movie = new Movie(group, Manager::instance()->movieFileSearcher());
+            movie->setInSeparateFolder(movieDir->separateFolders);
+            movie->setFileLastModified(QFileInfo(group.first()).lastModified());
+            movie->setDiscType(DiscType::Single);
+            movie->setChanged(false);
+            movie->controller()->loadData(Manager::instance()->mediaCenterInterface());
+            newMovies.append(movie);
+            movieDirectories.append(movieDir->path.path());
+        }
+    }
+    if (newMovies.isEmpty()) {
+        return 0;
+    }
+
+    Database* database = Manager::instance()->database();
+    database->transaction();
+    for (int i = 0; i < newMovies.count(); ++i) {
+        Movie* movie = newMovies[i];
+        movie->setLabel(database->getLabel(movie->files()));
+        database->add(movie, movieDirectories[i]);
+    }
+    database->commit();
+    Manager::instance()->movieModel()->addMovies(newMovies);
+    return newMovies.count();
+}
+
+} // namespace mediaelch
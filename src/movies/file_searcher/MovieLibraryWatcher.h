@@ -0,0 +1,76 @@
+#pragma once
+
+#include "file/FileFilter.h"
+#include "file/FileNameMatcher.h"
+#include "globals/Globals.h"
+
+#include <QMap>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+class Movie;
+
+namespace mediaelch {
+
+class InotifyWatcher;
+
+/// \brief Movie files that were added to or removed from changed directories, see findMovieFileChanges().
+struct MovieFileChanges
+{
+    /// New movie files by their absolute directory path. Excluded files and extras are not included.
+    QMap<QString, QStringList> newFiles;
+    /// Known files in the changed directories that don't exist anymore.
+    QStringList removedFiles;
+
+    /// \brief Directories that have new or removed movie files.
+    QSet<QString> changedDirectories() const;
+};
+
+/// \brief Compares the changed directories with the known movie files.
+///
+/// Files are filtered like MovieFileSearcher does: the matcher should contain the user's
+/// exclude rules and the rules of addMovieFileRules(). Skipped directories, e.g. ".actors"
+/// or disc structures, never have new files.
+MovieFileChanges findMovieFileChanges(const QStringList& directories,
+    const QSet<QString>& knownFiles,
+    const FileFilter& filter,
+    const FileNameMatcher& matcher);
+
+/// \brief Keeps the movie library up to date without rescanning the movie directories.
+///
+/// Watches all movie directories (see InotifyWatcher) and applies changes to the
+/// database and the movie model:
+///  - movies whose files were removed are removed,
+///  - new movie files create new movies.
+/// A renamed or moved movie is removed and added again, i.e. its NFO file is read again.
+///
+/// DVD and BluRay structures and new files in directories that already contain a
+/// movie in "separate folders" mode are left to the next full reload.
+class MovieLibraryWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    explicit MovieLibraryWatcher(QObject* parent = nullptr);
+
+    /// \brief Starts watching the directories. Returns false if watching is not supported.
+    bool start(const QVector<SettingsDir>& directories);
+    void stop();
+
+signals:
+    void sigLibraryChanged(int added, int removed);
+
+private slots:
+    void onDirectoriesChanged(QStringList directories);
+
+private:
+    const SettingsDir* movieDirectory(const QString& directory) const;
+    int removeMissingMovies(const QStringList& removedFiles);
+    int addNewMovies(const QMap<QString, QStringList>& newFiles);
+
+    InotifyWatcher* m_watcher;
+    QVector<SettingsDir> m_directories;
+};
+
+} // namespace mediaelch
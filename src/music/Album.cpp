@@ -215,18 +215,18 @@ void Album::addImage(ImageType imageType, Poster image)
 
 QByteArray Album::rawImage(ImageType imageType)
 {
-    return m_rawImages.value(imageType);
+    return m_rawImages.value(imageType).data();
 }
 
 void Album::setRawImage(ImageType imageType, QByteArray image)
 {
-    m_rawImages.insert(imageType, image);
+    m_rawImages.insert(imageType, mediaelch::ImageBlob(image));
     setHasChanged(true);
 }
 
 void Album::removeImage(ImageType imageType)
 {
-    if (!m_rawImages.value(imageType, QByteArray()).isNull()) {
+    if (!m_rawImages.value(imageType).isNull()) {
         m_rawImages.remove(imageType);
     } else if (!m_imagesToRemove.contains(imageType)) {
         m_imagesToRemove.append(imageType);
@@ -297,14 +297,14 @@ void Album::clear(QSet<MusicScraperInfo> infos)
             m_images.insert(ImageType::AlbumThumb, QVector<Poster>());
         }
         m_images[ImageType::AlbumThumb].clear();
-        m_rawImages.insert(ImageType::AlbumThumb, QByteArray());
+        m_rawImages.insert(ImageType::AlbumThumb, mediaelch::ImageBlob());
     }
     if (infos.contains(MusicScraperInfo::CdArt)) {
         if (!m_images.contains(ImageType::AlbumCdArt)) {
             m_images.insert(ImageType::AlbumCdArt, QVector<Poster>());
         }
         m_images[ImageType::AlbumCdArt].clear();
-        m_rawImages.insert(ImageType::AlbumCdArt, QByteArray());
+        m_rawImages.insert(ImageType::AlbumCdArt, mediaelch::ImageBlob());
     }
 }
 
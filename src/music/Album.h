@@ -1,5 +1,6 @@
 #pragma once
 
+#include "data/ImageBlob.h"
 #include "globals/Globals.h"
 #include "globals/Poster.h"
 #include "image/ImageModel.h"
@@ -132,7 +133,7 @@ private:
     qreal m_rating;
     int m_year;
     QMap<ImageType, QVector<Poster>> m_images;
-    QMap<ImageType, QByteArray> m_rawImages;
+    QMap<ImageType, mediaelch::ImageBlob> m_rawImages;
     QVector<ImageType> m_imagesToRemove;
     MusicModelItem* m_modelItem;
     QString m_nfoContent;
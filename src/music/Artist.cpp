@@ -198,18 +198,18 @@ void Artist::addImage(ImageType imageType, Poster image)
 
 QByteArray Artist::rawImage(ImageType imageType)
 {
-    return m_rawImages.value(imageType);
+    return m_rawImages.value(imageType).data();
 }
 
 void Artist::setRawImage(ImageType imageType, QByteArray image)
 {
-    m_rawImages.insert(imageType, image);
+    m_rawImages.insert(imageType, mediaelch::ImageBlob(image));
     setHasChanged(true);
 }
 
 void Artist::removeImage(ImageType imageType)
 {
-    if (!m_rawImages.value(imageType, QByteArray()).isNull()) {
+    if (!m_rawImages.value(imageType).isNull()) {
         m_rawImages.remove(imageType);
     } else if (!m_imagesToRemove.contains(imageType)) {
         m_imagesToRemove.append(imageType);
@@ -295,21 +295,21 @@ void Artist::clear(QSet<MusicScraperInfo> infos)
             m_images.insert(ImageType::ArtistThumb, QVector<Poster>());
         }
         m_images[ImageType::ArtistThumb].clear();
-        m_rawImages.insert(ImageType::ArtistThumb, QByteArray());
+        m_rawImages.insert(ImageType::ArtistThumb, mediaelch::ImageBlob());
     }
     if (infos.contains(MusicScraperInfo::Fanart)) {
         if (!m_images.contains(ImageType::ArtistFanart)) {
             m_images.insert(ImageType::ArtistFanart, QVector<Poster>());
         }
         m_images[ImageType::ArtistFanart].clear();
-        m_rawImages.insert(ImageType::ArtistFanart, QByteArray());
+        m_rawImages.insert(ImageType::ArtistFanart, mediaelch::ImageBlob());
     }
     if (infos.contains(MusicScraperInfo::Logo)) {
         if (!m_images.contains(ImageType::ArtistLogo)) {
             m_images.insert(ImageType::ArtistLogo, QVector<Poster>());
         }
         m_images[ImageType::ArtistLogo].clear();
-        m_rawImages.insert(ImageType::ArtistLogo, QByteArray());
+        m_rawImages.insert(ImageType::ArtistLogo, mediaelch::ImageBlob());
     }
     if (infos.contains(MusicScraperInfo::ExtraFanarts)) {
         m_extraFanartsToRemove.clear();
@@ -414,13 +414,18 @@ void Artist::setAllMusicId(const QString& allMusicId)
 
 void Artist::addExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.append(fanart);
+    m_extraFanartImagesToAdd.append(mediaelch::ImageBlob(fanart));
     setHasChanged(true);
 }
 
 void Artist::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i = 0; i < m_extraFanartImagesToAdd.size(); ++i) {
+        if (m_extraFanartImagesToAdd.at(i).hasSameData(fanart)) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setHasChanged(true);
 }
 
@@ -445,9 +450,9 @@ QVector<ExtraFanart> Artist::extraFanarts(MediaCenterInterface* mediaCenterInter
         f.path = file;
         fanarts.append(f);
     }
-    for (const QByteArray& img : m_extraFanartImagesToAdd) {
+    for (const mediaelch::ImageBlob& img : m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -460,7 +465,11 @@ QStringList Artist::extraFanartsToRemove()
 
 QVector<QByteArray> Artist::extraFanartImagesToAdd()
 {
-    return m_extraFanartImagesToAdd;
+    QVector<QByteArray> images;
+    for (const mediaelch::ImageBlob& image : m_extraFanartImagesToAdd) {
+        images.append(image.data());
+    }
+    return images;
 }
 
 void Artist::clearExtraFanartData()
@@ -2,6 +2,7 @@
 
 #include "ArtistController.h"
 #include "MusicModelItem.h"
+#include "data/ImageBlob.h"
 #include "file/Path.h"
 #include "globals/Globals.h"
 #include "globals/Poster.h"
@@ -132,7 +133,7 @@ private:
     QString m_disbanded;
     bool m_hasChanged;
     QMap<ImageType, QVector<Poster>> m_images;
-    QMap<ImageType, QByteArray> m_rawImages;
+    QMap<ImageType, mediaelch::ImageBlob> m_rawImages;
     QVector<ImageType> m_imagesToRemove;
     MusicModelItem* m_modelItem;
     QString m_nfoContent;
@@ -145,5 +146,5 @@ private:
 
     QStringList m_extraFanartsToRemove;
     QStringList m_extraFanarts;
-    QVector<QByteArray> m_extraFanartImagesToAdd;
+    QVector<mediaelch::ImageBlob> m_extraFanartImagesToAdd;
 };
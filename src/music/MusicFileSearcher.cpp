@@ -1,10 +1,12 @@
 #include "MusicFileSearcher.h"
 
+#include <QCoreApplication>
 #include <QDebug>
 #include <QDirIterator>
 #include <QFileInfo>
 #include <QtConcurrent>
 
+#include "globals/BatchCollector.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
 #include "music/Album.h"
@@ -13,6 +15,19 @@
 MusicFileSearcher::MusicFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::MusicFileSearcherProgressMessageId}, m_aborted{false}
 {
+    connect(this,
+        &MusicFileSearcher::artistsBatchLoaded,
+        this,
+        &MusicFileSearcher::onArtistsBatchLoaded,
+        Qt::QueuedConnection);
+    connect(
+        this, &MusicFileSearcher::workerFinished, this, &MusicFileSearcher::onWorkerFinished, Qt::QueuedConnection);
+}
+
+MusicFileSearcher::~MusicFileSearcher()
+{
+    m_aborted = true;
+    m_worker.waitForFinished();
 }
 
 void MusicFileSearcher::setMusicDirectories(QVector<SettingsDir> directories)
@@ -38,139 +53,166 @@ void MusicFileSearcher::setMusicDirectories(QVector<SettingsDir> directories)
 
 void MusicFileSearcher::reload(bool force)
 {
+    // Only one scan at a time. Deliver pending batches of a previous scan while
+    // m_aborted is still set so that they are discarded.
+    m_aborted = true;
+    m_worker.waitForFinished();
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+
     m_aborted = false;
 
     emit searchStarted(tr("Searching for Music..."));
     Manager::instance()->musicModel()->clear();
 
-    QVector<Artist*> artists;
-    QVector<Artist*> artistsFromDb;
-    QVector<Album*> albums;
-    QVector<Album*> albumsFromDb;
-
     if (force) {
         Manager::instance()->database()->clearAllArtists();
     }
 
-    QMap<Artist*, QString> artistPaths;
-    QMap<Album*, QString> albumPaths;
+    // The database can only be used from the GUI thread: Read all cached
+    // artists and albums before the worker is started.
+    QVector<SettingsDir> directoriesToScan;
+    QVector<Artist*> artistsFromDb;
     for (const SettingsDir& dir : m_directories) {
-        if (m_aborted) {
-            break;
-        }
-
         if (dir.autoReload) {
             Manager::instance()->database()->clearArtistsInDirectory(dir.path);
         }
 
         if (dir.autoReload || force) {
-            QDirIterator it(dir.path.path(), QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
-            while (it.hasNext()) {
-                if (m_aborted) {
-                    break;
-                }
-
-                it.next();
-
-                if (Settings::instance()->advanced()->isFolderExcluded(it.fileInfo().dir().dirName())) {
-                    continue;
-                }
-
-                emit currentDir(it.fileInfo().baseName());
-                auto* artist = new Artist(it.filePath(), this);
-                artist->setName(it.fileInfo().baseName());
-                artists.append(artist);
-                artistPaths.insert(artist, dir.path.path());
-
-                QDirIterator itAlbums(it.filePath(), QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
-                while (itAlbums.hasNext()) {
-                    itAlbums.next();
-
-                    if (Settings::instance()->advanced()->isFolderExcluded(itAlbums.fileInfo().dir().dirName())) {
-                        continue;
-                    }
-
-                    if (itAlbums.fileInfo().baseName() == "extrafanart") {
-                        continue;
-                    }
-                    if (itAlbums.fileInfo().baseName() == "extrathumbs") {
-                        continue;
-                    }
-
-                    auto* album = new Album(itAlbums.filePath(), this);
-                    album->setTitle(itAlbums.fileInfo().baseName());
-                    album->setArtistObj(artist);
-                    artist->addAlbum(album);
-                    albums.append(album);
-                    albumPaths.insert(album, dir.path.path());
-                }
-            }
+            directoriesToScan.append(dir);
         } else {
             QVector<Artist*> artistsInPath = Manager::instance()->database()->artistsInDirectory(dir.path);
             for (Artist* artist : artistsInPath) {
-                if (artistsFromDb.count() % 20 == 0) {
-                    emit currentDir(artist->path().toString().mid(dir.path.path().length()));
-                }
-                QVector<Album*> albumsOfArtist = Manager::instance()->database()->albums(artist);
+                // Adds the albums to the artist.
+                Manager::instance()->database()->albums(artist);
                 artistsFromDb.append(artist);
-                albumsFromDb.append(albumsOfArtist);
             }
         }
     }
 
+    m_worker = QtConcurrent::run(this, &MusicFileSearcher::loadMusic, directoriesToScan, artistsFromDb);
+}
+
+void MusicFileSearcher::loadMusic(QVector<SettingsDir> directoriesToScan, QVector<Artist*> dbArtists)
+{
+    for (const SettingsDir& dir : directoriesToScan) {
+        if (m_aborted) {
+            break;
+        }
+        loadArtistsFromDisk(dir);
+    }
+
     emit currentDir("");
     emit searchStarted(tr("Loading Music..."));
 
-    int current = 0;
-    int max = artists.length() + albums.length() + artistsFromDb.length() + albumsFromDb.length();
+    BatchCollector<Artist*> collector(
+        [&](QVector<Artist*> artists) { emit artistsBatchLoaded(artists, QString(), false); });
 
-    Manager::instance()->database()->transaction();
-    for (Artist* artist : artists) {
+    int dbCounter = 0;
+    for (Artist* artist : dbArtists) {
         if (m_aborted) {
-            Manager::instance()->database()->commit();
-            return;
+            break;
         }
-        artist->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-        if (current % 20 == 0) {
+        loadArtistData(artist);
+        QVector<Album*> albums = artist->albums();
+        QtConcurrent::blockingMapped(albums, MusicFileSearcher::loadAlbumData);
+        if (dbCounter % 20 == 0) {
             emit currentDir(artist->name());
         }
-        emit progress(++current, max, m_progressMessageId);
-        Manager::instance()->database()->add(artist, artistPaths.value(artist));
+        emit progress(++dbCounter, dbArtists.size(), m_progressMessageId);
+        collector.add(artist);
     }
-    for (Album* album : albums) {
+    collector.flush();
+
+    emit workerFinished();
+}
+
+void MusicFileSearcher::loadArtistsFromDisk(const SettingsDir& dir)
+{
+    const QString path = dir.path.path();
+    BatchCollector<Artist*> collector(
+        [&](QVector<Artist*> artists) { emit artistsBatchLoaded(artists, path, true); });
+
+    QDirIterator it(path, QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
+    while (it.hasNext()) {
         if (m_aborted) {
-            Manager::instance()->database()->commit();
-            return;
+            break;
         }
-        album->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-        if (current % 20 == 0) {
-            emit currentDir(album->artist() + "/" + album->title());
+
+        it.next();
+
+        if (Settings::instance()->advanced()->isFolderExcluded(it.fileInfo().dir().dirName())) {
+            continue;
+        }
+
+        emit currentDir(it.fileInfo().baseName());
+        // Artists and albums are created without parent so that they can be moved to the GUI thread.
+        auto* artist = new Artist(it.filePath());
+        artist->setName(it.fileInfo().baseName());
+
+        QDirIterator itAlbums(it.filePath(), QDir::NoDotAndDotDot | QDir::Dirs, QDirIterator::FollowSymlinks);
+        while (itAlbums.hasNext()) {
+            itAlbums.next();
+
+            if (Settings::instance()->advanced()->isFolderExcluded(itAlbums.fileInfo().dir().dirName())) {
+                continue;
+            }
+
+            if (itAlbums.fileInfo().baseName() == "extrafanart") {
+                continue;
+            }
+            if (itAlbums.fileInfo().baseName() == "extrathumbs") {
+                continue;
+            }
+
+            auto* album = new Album(itAlbums.filePath());
+            album->setTitle(itAlbums.fileInfo().baseName());
+            album->setArtistObj(artist);
+            artist->addAlbum(album);
         }
-        emit progress(++current, max, m_progressMessageId);
-        Manager::instance()->database()->add(album, albumPaths.value(album));
-    }
-    Manager::instance()->database()->commit();
 
-    QtConcurrent::blockingMapped(artistsFromDb, MusicFileSearcher::loadArtistData);
-    QtConcurrent::blockingMapped(albumsFromDb, MusicFileSearcher::loadAlbumData);
+        artist->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+        for (Album* album : artist->albums()) {
+            album->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+            album->moveToThread(QCoreApplication::instance()->thread());
+        }
+        artist->moveToThread(QCoreApplication::instance()->thread());
 
-    artists.append(artistsFromDb);
-    albums.append(albumsFromDb);
+        collector.add(artist);
+    }
+    collector.flush();
+}
 
-    QMap<Artist*, MusicModelItem*> artistModelItems;
-    for (Artist* artist : artists) {
-        MusicModelItem* artistItem = Manager::instance()->musicModel()->appendChild(artist);
-        artistModelItems.insert(artist, artistItem);
+void MusicFileSearcher::onArtistsBatchLoaded(QVector<Artist*> artists, QString directory, bool storeInDatabase)
+{
+    if (m_aborted) {
+        for (Artist* artist : artists) {
+            for (Album* album : artist->albums()) {
+                album->deleteLater();
+            }
+            artist->deleteLater();
+        }
+        return;
     }
-    for (Album* album : albums) {
-        MusicModelItem* artistItem = artistModelItems.value(album->artistObj(), nullptr);
-        if (artistItem == nullptr) {
-            qWarning() << "Artist item was not found for album" << album->path();
-            continue;
+
+    if (storeInDatabase) {
+        Database* database = Manager::instance()->database();
+        database->transaction();
+        for (Artist* artist : artists) {
+            artist->setParent(this);
+            database->add(artist, directory);
+            for (Album* album : artist->albums()) {
+                album->setParent(this);
+                database->add(album, directory);
+            }
         }
-        artistItem->appendChild(album);
+        database->commit();
     }
 
+    Manager::instance()->musicModel()->appendArtists(artists);
+}
+
+void MusicFileSearcher::onWorkerFinished()
+{
     if (!m_aborted) {
         emit musicLoaded();
     }
@@ -2,17 +2,24 @@
 
 #include "globals/Globals.h"
 
+#include <QFuture>
 #include <QObject>
+#include <atomic>
 
 class Album;
 class Artist;
 
+/// \brief Loads all artists and albums of the configured music directories.
+///
+/// Directories are scanned and NFO files are loaded in a worker thread. Loaded artists
+/// (including their albums) are handed to the GUI thread in batches which are stored
+/// in the database and added to the music model.
 class MusicFileSearcher : public QObject
 {
     Q_OBJECT
 public:
     explicit MusicFileSearcher(QObject* parent = nullptr);
-    ~MusicFileSearcher() override = default;
+    ~MusicFileSearcher() override;
 
     void setMusicDirectories(QVector<SettingsDir> directories);
     static Artist* loadArtistData(Artist* artist);
@@ -28,8 +35,24 @@ signals:
     void musicLoaded();
     void currentDir(QString);
 
+    /// \brief Emitted by the worker thread for each batch of loaded artists.
+    /// If storeInDatabase is true, the artists and their albums were read from disk
+    /// and are not yet stored in the database. Internal signal, don't connect to it.
+    void artistsBatchLoaded(QVector<Artist*> artists, QString directory, bool storeInDatabase);
+    /// \brief Emitted by the worker thread after the last batch. Internal signal.
+    void workerFinished();
+
+private slots:
+    void onArtistsBatchLoaded(QVector<Artist*> artists, QString directory, bool storeInDatabase);
+    void onWorkerFinished();
+
 private:
+    /// \brief Entry point of the worker thread.
+    void loadMusic(QVector<SettingsDir> directoriesToScan, QVector<Artist*> dbArtists);
+    void loadArtistsFromDisk(const SettingsDir& dir);
+
     QVector<SettingsDir> m_directories;
     int m_progressMessageId;
-    bool m_aborted;
+    std::atomic<bool> m_aborted;
+    QFuture<void> m_worker;
 };
@@ -109,8 +109,30 @@ MusicModelItem* MusicModel::appendChild(Artist* artist)
 {
     MusicModelItem* parentItem = m_rootItem;
     beginInsertRows(QModelIndex(), parentItem->childCount(), parentItem->childCount());
-    MusicModelItem* item = parentItem->appendChild(artist);
+    MusicModelItem* item = appendArtistItem(artist);
     endInsertRows();
+    return item;
+}
+
+void MusicModel::appendArtists(const QVector<Artist*>& artists)
+{
+    if (artists.isEmpty()) {
+        return;
+    }
+    MusicModelItem* parentItem = m_rootItem;
+    beginInsertRows(QModelIndex(), parentItem->childCount(), parentItem->childCount() + artists.size() - 1);
+    for (Artist* artist : artists) {
+        MusicModelItem* item = appendArtistItem(artist);
+        for (Album* album : artist->albums()) {
+            item->appendChild(album);
+        }
+    }
+    endInsertRows();
+}
+
+MusicModelItem* MusicModel::appendArtistItem(Artist* artist)
+{
+    MusicModelItem* item = m_rootItem->appendChild(artist);
     connect(item, &MusicModelItem::sigChanged, this, &MusicModel::onSigChanged);
     connect(artist, &Artist::sigChanged, this, &MusicModel::onArtistChanged);
     connect(artist->controller(), &ArtistController::sigSaved, this, &MusicModel::onArtistChanged);
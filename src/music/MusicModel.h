@@ -21,6 +21,8 @@ public:
     int columnCount(const QModelIndex& parent = QModelIndex()) const;
     bool removeRows(int position, int rows, const QModelIndex& parent = QModelIndex());
     MusicModelItem* appendChild(Artist* artist);
+    /// \brief Appends all artists and their albums with a single row insertion.
+    void appendArtists(const QVector<Artist*>& artists);
     void clear();
     MusicModelItem* getItem(const QModelIndex& index) const;
     QVector<Artist*> artists();
@@ -32,6 +34,8 @@ private slots:
     void onArtistChanged(Artist* artist);
 
 private:
+    MusicModelItem* appendArtistItem(Artist* artist);
+
     MusicModelItem* m_rootItem;
     QIcon m_newIcon;
 };
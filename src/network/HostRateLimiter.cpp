@@ -0,0 +1,175 @@
+#include "network/HostRateLimiter.h"
+
+#include <QtGlobal>
+#include <cmath>
+
+namespace {
+
+constexpr qint64 INITIAL_BACKOFF_MS = 1000;
+constexpr qint64 MAX_BACKOFF_MS = 60 * 1000;
+
+mediaelch::network::HostPolicy normalized(mediaelch::network::HostPolicy policy)
+{
+    policy.burst = qMax(1, policy.burst);
+    policy.maxConcurrentRequests = qMax(1, policy.maxConcurrentRequests);
+    return policy;
+}
+
+} // namespace
+
+namespace mediaelch {
+namespace network {
+
+HostRateLimiter::HostRateLimiter(HostPolicy defaultPolicy) : m_defaultPolicy{normalized(defaultPolicy)}
+{
+}
+
+void HostRateLimiter::setPolicy(const QString& host, HostPolicy policy)
+{
+    m_policies.insert(host.toLower(), normalized(policy));
+    // Hosts that are already known keep their counters but use the new limits.
+    for (auto it = m_hosts.begin(); it != m_hosts.end(); ++it) {
+        it->policy = this->policy(it.key());
+        it->limit = qBound(1, it->limit, it->policy.maxConcurrentRequests);
+        it->tokens = qMin(it->tokens, static_cast<double>(it->policy.burst));
+    }
+}
+
+HostPolicy HostRateLimiter::policy(const QString& host) const
+{
+    QString domain = host.toLower();
+    while (!domain.isEmpty()) {
+        auto it = m_policies.constFind(domain);
+        if (it != m_policies.constEnd()) {
+            return it.value();
+        }
+        const int dot = domain.indexOf('.');
+        if (dot == -1) {
+            break;
+        }
+        domain = domain.mid(dot + 1);
+    }
+    return m_defaultPolicy;
+}
+
+qint64 HostRateLimiter::waitTime(const QString& host, qint64 nowMs)
+{
+    HostState& s = state(host, nowMs);
+    if (s.active >= s.limit) {
+        return -1;
+    }
+    if (s.blockedUntilMs > nowMs) {
+        return s.blockedUntilMs - nowMs;
+    }
+    if (s.policy.requestsPerSecond <= 0.0) {
+        return 0;
+    }
+    refill(s, nowMs);
+    if (s.tokens >= 1.0) {
+        return 0;
+    }
+    return static_cast<qint64>(std::ceil((1.0 - s.tokens) * 1000.0 / s.policy.requestsPerSecond));
+}
+
+void HostRateLimiter::acquire(const QString& host, qint64 nowMs)
+{
+    HostState& s = state(host, nowMs);
+    if (s.policy.requestsPerSecond > 0.0) {
+        refill(s, nowMs);
+        s.tokens = qMax(0.0, s.tokens - 1.0);
+    }
+    ++s.active;
+}
+
+void HostRateLimiter::release(const QString& host, Outcome outcome, qint64 nowMs, qint64 retryAfterMs)
+{
+    HostState& s = state(host, nowMs);
+    s.active = qMax(0, s.active - 1);
+
+    switch (outcome) {
+    case Outcome::Success:
+        s.consecutiveThrottles = 0;
+        if (++s.successesSinceIncrease >= s.limit) {
+            s.successesSinceIncrease = 0;
+            s.limit = qMin(s.limit + 1, s.policy.maxConcurrentRequests);
+        }
+        break;
+    case Outcome::Throttled: {
+        ++s.consecutiveThrottles;
+        s.successesSinceIncrease = 0;
+        s.limit = qMax(1, s.limit / 2);
+        s.tokens = 0.0;
+        s.lastRefillMs = nowMs;
+        qint64 backoff = retryAfterMs;
+        if (backoff < 0) {
+            const int exponent = qMin(s.consecutiveThrottles - 1, 6);
+            backoff = qMin(INITIAL_BACKOFF_MS << exponent, MAX_BACKOFF_MS);
+        }
+        s.blockedUntilMs = qMax(s.blockedUntilMs, nowMs + backoff);
+        break;
+    }
+    case Outcome::Failed:
+        // Network errors say nothing about the host's rate limits.
+        break;
+    }
+}
+
+int HostRateLimiter::concurrencyLimit(const QString& host) const
+{
+    auto it = m_hosts.constFind(host.toLower());
+    return (it != m_hosts.constEnd()) ? it->limit : policy(host).maxConcurrentRequests;
+}
+
+int HostRateLimiter::activeRequests(const QString& host) const
+{
+    auto it = m_hosts.constFind(host.toLower());
+    return (it != m_hosts.constEnd()) ? it->active : 0;
+}
+
+qint64 HostRateLimiter::parseRetryAfter(const QByteArray& value, const QDateTime& now)
+{
+    const QByteArray trimmed = value.trimmed();
+    if (trimmed.isEmpty()) {
+        return -1;
+    }
+    bool ok = false;
+    const qint64 seconds = trimmed.toLongLong(&ok);
+    if (ok) {
+        return (seconds >= 0) ? seconds * 1000 : -1;
+    }
+    // e.g. "Wed, 21 Oct 2015 07:28:00 GMT"
+    const QDateTime date = QDateTime::fromString(QString::fromLatin1(trimmed), Qt::RFC2822Date);
+    if (!date.isValid()) {
+        return -1;
+    }
+    return qMax<qint64>(0, now.msecsTo(date));
+}
+
+HostRateLimiter::HostState& HostRateLimiter::state(const QString& host, qint64 nowMs)
+{
+    const QString key = host.toLower();
+    auto it = m_hosts.find(key);
+    if (it == m_hosts.end()) {
+        HostState s;
+        s.policy = policy(key);
+        s.tokens = s.policy.burst;
+        s.lastRefillMs = nowMs;
+        s.limit = s.policy.maxConcurrentRequests;
+        it = m_hosts.insert(key, s);
+    }
+    return it.value();
+}
+
+void HostRateLimiter::refill(HostState& state, qint64 nowMs)
+{
+    const qint64 elapsed = nowMs - state.lastRefillMs;
+    if (elapsed <= 0) {
+        return;
+    }
+    state.tokens = qMin(static_cast<double>(state.policy.burst),
+        state.tokens + elapsed * state.policy.requestsPerSecond / 1000.0);
+    state.lastRefillMs = nowMs;
+}
+
+} // namespace network
+} // namespace mediaelch
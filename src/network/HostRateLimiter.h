@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+
+namespace mediaelch {
+namespace network {
+
+/// \brief Rate limits for a single host.
+struct HostPolicy
+{
+    /// Sustained number of requests per second. Zero or less disables the token bucket.
+    double requestsPerSecond = 0.0;
+    /// Number of requests that may be sent in a burst, i.e. the size of the token bucket.
+    int burst = 1;
+    /// Upper bound for concurrent requests. The effective limit adapts to the host's responses.
+    int maxConcurrentRequests = 6;
+};
+
+/// \brief Book-keeping for per-host rate limits, throttling backoff and adaptive concurrency.
+///
+/// Each host has a token bucket that is refilled with requestsPerSecond tokens
+/// per second, and a concurrency limit. The concurrency limit is halved
+/// whenever the host throttles us (HTTP 429/503) and is increased by one after
+/// "limit" successful requests (AIMD). A throttled host is blocked for the time
+/// given by its Retry-After header or, if there is none, for an exponentially
+/// growing backoff.
+///
+/// The class does not know about the network or clocks: all times are passed
+/// in as milliseconds of a monotonic clock so that it can be tested easily.
+class HostRateLimiter
+{
+public:
+    enum class Outcome
+    {
+        Success,
+        Throttled,
+        Failed
+    };
+
+    explicit HostRateLimiter(HostPolicy defaultPolicy = {});
+
+    /// \brief Sets the policy for the given host and all its subdomains.
+    void setPolicy(const QString& host, HostPolicy policy);
+    /// \brief Returns the policy of the host or of its closest parent domain with a policy.
+    HostPolicy policy(const QString& host) const;
+
+    /// \brief Returns the time in milliseconds until a request to the host may be started.
+    /// \returns 0 if a request may be started now and -1 if all request slots are in use.
+    qint64 waitTime(const QString& host, qint64 nowMs);
+    /// \brief Takes a token and a request slot of the host. Call waitTime() first.
+    void acquire(const QString& host, qint64 nowMs);
+    /// \brief Frees the request slot taken by acquire() and adapts the limits to the outcome.
+    /// \param retryAfterMs Time the host asked us to wait or -1 if unknown.
+    void release(const QString& host, Outcome outcome, qint64 nowMs, qint64 retryAfterMs = -1);
+
+    int concurrencyLimit(const QString& host) const;
+    int activeRequests(const QString& host) const;
+
+    /// \brief Parses the value of a Retry-After header (seconds or HTTP date).
+    /// \returns The delay in milliseconds or -1 if the value is invalid.
+    static qint64 parseRetryAfter(const QByteArray& value, const QDateTime& now);
+
+private:
+    struct HostState
+    {
+        HostPolicy policy;
+        double tokens = 0.0;
+        qint64 lastRefillMs = 0;
+        int active = 0;
+        int limit = 1;
+        int successesSinceIncrease = 0;
+        int consecutiveThrottles = 0;
+        qint64 blockedUntilMs = 0;
+    };
+
+    HostState& state(const QString& host, qint64 nowMs);
+    static void refill(HostState& state, qint64 nowMs);
+
+    HostPolicy m_defaultPolicy;
+    QHash<QString, HostPolicy> m_policies;
+    QHash<QString, HostState> m_hosts;
+};
+
+} // namespace network
+} // namespace mediaelch
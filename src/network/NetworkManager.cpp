@@ -1,33 +1,87 @@
 #include "network/NetworkManager.h"
 
+#include "log/Tracer.h"
 #include "network/NetworkReplyWatcher.h"
+#include "network/NetworkService.h"
+
+#include <QCoreApplication>
+#include <QThread>
 
 namespace mediaelch {
 namespace network {
 
+namespace {
+
+/// Records the time from sending the request until the reply has finished, including
+/// the time the request waited in NetworkService's queue.
+QNetworkReply* traced(QNetworkReply* reply, const char* name, const QNetworkRequest& request)
+{
+    if (Tracer::isEnabled()) {
+        const qint64 start = Tracer::now();
+        const QString url = request.url().toString();
+        QObject::connect(reply, &QNetworkReply::finished, [start, name, url]() { //
+            Tracer::addSpan("network", name, start, url);
+        });
+    }
+    return reply;
+}
+
+} // namespace
+
 QNetworkReply* NetworkManager::get(const QNetworkRequest& request)
 {
-    return m_qnam.get(request);
+    if (useNetworkService()) {
+        return traced(withAuthentication(NetworkService::instance()->get(request)), "GET", request);
+    }
+    return traced(fallbackQnam()->get(request), "GET", request);
 }
 
 QNetworkReply* NetworkManager::getWithWatcher(const QNetworkRequest& request)
 {
-    QNetworkReply* reply = m_qnam.get(request);
+    QNetworkReply* reply = get(request);
     new NetworkReplyWatcher(this, reply);
     return reply;
 }
 
 QNetworkReply* NetworkManager::post(const QNetworkRequest& request, const QByteArray& data)
 {
-    return m_qnam.post(request, data);
+    if (useNetworkService()) {
+        return traced(withAuthentication(NetworkService::instance()->post(request, data)), "POST", request);
+    }
+    return traced(fallbackQnam()->post(request, data), "POST", request);
 }
 
 QNetworkReply* NetworkManager::postWithWatcher(const QNetworkRequest& request, const QByteArray& data)
 {
-    QNetworkReply* reply = m_qnam.post(request, data);
+    QNetworkReply* reply = post(request, data);
     new NetworkReplyWatcher(this, reply);
     return reply;
 }
 
+QNetworkAccessManager* NetworkManager::fallbackQnam()
+{
+    if (m_fallbackQnam == nullptr) {
+        m_fallbackQnam = new QNetworkAccessManager(this);
+        connect(m_fallbackQnam,
+            &QNetworkAccessManager::authenticationRequired,
+            this,
+            &NetworkManager::authenticationRequired);
+    }
+    return m_fallbackQnam;
+}
+
+bool NetworkManager::useNetworkService() const
+{
+    // NetworkService lives in the main thread. QNetworkAccessManager can't be shared across threads.
+    return QCoreApplication::instance() != nullptr && thread() == QCoreApplication::instance()->thread()
+           && QThread::currentThread() == thread();
+}
+
+QNetworkReply* NetworkManager::withAuthentication(QueuedNetworkReply* reply)
+{
+    connect(reply, &QueuedNetworkReply::authenticationRequired, this, &NetworkManager::authenticationRequired);
+    return reply;
+}
+
 } // namespace network
 } // namespace mediaelch
@@ -9,7 +9,13 @@
 namespace mediaelch {
 namespace network {
 
-/// \brief Wrapper around QNetworkAccessManager that adds timeout mechanisms and logging.
+class QueuedNetworkReply;
+
+/// \brief Wrapper around the shared NetworkService that adds timeout mechanisms and logging.
+///
+/// Requests from the main thread go through NetworkService and are therefore
+/// subject to its per-host rate limits. Requests from other threads use a
+/// QNetworkAccessManager owned by this object.
 class NetworkManager : public QObject
 {
     Q_OBJECT
@@ -28,7 +34,12 @@ signals:
     void authenticationRequired(QNetworkReply* reply, QAuthenticator* authenticator);
 
 private:
-    QNetworkAccessManager m_qnam;
+    /// \brief Returns the QNetworkAccessManager for requests that can't go through NetworkService.
+    QNetworkAccessManager* fallbackQnam();
+    bool useNetworkService() const;
+    QNetworkReply* withAuthentication(QueuedNetworkReply* reply);
+
+    QNetworkAccessManager* m_fallbackQnam = nullptr;
 };
 
 } // namespace network
@@ -1,5 +1,7 @@
 #include "network/NetworkReplyWatcher.h"
 
+#include "network/QueuedNetworkReply.h"
+
 #include <QDebug>
 
 NetworkReplyWatcher::NetworkReplyWatcher(QObject* parent, QNetworkReply* reply) : QObject(parent), m_reply{nullptr}
@@ -17,11 +19,25 @@ void NetworkReplyWatcher::setReply(QNetworkReply* reply)
     connect(m_reply, &QNetworkReply::finished, &m_timer, &QTimer::stop);
     connect(m_reply, &QObject::destroyed, this, &QObject::deleteLater);
     connect(m_reply, &QNetworkReply::downloadProgress, this, &NetworkReplyWatcher::onProgress);
-    m_timer.start(m_timeoutMilliseconds);
+
+    // Queued requests may wait for the host's rate limit; only start the timeout once they are sent.
+    // Retries restart the timeout as well.
+    auto* queuedReply = qobject_cast<mediaelch::network::QueuedNetworkReply*>(m_reply);
+    if (queuedReply != nullptr) {
+        connect(queuedReply, &mediaelch::network::QueuedNetworkReply::started, this, &NetworkReplyWatcher::onProgress);
+    }
+    if (queuedReply == nullptr || queuedReply->attempts() > 0) {
+        m_timer.start(m_timeoutMilliseconds);
+    }
 }
 
 void NetworkReplyWatcher::onTimeout()
 {
+    auto* queuedReply = qobject_cast<mediaelch::network::QueuedNetworkReply*>(m_reply);
+    if (queuedReply != nullptr && !queuedReply->isRunning()) {
+        // Waiting for a retry; the timeout is restarted once the request is sent again.
+        return;
+    }
     if (m_reply != nullptr) {
         m_reply->abort();
     }
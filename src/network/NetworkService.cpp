@@ -0,0 +1,154 @@
+#include "network/NetworkService.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+
+namespace mediaelch {
+namespace network {
+
+NetworkService::NetworkService(QObject* parent) : QObject(parent)
+{
+    // MusicBrainz allows one request per second per client.
+    // See https://musicbrainz.org/doc/MusicBrainz_API/Rate_Limiting
+    m_limiter.setPolicy("musicbrainz.org", {1.0, 1, 1});
+    // TMDb no longer documents a hard limit but throttles at around 40-50 requests per second.
+    m_limiter.setPolicy("api.themoviedb.org", {20.0, 40, 6});
+
+    m_clock.start();
+    m_dispatchTimer.setSingleShot(true);
+    connect(&m_dispatchTimer, &QTimer::timeout, this, &NetworkService::dispatch);
+    connect(&m_qnam, &QNetworkAccessManager::authenticationRequired, this, &NetworkService::onAuthenticationRequired);
+}
+
+NetworkService::~NetworkService() = default;
+
+NetworkService* NetworkService::instance()
+{
+    static QPointer<NetworkService> s_instance;
+    if (s_instance.isNull()) {
+        s_instance = new NetworkService(QCoreApplication::instance());
+    }
+    return s_instance;
+}
+
+QueuedNetworkReply* NetworkService::get(const QNetworkRequest& request)
+{
+    return enqueue(QNetworkAccessManager::GetOperation, request, {});
+}
+
+QueuedNetworkReply* NetworkService::post(const QNetworkRequest& request, const QByteArray& data)
+{
+    return enqueue(QNetworkAccessManager::PostOperation, request, data);
+}
+
+QueuedNetworkReply* NetworkService::enqueue(QNetworkAccessManager::Operation operation,
+    const QNetworkRequest& request,
+    const QByteArray& data)
+{
+    auto* reply = new QueuedNetworkReply(operation, request, data);
+    m_queues[request.url().host().toLower()].append(reply);
+    dispatch();
+    return reply;
+}
+
+void NetworkService::dispatch()
+{
+    const qint64 now = m_clock.elapsed();
+    qint64 nextWakeUp = -1;
+
+    for (auto it = m_queues.begin(); it != m_queues.end();) {
+        const QString& host = it.key();
+        QList<QPointer<QueuedNetworkReply>>& queue = it.value();
+
+        while (!queue.isEmpty()) {
+            if (queue.first().isNull() || queue.first()->isFinished()) {
+                // Deleted or aborted while waiting.
+                queue.removeFirst();
+                continue;
+            }
+            const qint64 wait = m_limiter.waitTime(host, now);
+            if (wait < 0) {
+                // All request slots are in use; dispatch() is called again when one is released.
+                break;
+            }
+            if (wait > 0) {
+                nextWakeUp = (nextWakeUp < 0) ? wait : qMin(nextWakeUp, wait);
+                break;
+            }
+            startRequest(queue.takeFirst(), host);
+        }
+
+        if (queue.isEmpty()) {
+            it = m_queues.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (nextWakeUp >= 0) {
+        m_dispatchTimer.start(static_cast<int>(nextWakeUp));
+    }
+}
+
+void NetworkService::startRequest(QueuedNetworkReply* reply, const QString& host)
+{
+    m_limiter.acquire(host, m_clock.elapsed());
+
+    QNetworkReply* networkReply = nullptr;
+    if (reply->operation() == QNetworkAccessManager::PostOperation) {
+        networkReply = m_qnam.post(reply->request(), reply->requestBody());
+    } else {
+        networkReply = m_qnam.get(reply->request());
+    }
+
+    m_running.insert(networkReply, reply);
+    connect(networkReply, &QNetworkReply::finished, this, [this, networkReply, host]() {
+        onRequestFinished(networkReply, host);
+    });
+    // Throttled responses are only hidden from the caller if the request will be retried.
+    reply->attach(networkReply, reply->attempts() < m_maxRetries);
+}
+
+void NetworkService::onRequestFinished(QNetworkReply* networkReply, const QString& host)
+{
+    networkReply->deleteLater();
+    QPointer<QueuedNetworkReply> reply = m_running.take(networkReply);
+
+    const qint64 now = m_clock.elapsed();
+    const int status = networkReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+    if (status == 429 || status == 503) {
+        const qint64 retryAfter = HostRateLimiter::parseRetryAfter(
+            networkReply->rawHeader("Retry-After"), QDateTime::currentDateTimeUtc());
+        m_limiter.release(host, HostRateLimiter::Outcome::Throttled, now, retryAfter);
+
+        if (!reply.isNull() && !reply->isFinished() && reply->attempts() <= m_maxRetries) {
+            qDebug() << "[Network] Host" << host << "throttled request, retrying:" << networkReply->url();
+            reply->detach();
+            m_queues[host].prepend(reply);
+            dispatch();
+            return;
+        }
+
+    } else {
+        const bool success = (networkReply->error() == QNetworkReply::NoError);
+        m_limiter.release(host, success ? HostRateLimiter::Outcome::Success : HostRateLimiter::Outcome::Failed, now);
+    }
+
+    if (!reply.isNull()) {
+        reply->complete(networkReply);
+    }
+    dispatch();
+}
+
+void NetworkService::onAuthenticationRequired(QNetworkReply* networkReply, QAuthenticator* authenticator)
+{
+    QPointer<QueuedNetworkReply> reply = m_running.value(networkReply);
+    if (!reply.isNull()) {
+        emit reply->authenticationRequired(reply.data(), authenticator);
+    }
+}
+
+} // namespace network
+} // namespace mediaelch
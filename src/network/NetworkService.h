@@ -0,0 +1,68 @@
+#pragma once
+
+#include "network/HostRateLimiter.h"
+#include "network/QueuedNetworkReply.h"
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+namespace mediaelch {
+namespace network {
+
+/// \brief Network access shared by all scrapers and media centers.
+///
+/// All requests go through one QNetworkAccessManager so that connections
+/// are pooled across scrapers. Requests are queued per host and are only sent
+/// if the host's token bucket and concurrency limit allow it, see HostRateLimiter.
+/// Requests that are throttled by the host (HTTP 429 or 503) are retried after
+/// the time given by the Retry-After header. The caller only sees the final response.
+///
+/// NetworkManager uses the shared instance. It must only be used from the
+/// main thread. Tests may create their own instance.
+class NetworkService : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NetworkService(QObject* parent = nullptr);
+    ~NetworkService() override;
+
+    /// \brief The service shared by all NetworkManager instances. Only available in the main thread.
+    static NetworkService* instance();
+
+    QueuedNetworkReply* get(const QNetworkRequest& request);
+    QueuedNetworkReply* post(const QNetworkRequest& request, const QByteArray& data);
+
+    HostRateLimiter& rateLimiter() { return m_limiter; }
+    /// \brief Number of times a throttled request is retried before the response is passed on.
+    void setMaxRetries(int retries) { m_maxRetries = retries; }
+
+private:
+    QueuedNetworkReply* enqueue(QNetworkAccessManager::Operation operation,
+        const QNetworkRequest& request,
+        const QByteArray& data);
+    void dispatch();
+    void startRequest(QueuedNetworkReply* reply, const QString& host);
+    void onRequestFinished(QNetworkReply* reply, const QString& host);
+    void onAuthenticationRequired(QNetworkReply* reply, QAuthenticator* authenticator);
+
+    QNetworkAccessManager m_qnam;
+    HostRateLimiter m_limiter;
+    QElapsedTimer m_clock;
+    QTimer m_dispatchTimer;
+    /// Requests waiting for their host's rate limits, in FIFO order per host.
+    QHash<QString, QList<QPointer<QueuedNetworkReply>>> m_queues;
+    /// Running requests of m_qnam and the replies that were handed out for them.
+    QHash<QNetworkReply*, QPointer<QueuedNetworkReply>> m_running;
+    int m_maxRetries = 3;
+};
+
+} // namespace network
+} // namespace mediaelch
@@ -0,0 +1,184 @@
+#include "network/QueuedNetworkReply.h"
+
+#include <cstring>
+
+namespace {
+
+bool isThrottledResponse(const QNetworkReply* reply)
+{
+    const int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    return status == 429 || status == 503;
+}
+
+} // namespace
+
+namespace mediaelch {
+namespace network {
+
+QueuedNetworkReply::QueuedNetworkReply(QNetworkAccessManager::Operation operation,
+    const QNetworkRequest& request,
+    const QByteArray& body,
+    QObject* parent) :
+    QNetworkReply(parent), m_body{body}
+{
+    setOperation(operation);
+    setRequest(request);
+    setUrl(request.url());
+    open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+}
+
+QueuedNetworkReply::~QueuedNetworkReply()
+{
+    // Mark the reply as finished first so that aborting the running
+    // request does not try to complete this (half-destroyed) reply.
+    setFinished(true);
+    if (m_reply != nullptr) {
+        m_reply->disconnect(this);
+        m_reply->abort();
+    }
+}
+
+void QueuedNetworkReply::abort()
+{
+    if (isFinished()) {
+        return;
+    }
+    if (m_reply != nullptr) {
+        // The running reply finishes with OperationCanceledError and NetworkService completes this reply.
+        m_reply->abort();
+        return;
+    }
+    finishWithError(QNetworkReply::OperationCanceledError, tr("Operation canceled"));
+}
+
+qint64 QueuedNetworkReply::bytesAvailable() const
+{
+    return m_buffer.size() + QNetworkReply::bytesAvailable();
+}
+
+void QueuedNetworkReply::attach(QNetworkReply* reply, bool discardThrottled)
+{
+    detach();
+    m_reply = reply;
+    m_discardThrottled = discardThrottled;
+    ++m_attempts;
+
+    connect(reply, &QNetworkReply::metaDataChanged, this, &QueuedNetworkReply::onMetaDataChanged);
+    connect(reply, &QIODevice::readyRead, this, &QueuedNetworkReply::onReadyRead);
+    connect(reply, &QNetworkReply::uploadProgress, this, &QNetworkReply::uploadProgress);
+    connect(reply, &QNetworkReply::downloadProgress, this, [this](qint64 received, qint64 total) {
+        if (isForwarding()) {
+            emit downloadProgress(received, total);
+        }
+    });
+    emit started();
+}
+
+void QueuedNetworkReply::detach()
+{
+    if (m_reply != nullptr) {
+        m_reply->disconnect(this);
+    }
+    m_reply = nullptr;
+    m_metaDataForwarded = false;
+}
+
+void QueuedNetworkReply::complete(QNetworkReply* reply)
+{
+    if (isFinished()) {
+        return;
+    }
+    detach();
+    copyMetaData(reply);
+    m_buffer += reply->readAll();
+
+    if (reply->error() != QNetworkReply::NoError) {
+        finishWithError(reply->error(), reply->errorString());
+        return;
+    }
+    setFinished(true);
+    if (!m_buffer.isEmpty()) {
+        emit readyRead();
+    }
+    emit finished();
+}
+
+qint64 QueuedNetworkReply::readData(char* data, qint64 maxSize)
+{
+    const qint64 size = qMin<qint64>(maxSize, m_buffer.size());
+    if (size == 0) {
+        return isFinished() ? -1 : 0;
+    }
+    std::memcpy(data, m_buffer.constData(), static_cast<size_t>(size));
+    m_buffer.remove(0, static_cast<int>(size));
+    return size;
+}
+
+qint64 QueuedNetworkReply::writeData(const char* data, qint64 maxSize)
+{
+    Q_UNUSED(data);
+    Q_UNUSED(maxSize);
+    return -1;
+}
+
+void QueuedNetworkReply::onMetaDataChanged()
+{
+    if (isForwarding()) {
+        copyMetaData(m_reply);
+        m_metaDataForwarded = true;
+        emit metaDataChanged();
+    }
+}
+
+void QueuedNetworkReply::onReadyRead()
+{
+    if (!isForwarding()) {
+        // The response of a throttled attempt is discarded; the request is retried.
+        m_reply->readAll();
+        return;
+    }
+    if (!m_metaDataForwarded) {
+        onMetaDataChanged();
+    }
+    m_buffer += m_reply->readAll();
+    emit readyRead();
+}
+
+bool QueuedNetworkReply::isForwarding()
+{
+    return m_reply != nullptr && !(m_discardThrottled && isThrottledResponse(m_reply));
+}
+
+void QueuedNetworkReply::copyMetaData(QNetworkReply* reply)
+{
+    setUrl(reply->url());
+    const auto headers = reply->rawHeaderPairs();
+    for (const auto& header : headers) {
+        setRawHeader(header.first, header.second);
+    }
+    const QNetworkRequest::Attribute attributes[] = {QNetworkRequest::HttpStatusCodeAttribute,
+        QNetworkRequest::HttpReasonPhraseAttribute,
+        QNetworkRequest::RedirectionTargetAttribute,
+        QNetworkRequest::SourceIsFromCacheAttribute};
+    for (const auto attribute : attributes) {
+        setAttribute(attribute, reply->attribute(attribute));
+    }
+}
+
+void QueuedNetworkReply::finishWithError(NetworkError error, const QString& errorString)
+{
+    setError(error, errorString);
+    setFinished(true);
+#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+    emit errorOccurred(error);
+#else
+    emit this->error(error);
+#endif
+    if (!m_buffer.isEmpty()) {
+        emit readyRead();
+    }
+    emit finished();
+}
+
+} // namespace network
+} // namespace mediaelch
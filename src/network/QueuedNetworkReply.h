@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QAuthenticator>
+#include <QByteArray>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QPointer>
+
+namespace mediaelch {
+namespace network {
+
+/// \brief Network reply handed out by NetworkService for requests that may be queued or retried.
+///
+/// The reply behaves like a regular QNetworkReply: data is forwarded as it
+/// arrives and finished() is emitted exactly once. Behind the scenes, the
+/// request may wait in a per-host queue and may be sent several times if the
+/// host throttles us. Responses of throttled attempts are not forwarded.
+class QueuedNetworkReply : public QNetworkReply
+{
+    Q_OBJECT
+
+public:
+    QueuedNetworkReply(QNetworkAccessManager::Operation operation,
+        const QNetworkRequest& request,
+        const QByteArray& body,
+        QObject* parent = nullptr);
+    ~QueuedNetworkReply() override;
+
+    void abort() override;
+    qint64 bytesAvailable() const override;
+    bool isSequential() const override { return true; }
+
+    const QByteArray& requestBody() const { return m_body; }
+    /// \brief Number of times the request was sent.
+    int attempts() const { return m_attempts; }
+    /// \brief True if the request was sent and has not finished yet.
+    bool isRunning() const { return m_reply != nullptr; }
+
+    /// \brief Forwards data of the given reply. If discardThrottled is true, responses with
+    /// HTTP status 429 or 503 are not forwarded because the request will be retried.
+    void attach(QNetworkReply* reply, bool discardThrottled);
+    /// \brief Stops forwarding data of the current reply, e.g. before the request is retried.
+    void detach();
+    /// \brief Copies the final state of the given reply and emits finished().
+    void complete(QNetworkReply* reply);
+
+signals:
+    /// \brief Emitted whenever the request is sent to the host.
+    void started();
+    void authenticationRequired(QNetworkReply* reply, QAuthenticator* authenticator);
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    void onMetaDataChanged();
+    void onReadyRead();
+    bool isForwarding();
+    void copyMetaData(QNetworkReply* reply);
+    void finishWithError(NetworkError error, const QString& errorString);
+
+    QByteArray m_body;
+    QByteArray m_buffer;
+    QPointer<QNetworkReply> m_reply;
+    int m_attempts = 0;
+    bool m_discardThrottled = false;
+    bool m_metaDataForwarded = false;
+};
+
+} // namespace network
+} // namespace mediaelch
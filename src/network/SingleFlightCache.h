@@ -0,0 +1,131 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+
+#include <functional>
+#include <utility>
+
+namespace mediaelch {
+namespace network {
+
+/// \brief Coalesces concurrent loads of the same resource and keeps results for a short time.
+///
+/// Image providers are often asked for the same document several times in a row,
+/// e.g. once for posters and once for backdrops of the same movie. Only the first
+/// request for a key has to load the resource; all requests for the same key that
+/// arrive while it is in flight get the same result. Results are then cached for
+/// timeoutSeconds. A load that did not finish within timeoutSeconds, e.g. because
+/// the loader never reported back after an error, is started again by the next request.
+///
+/// Callbacks are always called asynchronously (even for cached results) in the
+/// context object's thread. The cache is *not* thread safe.
+///
+/// \par Example
+/// \code{cpp}
+///   if (m_cache.request(url.toString(), [this](const Result& result) { emit loaded(result); })) {
+///       // first request for this key: load it and call m_cache.finish(key, result)
+///   }
+/// \endcode
+template<class T>
+class SingleFlightCache
+{
+public:
+    using Callback = std::function<void(const T&)>;
+
+    explicit SingleFlightCache(QObject* context, int timeoutSeconds = 120) :
+        m_context{context}, m_timeoutMs{timeoutSeconds * 1000}
+    {
+    }
+
+    /// \brief Registers the callback for the given key.
+    /// \returns True if the caller has to load the resource and call finish() afterwards.
+    ///          False if the result is cached or already being loaded.
+    bool request(const QString& key, Callback callback)
+    {
+        auto cached = m_cache.constFind(key);
+        if (cached != m_cache.constEnd()) {
+            if (!cached->age.hasExpired(m_timeoutMs)) {
+                const T value = cached->value;
+                QTimer::singleShot(0, m_context, [callback, value]() { callback(value); });
+                return false;
+            }
+            m_cache.remove(key);
+        }
+
+        auto inFlight = m_inFlight.find(key);
+        if (inFlight != m_inFlight.end()) {
+            inFlight->callbacks.append(std::move(callback));
+            if (!inFlight->age.hasExpired(m_timeoutMs)) {
+                return false;
+            }
+            // Stale load: the waiting callbacks get the result of the new one.
+            inFlight->age.start();
+            return true;
+        }
+        Pending pending;
+        pending.callbacks.append(std::move(callback));
+        pending.age.start();
+        m_inFlight.insert(key, pending);
+        return true;
+    }
+
+    /// \brief Passes the result to all callbacks waiting for the key.
+    /// \param cacheable If false, the result is only passed to waiting callbacks, e.g. for errors.
+    void finish(const QString& key, const T& result, bool cacheable = true)
+    {
+        removeExpiredEntries();
+        if (cacheable) {
+            Entry entry;
+            entry.value = result;
+            entry.age.start();
+            m_cache.insert(key, entry);
+        }
+        // Callbacks may request the same key again, so take them out first.
+        const QVector<Callback> callbacks = m_inFlight.take(key).callbacks;
+        for (const Callback& callback : callbacks) {
+            callback(result);
+        }
+    }
+
+    /// \brief Removes all cached results. Loads in flight are not affected.
+    void clear() { m_cache.clear(); }
+
+private:
+    struct Entry
+    {
+        T value;
+        QElapsedTimer age;
+    };
+
+    struct Pending
+    {
+        QVector<Callback> callbacks;
+        QElapsedTimer age;
+    };
+
+    void removeExpiredEntries()
+    {
+        auto it = m_cache.begin();
+        while (it != m_cache.end()) {
+            if (it->age.hasExpired(m_timeoutMs)) {
+                it = m_cache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    QPointer<QObject> m_context;
+    qint64 m_timeoutMs;
+    QHash<QString, Pending> m_inFlight;
+    QHash<QString, Entry> m_cache;
+};
+
+} // namespace network
+} // namespace mediaelch
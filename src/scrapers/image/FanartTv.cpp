@@ -7,11 +7,14 @@
 #include <QJsonObject>
 #include <QJsonValue>
 #include <QLabel>
+#include <QPointer>
 
-#include "data/Storage.h"
+#include "concerts/Concert.h"
+#include "movies/Movie.h"
 #include "network/NetworkRequest.h"
 #include "scrapers/movie/TMDb.h"
 #include "scrapers/tv_show/TheTvDb.h"
+#include "tv_shows/TvShow.h"
 #include "ui/main/MainWindow.h"
 
 FanartTv::FanartTv(QObject* parent)
@@ -292,115 +295,106 @@ void FanartTv::concertCdArts(TmdbId tmdbId)
 void FanartTv::loadMovieData(TmdbId tmdbId, ImageType type)
 {
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
-    QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
-
     qDebug() << "[FanartTv] Load movie data:" << url;
 
-    QNetworkReply* reply = network()->get(request);
-    reply->setProperty("infoToLoad", static_cast<int>(type));
-    connect(reply, &QNetworkReply::finished, this, &FanartTv::onLoadMovieDataFinished);
+    loadJson(url, [this, type](const JsonResult& result) {
+        if (result.error != QNetworkReply::NoError) {
+            const bool notFound = (result.error == QNetworkReply::ContentNotFoundError);
+            const QString error = notFound ? tr("Movie not found on Fanart.tv") : result.errorString;
+            emit sigImagesLoaded({}, {ScraperLoadError::ErrorType::NetworkError, error});
+            return;
+        }
+        emit sigImagesLoaded(parseMovieData(result.json, type), {});
+    });
 }
 
 void FanartTv::loadMovieData(TmdbId tmdbId, QVector<ImageType> types, Movie* movie)
 {
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
-    QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
-
     qDebug() << "[FanartTv] Load movie data with image types:" << url;
 
-    QNetworkReply* reply = network()->get(request);
-    reply->setProperty("storage", Storage::toVariant(reply, movie));
-    reply->setProperty("infosToLoad", Storage::toVariant(reply, types));
-    connect(reply, &QNetworkReply::finished, this, &FanartTv::onLoadAllMovieDataFinished);
+    // The movie may be deleted while the document is loaded.
+    QPointer<Movie> guard(movie);
+    loadJson(url, [this, types, guard](const JsonResult& result) {
+        if (guard.isNull()) {
+            return;
+        }
+        QMap<ImageType, QVector<Poster>> posters;
+        if (result.error == QNetworkReply::NoError) {
+            for (const auto type : types) {
+                posters.insert(type, parseMovieData(result.json, type));
+            }
+        }
+        emit sigMovieImagesLoaded(guard.data(), posters);
+    });
 }
 
 void FanartTv::loadConcertData(TmdbId tmdbId, QVector<ImageType> types, Concert* concert)
 {
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/movies/%1?%2").arg(tmdbId.toString(), keyParameter());
-    QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
-
     qDebug() << "[FanartTv] Load concert data with image types:" << url;
 
-    QNetworkReply* reply = network()->get(request);
-    reply->setProperty("infosToLoad", Storage::toVariant(reply, types));
-    reply->setProperty("storage", Storage::toVariant(reply, concert));
-    connect(reply, &QNetworkReply::finished, this, &FanartTv::onLoadAllConcertDataFinished);
+    QPointer<Concert> guard(concert);
+    loadJson(url, [this, types, guard](const JsonResult& result) {
+        if (guard.isNull()) {
+            return;
+        }
+        QMap<ImageType, QVector<Poster>> posters;
+        if (result.error == QNetworkReply::NoError) {
+            for (const auto type : types) {
+                posters.insert(type, parseMovieData(result.json, type));
+            }
+        }
+        emit sigConcertImagesLoaded(guard.data(), posters);
+    });
 }
 
 /**
- * \brief Called when the movie images are downloaded
- * \see TMDbImages::parseMovieData
+ * \brief Loads and parses the given fanart.tv document.
+ *
+ * Concurrent requests for the same URL share one network request and the
+ * parsed document is kept for a short time, because image dialogs usually
+ * ask for several image types of the same movie or TV show in a row.
+ * Errors are passed to all waiting callbacks but are not cached.
  */
-void FanartTv::onLoadMovieDataFinished()
+void FanartTv::loadJson(const QUrl& url, std::function<void(const JsonResult&)> callback)
 {
-    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
-    reply->deleteLater();
-
-    if (reply->error() != QNetworkReply::NoError) {
-        const bool notFound = (reply->error() == QNetworkReply::ContentNotFoundError);
-        const QString error = notFound ? tr("Movie not found on Fanart.tv") : reply->errorString();
-        emit sigImagesLoaded({}, {ScraperLoadError::ErrorType::NetworkError, error});
+    const QString key = url.toString();
+    if (!m_jsonCache.request(key, std::move(callback))) {
         return;
     }
 
-    QString msg = QString::fromUtf8(reply->readAll());
-    QVector<Poster> posters = parseMovieData(msg, ImageType(reply->property("infoToLoad").toInt()));
-    emit sigImagesLoaded(posters, {});
-}
-
-/**
- * \brief Called when all movie images are downloaded
- * \see TMDbImages::parseMovieData
- */
-void FanartTv::onLoadAllMovieDataFinished()
-{
-    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
-    Movie* movie = reply->property("storage").value<Storage*>()->movie();
-    reply->deleteLater();
-
-    if (reply->error() != QNetworkReply::NoError) {
-        emit sigMovieImagesLoaded(movie, {});
-    }
-
-    QMap<ImageType, QVector<Poster>> posters;
-    QString msg = QString::fromUtf8(reply->readAll());
-    for (const auto type : reply->property("infosToLoad").value<Storage*>()->imageInfosToLoad()) {
-        posters.insert(type, parseMovieData(msg, type));
-    }
-
-    emit sigMovieImagesLoaded(movie, posters);
-}
-
-/**
- * \brief Called when all concert images are downloaded
- * \see TMDbImages::parseMovieData
- */
-void FanartTv::onLoadAllConcertDataFinished()
-{
-    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
-    Concert* concert = reply->property("storage").value<Storage*>()->concert();
-    reply->deleteLater();
-
-    if (reply->error() != QNetworkReply::NoError) {
-        emit sigConcertImagesLoaded(concert, {});
-    }
+    QNetworkReply* reply = network()->get(mediaelch::network::jsonRequestWithDefaults(url));
+    connect(reply, &QNetworkReply::finished, this, [this, reply, key]() {
+        reply->deleteLater();
 
-    QMap<ImageType, QVector<Poster>> posters;
-    QString msg = QString::fromUtf8(reply->readAll());
-    for (const auto type : reply->property("infosToLoad").value<Storage*>()->imageInfosToLoad()) {
-        posters.insert(type, parseMovieData(msg, type));
-    }
+        JsonResult result;
+        result.error = reply->error();
+        if (reply->error() != QNetworkReply::NoError) {
+            result.errorString = reply->errorString();
+            m_jsonCache.finish(key, result, false);
+            return;
+        }
 
-    emit sigConcertImagesLoaded(concert, posters);
+        QJsonParseError parseError{};
+        // The JSON contains one object with all URLs to fanart images
+        result.json = QJsonDocument::fromJson(reply->readAll(), &parseError).object();
+        if (parseError.error != QJsonParseError::NoError) {
+            qWarning() << "[FanartTv] Error parsing json:" << parseError.errorString();
+            m_jsonCache.finish(key, result, false);
+            return;
+        }
+        m_jsonCache.finish(key, result);
+    });
 }
 
 /**
  * \brief Parses JSON data for movies
- * \param json JSON data
+ * \param json Parsed fanart.tv document
  * \param type Type of image (ImageType)
  * \return List of posters
  */
-QVector<Poster> FanartTv::parseMovieData(QString json, ImageType type)
+QVector<Poster> FanartTv::parseMovieData(const QJsonObject& json, ImageType type)
 {
     QMap<ImageType, QStringList> map;
     // clang-format off
@@ -419,17 +413,8 @@ QVector<Poster> FanartTv::parseMovieData(QString json, ImageType type)
 
     QVector<Poster> posters;
 
-    QJsonParseError parseError{};
-    // The JSON contains one object with all URLs to fanart images
-    const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
-
-    if (parseError.error != QJsonParseError::NoError) {
-        qWarning() << "Error parsing fanart movie json " << parseError.errorString();
-        return posters;
-    }
-
     for (const auto& section : map.value(type)) {
-        const auto jsonPosters = parsedJson.value(section).toArray();
+        const auto jsonPosters = json.value(section).toArray();
 
         for (const auto& it : jsonPosters) {
             const auto poster = it.toObject();
@@ -501,66 +486,35 @@ void FanartTv::tvShowImages(TvShow* show, TvDbId tvdbId, QVector<ImageType> type
 void FanartTv::loadTvShowData(TvDbId tvdbId, ImageType type, SeasonNumber season)
 {
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/tv/%1?%2").arg(tvdbId.toString(), keyParameter());
-    QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
 
-    QNetworkReply* reply = network()->get(request);
-    reply->setProperty("infoToLoad", static_cast<int>(type));
-    reply->setProperty("season", season.toInt());
-    connect(reply, &QNetworkReply::finished, this, &FanartTv::onLoadTvShowDataFinished);
+    loadJson(url, [this, type, season](const JsonResult& result) {
+        if (result.error != QNetworkReply::NoError) {
+            const bool notFound = (result.error == QNetworkReply::ContentNotFoundError);
+            const QString error = notFound ? tr("TV show not found on Fanart.tv") : result.errorString;
+            emit sigImagesLoaded({}, {ScraperLoadError::ErrorType::NetworkError, error});
+            return;
+        }
+        emit sigImagesLoaded(parseTvShowData(result.json, type, season), {});
+    });
 }
 
 void FanartTv::loadTvShowData(TvDbId tvdbId, QVector<ImageType> types, TvShow* show)
 {
     QUrl url = QStringLiteral("https://webservice.fanart.tv/v3/tv/%1?%2").arg(tvdbId.toString(), keyParameter());
-    QNetworkRequest request = mediaelch::network::jsonRequestWithDefaults(url);
-
-    QNetworkReply* reply = network()->get(request);
-    reply->setProperty("infosToLoad", Storage::toVariant(reply, types));
-    reply->setProperty("storage", Storage::toVariant(reply, show));
-    connect(reply, &QNetworkReply::finished, this, &FanartTv::onLoadAllTvShowDataFinished);
-}
-
-/**
- * \brief Called when the TV show images are downloaded
- * \see TMDbImages::parseTvShowData
- */
-void FanartTv::onLoadTvShowDataFinished()
-{
-    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
-    reply->deleteLater();
-
-    if (reply->error() != QNetworkReply::NoError) {
-        const bool notFound = (reply->error() == QNetworkReply::ContentNotFoundError);
-        const QString error = notFound ? tr("TV show not found on Fanart.tv") : reply->errorString();
-        emit sigImagesLoaded({}, {ScraperLoadError::ErrorType::NetworkError, error});
-        return;
-    }
 
-    QString msg = QString::fromUtf8(reply->readAll());
-    QVector<Poster> posters = parseTvShowData(
-        msg, ImageType(reply->property("infoToLoad").toInt()), SeasonNumber(reply->property("season").toInt()));
-
-    emit sigImagesLoaded(posters, {});
-}
-
-/**
- * \brief Called when all TV show images are downloaded
- * \see TMDbImages::parseTvShowData
- */
-void FanartTv::onLoadAllTvShowDataFinished()
-{
-    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
-    TvShow* show = reply->property("storage").value<Storage*>()->show();
-    reply->deleteLater();
-    QMap<ImageType, QVector<Poster>> posters;
-    if (reply->error() == QNetworkReply::NoError) {
-        QString msg = QString::fromUtf8(reply->readAll());
-        for (const auto type : reply->property("infosToLoad").value<Storage*>()->imageInfosToLoad()) {
-            posters.insert(type, parseTvShowData(msg, type));
+    QPointer<TvShow> guard(show);
+    loadJson(url, [this, types, guard](const JsonResult& result) {
+        if (guard.isNull()) {
+            return;
         }
-    }
-    reply->deleteLater();
-    emit sigTvShowImagesLoaded(show, posters);
+        QMap<ImageType, QVector<Poster>> posters;
+        if (result.error == QNetworkReply::NoError) {
+            for (const auto type : types) {
+                posters.insert(type, parseTvShowData(result.json, type));
+            }
+        }
+        emit sigTvShowImagesLoaded(guard.data(), posters);
+    });
 }
 
 /**
@@ -664,11 +618,11 @@ void FanartTv::tvShowSeasonThumbs(TvDbId tvdbId, SeasonNumber season)
 
 /**
  * \brief Parses JSON data for TV shows
- * \param json JSON data
+ * \param json Parsed fanart.tv document
  * \param type Type of image (ImageType)
  * \return List of posters
  */
-QVector<Poster> FanartTv::parseTvShowData(QString json, ImageType type, SeasonNumber season)
+QVector<Poster> FanartTv::parseTvShowData(const QJsonObject& json, ImageType type, SeasonNumber season)
 {
     QMap<ImageType, QStringList> map;
 
@@ -686,17 +640,8 @@ QVector<Poster> FanartTv::parseTvShowData(QString json, ImageType type, SeasonNu
 
     QVector<Poster> posters;
 
-    QJsonParseError parseError{};
-    // The JSON contains one object with all URLs to fanart images
-    const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
-
-    if (parseError.error != QJsonParseError::NoError) {
-        qWarning() << "Error parsing fanart TV show json " << parseError.errorString();
-        return posters;
-    }
-
     for (const QString& section : map.value(type)) {
-        const auto jsonPosters = parsedJson.value(section).toArray();
+        const auto jsonPosters = json.value(section).toArray();
 
         for (const auto& it : jsonPosters) {
             const auto poster = it.toObject();
@@ -2,10 +2,12 @@
 
 #include "globals/Globals.h"
 #include "network/NetworkManager.h"
+#include "network/SingleFlightCache.h"
 #include "scrapers/image/ImageProviderInterface.h"
 #include "scrapers/movie/MovieScraperInterface.h"
 
 #include <QComboBox>
+#include <QJsonObject>
 #include <QLineEdit>
 #include <QMap>
 #include <QNetworkReply>
@@ -14,6 +16,8 @@
 #include <QUrl>
 #include <QVector>
 
+#include <functional>
+
 class TMDb;
 class TheTvDb;
 
@@ -78,18 +82,21 @@ public slots:
 
 private slots:
     void onSearchMovieFinished(QVector<ScraperSearchResult> results, ScraperSearchError error);
-    void onLoadMovieDataFinished();
-    void onLoadAllMovieDataFinished();
-    void onLoadAllConcertDataFinished();
     void onSearchTvShowFinished(QVector<ScraperSearchResult> results);
-    void onLoadTvShowDataFinished();
-    void onLoadAllTvShowDataFinished();
 
 private:
+    struct JsonResult
+    {
+        QJsonObject json;
+        QNetworkReply::NetworkError error = QNetworkReply::NoError;
+        QString errorString;
+    };
+
     QVector<ImageType> m_provides;
     QString m_apiKey;
     QString m_personalApiKey;
     mediaelch::network::NetworkManager m_network;
+    mediaelch::network::SingleFlightCache<JsonResult> m_jsonCache{this};
     int m_searchResultLimit = 0;
     TheTvDb* m_tvdb;
     TMDb* m_tmdb;
@@ -103,11 +110,13 @@ private:
     QVector<mediaelch::Locale> m_supportedLanguages = {mediaelch::Locale::English};
 
     mediaelch::network::NetworkManager* network();
-    QVector<Poster> parseMovieData(QString json, ImageType type);
+    void loadJson(const QUrl& url, std::function<void(const JsonResult&)> callback);
+    QVector<Poster> parseMovieData(const QJsonObject& json, ImageType type);
     void loadMovieData(TmdbId tmdbId, ImageType type);
     void loadMovieData(TmdbId tmdbId, QVector<ImageType> types, Movie* movie);
     void loadConcertData(TmdbId tmdbId, QVector<ImageType> types, Concert* concert);
-    QVector<Poster> parseTvShowData(QString json, ImageType type, SeasonNumber season = SeasonNumber::NoSeason);
+    QVector<Poster>
+    parseTvShowData(const QJsonObject& json, ImageType type, SeasonNumber season = SeasonNumber::NoSeason);
     void loadTvShowData(TvDbId tvdbId, ImageType type, SeasonNumber season = SeasonNumber::NoSeason);
     void loadTvShowData(TvDbId tvdbId, QVector<ImageType> types, TvShow* show);
     QString keyParameter();
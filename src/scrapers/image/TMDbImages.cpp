@@ -12,7 +12,6 @@ TMDbImages::TMDbImages(QObject* parent)
         ImageType::ConcertPoster};
     m_searchResultLimit = 0;
     m_tmdb = new TMDb(this);
-    m_dummyMovie = new Movie({}, this);
 
     m_supportedLanguages = {"ar-AE",
         "ar-SA",
@@ -84,7 +83,6 @@ TMDbImages::TMDbImages(QObject* parent)
         "zh-TW",
         "zu-ZA"};
 
-    connect(m_dummyMovie->controller(), &MovieController::sigInfoLoadDone, this, &TMDbImages::onLoadImagesFinished);
     connect(m_tmdb, &TMDb::searchDone, this, &TMDbImages::onSearchMovieFinished);
 }
 
@@ -165,13 +163,7 @@ void TMDbImages::onSearchMovieFinished(QVector<ScraperSearchResult> results, Scr
  */
 void TMDbImages::moviePosters(TmdbId tmdbId)
 {
-    m_dummyMovie->clear();
-    m_imageType = ImageType::MoviePoster;
-    QSet<MovieScraperInfo> infos;
-    infos << MovieScraperInfo::Poster;
-    QHash<MovieScraperInterface*, QString> ids;
-    ids.insert(nullptr, tmdbId.toString());
-    m_tmdb->loadData(ids, m_dummyMovie, infos);
+    loadMovieImages(tmdbId, ImageType::MoviePoster);
 }
 
 /**
@@ -179,13 +171,7 @@ void TMDbImages::moviePosters(TmdbId tmdbId)
  */
 void TMDbImages::movieBackdrops(TmdbId tmdbId)
 {
-    m_dummyMovie->clear();
-    m_imageType = ImageType::MovieBackdrop;
-    QSet<MovieScraperInfo> infos;
-    infos << MovieScraperInfo::Backdrop;
-    QHash<MovieScraperInterface*, QString> ids;
-    ids.insert(nullptr, tmdbId.toString());
-    m_tmdb->loadData(ids, m_dummyMovie, infos);
+    loadMovieImages(tmdbId, ImageType::MovieBackdrop);
 }
 
 /**
@@ -205,18 +191,38 @@ void TMDbImages::concertBackdrops(TmdbId tmdbId)
 }
 
 /**
- * \brief Called when the movie images are downloaded
+ * \brief Loads posters and backdrops of the given movie and emits the ones of the given type.
+ *
+ * Both are part of the same TMDb response, so they are loaded together. Concurrent
+ * requests for the same movie share one load and the result is kept for a short time.
  */
-void TMDbImages::onLoadImagesFinished()
-{
-    QVector<Poster> posters;
-    if (m_imageType == ImageType::MovieBackdrop) {
-        posters = m_dummyMovie->images().backdrops();
-    } else if (m_imageType == ImageType::MoviePoster) {
-        posters = m_dummyMovie->images().posters();
+void TMDbImages::loadMovieImages(TmdbId tmdbId, ImageType type)
+{
+    // The images and their hints depend on the scraper language.
+    const QString key = tmdbId.toString() + '_' + m_tmdb->defaultLanguage().toString();
+    const bool mustLoad = m_imageCache.request(key, [this, type](const MovieImages& images) {
+        emit sigImagesLoaded(type == ImageType::MovieBackdrop ? images.backdrops : images.posters, {});
+    });
+    if (!mustLoad) {
+        return;
     }
 
-    emit sigImagesLoaded(posters, {});
+    auto* movie = new Movie({}, this);
+    connect(movie->controller(), &MovieController::sigInfoLoadDone, this, [this, movie, key]() {
+        MovieImages images;
+        images.posters = movie->images().posters();
+        images.backdrops = movie->images().backdrops();
+        movie->deleteLater();
+        // Don't cache failed loads.
+        const bool cacheable = !images.posters.isEmpty() || !images.backdrops.isEmpty();
+        m_imageCache.finish(key, images, cacheable);
+    });
+
+    QSet<MovieScraperInfo> infos;
+    infos << MovieScraperInfo::Poster << MovieScraperInfo::Backdrop;
+    QHash<MovieScraperInterface*, QString> ids;
+    ids.insert(nullptr, tmdbId.toString());
+    m_tmdb->loadData(ids, movie, infos);
 }
 
 void TMDbImages::movieImages(Movie* movie, TmdbId tmdbId, QVector<ImageType> types)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "movies/Movie.h"
+#include "network/SingleFlightCache.h"
 #include "scrapers/image/ImageProviderInterface.h"
 #include "scrapers/movie/TMDb.h"
 
@@ -67,13 +68,19 @@ public slots:
 
 private slots:
     void onSearchMovieFinished(QVector<ScraperSearchResult> results, ScraperSearchError error);
-    void onLoadImagesFinished();
 
 private:
+    struct MovieImages
+    {
+        QVector<Poster> posters;
+        QVector<Poster> backdrops;
+    };
+
     QVector<ImageType> m_provides;
     int m_searchResultLimit = 0;
     TMDb* m_tmdb = nullptr;
-    Movie* m_dummyMovie = nullptr;
-    ImageType m_imageType = ImageType::None;
+    mediaelch::network::SingleFlightCache<MovieImages> m_imageCache{this};
     QVector<mediaelch::Locale> m_supportedLanguages = {mediaelch::Locale::English};
+
+    void loadMovieImages(TmdbId tmdbId, ImageType type);
 };
@@ -15,8 +15,6 @@ TheTvDbImages::TheTvDbImages(QObject* parent)
         ImageType::TvShowEpisodeThumb,
         ImageType::TvShowSeasonBanner,
         ImageType::TvShowSeasonBackdrop};
-    m_dummyShow = new TvShow(QString(), this);
-    m_dummyEpisode = new TvShowEpisode(QStringList(), m_dummyShow);
     m_tvdb = new TheTvDb(this);
     m_searchResultLimit = 0;
     m_supportedLanguages = {"bg",
@@ -45,8 +43,6 @@ TheTvDbImages::TheTvDbImages(QObject* parent)
         "tr"};
 
     connect(m_tvdb, &TheTvDb::sigSearchDone, this, &TheTvDbImages::onSearchTvShowFinished);
-    connect(m_dummyShow, &TvShow::sigLoaded, this, &TheTvDbImages::onLoadTvShowDataFinished);
-    connect(m_dummyEpisode, &TvShowEpisode::sigLoaded, this, &TheTvDbImages::onLoadTvShowDataFinished);
 }
 
 /**
@@ -134,11 +130,85 @@ void TheTvDbImages::onSearchTvShowFinished(QVector<ScraperSearchResult> results)
     }
 }
 
-void TheTvDbImages::loadTvShowData(TvDbId tvdbId, ImageType type)
-{
-    m_currentType = type;
-    m_dummyShow->clear();
+/**
+ * \brief Loads all images of the given TV show and emits the ones of the given type.
+ *
+ * TheTvDb returns all image types in one go. Concurrent requests for the same show
+ * share one load and the loaded show is kept for a short time, so that e.g. loading
+ * posters and then backdrops only queries TheTvDb once.
+ */
+void TheTvDbImages::loadTvShowData(TvDbId tvdbId, ImageType type, SeasonNumber season)
+{
+    const QString key = QStringLiteral("%1_%2").arg(tvdbId.toString(), m_tvdb->language());
+    const bool mustLoad = m_showCache.request(key, [this, type, season](const QSharedPointer<TvShow>& show) {
+        QVector<Poster> posters;
+        if (type == ImageType::TvShowPoster) {
+            posters = show->posters();
+        } else if (type == ImageType::TvShowBackdrop) {
+            posters = show->backdrops();
+        } else if (type == ImageType::TvShowBanner) {
+            posters = show->banners();
+        } else if (type == ImageType::TvShowSeasonPoster) {
+            posters = show->seasonPosters(season);
+        } else if (type == ImageType::TvShowSeasonBackdrop) {
+            posters = show->backdrops();
+        } else if (type == ImageType::TvShowSeasonBanner) {
+            posters = show->seasonBanners(season, true);
+            posters << show->banners();
+        }
+        emit sigImagesLoaded(posters, {});
+    });
+    if (!mustLoad) {
+        return;
+    }
+
+    auto* show = new TvShow({}, this);
+    connect(show, &TvShow::sigLoaded, this, [this, show, key]() {
+        show->disconnect(this);
+        show->setParent(nullptr);
+        // Network errors are only logged by TheTvDb and result in a show without images.
+        // Don't cache those, so that the next request tries again.
+        const bool hasImages = !show->posters().isEmpty() || !show->backdrops().isEmpty() || !show->banners().isEmpty();
+        m_showCache.finish(key, QSharedPointer<TvShow>(show, &QObject::deleteLater), hasImages);
+    });
+    show->loadData(tvdbId, m_tvdb, TvShowUpdateType::Show, imageInfosToLoad());
+}
+
+/**
+ * \brief Loads the thumbnail of the given episode. Concurrent requests share one load.
+ */
+void TheTvDbImages::loadEpisodeThumb(TvDbId tvdbId, SeasonNumber season, EpisodeNumber episode)
+{
+    const QString key = QStringLiteral("%1/%2/%3").arg(tvdbId.toString(), season.toString(), episode.toString());
+    const bool mustLoad = m_episodeThumbCache.request(key, [this](const QString& thumbnail) {
+        QVector<Poster> posters;
+        if (!thumbnail.isEmpty()) {
+            Poster p;
+            p.thumbUrl = thumbnail;
+            p.originalUrl = thumbnail;
+            posters << p;
+        }
+        emit sigImagesLoaded(posters, {});
+    });
+    if (!mustLoad) {
+        return;
+    }
+
+    // The episode needs a parent show, e.g. for IMDb lookups.
+    auto* show = new TvShow({}, this);
+    auto* tvShowEpisode = new TvShowEpisode({}, show);
+    tvShowEpisode->setSeason(season);
+    tvShowEpisode->setEpisode(episode);
+    connect(tvShowEpisode, &TvShowEpisode::sigLoaded, this, [this, show, tvShowEpisode, key]() {
+        const QString thumbnail = tvShowEpisode->thumbnail();
+        show->deleteLater();
+        m_episodeThumbCache.finish(key, thumbnail, !thumbnail.isEmpty());
+    });
+    m_tvdb->loadTvShowEpisodeData(tvdbId, tvShowEpisode, imageInfosToLoad());
+}
 
+QSet<ShowScraperInfo> TheTvDbImages::imageInfosToLoad()
+{
     QSet<ShowScraperInfo> infosToLoad;
     infosToLoad.insert(ShowScraperInfo::Thumbnail);
     infosToLoad.insert(ShowScraperInfo::Banner);
@@ -147,42 +217,7 @@ void TheTvDbImages::loadTvShowData(TvDbId tvdbId, ImageType type)
     infosToLoad.insert(ShowScraperInfo::SeasonPoster);
     infosToLoad.insert(ShowScraperInfo::SeasonBanner);
     infosToLoad.insert(ShowScraperInfo::SeasonBackdrop);
-
-    if (type == ImageType::TvShowEpisodeThumb) {
-        m_tvdb->loadTvShowEpisodeData(tvdbId, m_dummyEpisode, infosToLoad);
-    } else {
-        m_dummyShow->loadData(tvdbId, m_tvdb, TvShowUpdateType::Show, infosToLoad);
-    }
-}
-
-/**
- * \brief Called when the TV show images are downloaded
- * \see TMDbImages::parseTvShowData
- */
-void TheTvDbImages::onLoadTvShowDataFinished()
-{
-    QVector<Poster> posters;
-    if (m_currentType == ImageType::TvShowPoster) {
-        posters = m_dummyShow->posters();
-    } else if (m_currentType == ImageType::TvShowBackdrop) {
-        posters = m_dummyShow->backdrops();
-    } else if (m_currentType == ImageType::TvShowBanner) {
-        posters = m_dummyShow->banners();
-    } else if (m_currentType == ImageType::TvShowSeasonPoster) {
-        posters = m_dummyShow->seasonPosters(m_season);
-    } else if (m_currentType == ImageType::TvShowSeasonBackdrop) {
-        posters = m_dummyShow->backdrops();
-    } else if (m_currentType == ImageType::TvShowSeasonBanner) {
-        posters = m_dummyShow->seasonBanners(m_season, true);
-        posters << m_dummyShow->banners();
-    } else if (m_currentType == ImageType::TvShowEpisodeThumb && !m_dummyEpisode->thumbnail().isEmpty()) {
-        Poster p;
-        p.thumbUrl = m_dummyEpisode->thumbnail();
-        p.originalUrl = m_dummyEpisode->thumbnail();
-        posters << p;
-    }
-
-    emit sigImagesLoaded(posters, {});
+    return infosToLoad;
 }
 
 void TheTvDbImages::tvShowImages(TvShow* show, TvDbId tvdbId, QVector<ImageType> types)
@@ -227,10 +262,7 @@ void TheTvDbImages::tvShowBanners(TvDbId tvdbId)
  */
 void TheTvDbImages::tvShowEpisodeThumb(TvDbId tvdbId, SeasonNumber season, EpisodeNumber episode)
 {
-    m_dummyEpisode->clear();
-    m_dummyEpisode->setSeason(season);
-    m_dummyEpisode->setEpisode(episode);
-    loadTvShowData(tvdbId, ImageType::TvShowEpisodeThumb);
+    loadEpisodeThumb(tvdbId, season, episode);
 }
 
 /**
@@ -240,14 +272,12 @@ void TheTvDbImages::tvShowEpisodeThumb(TvDbId tvdbId, SeasonNumber season, Episo
  */
 void TheTvDbImages::tvShowSeason(TvDbId tvdbId, SeasonNumber season)
 {
-    m_season = season;
-    loadTvShowData(tvdbId, ImageType::TvShowSeasonPoster);
+    loadTvShowData(tvdbId, ImageType::TvShowSeasonPoster, season);
 }
 
 void TheTvDbImages::tvShowSeasonBanners(TvDbId tvdbId, SeasonNumber season)
 {
-    m_season = season;
-    loadTvShowData(tvdbId, ImageType::TvShowSeasonBanner);
+    loadTvShowData(tvdbId, ImageType::TvShowSeasonBanner, season);
 }
 
 // UNSUPPORTED
@@ -2,9 +2,11 @@
 
 #include "globals/Globals.h"
 #include "globals/ScraperResult.h"
+#include "network/SingleFlightCache.h"
 #include "scrapers/image/ImageProviderInterface.h"
 
 #include <QObject>
+#include <QSharedPointer>
 #include <QVector>
 
 
@@ -75,17 +77,16 @@ public slots:
 
 private slots:
     void onSearchTvShowFinished(QVector<ScraperSearchResult> results);
-    void onLoadTvShowDataFinished();
 
 private:
     QVector<ImageType> m_provides;
-    ImageType m_currentType = ImageType::None;
     int m_searchResultLimit = 0;
     TheTvDb* m_tvdb = nullptr;
-    TvShow* m_dummyShow = nullptr;
-    TvShowEpisode* m_dummyEpisode = nullptr;
-    SeasonNumber m_season;
+    mediaelch::network::SingleFlightCache<QSharedPointer<TvShow>> m_showCache{this};
+    mediaelch::network::SingleFlightCache<QString> m_episodeThumbCache{this};
     QVector<mediaelch::Locale> m_supportedLanguages;
 
-    void loadTvShowData(TvDbId tvdbId, ImageType type);
+    void loadTvShowData(TvDbId tvdbId, ImageType type, SeasonNumber season = SeasonNumber::NoSeason);
+    void loadEpisodeThumb(TvDbId tvdbId, SeasonNumber season, EpisodeNumber episode);
+    static QSet<ShowScraperInfo> imageInfosToLoad();
 };
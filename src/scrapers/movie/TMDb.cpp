@@ -492,64 +492,165 @@ void TMDb::loadData(QHash<MovieScraperInterface*, QString> ids, Movie* movie, QS
 
     movie->clear(infos);
 
+    loadDataConsolidated(id, movie, infos);
+}
+
+/// \brief Load the movie's details and all other sections in a single request
+///        using TMDb's "append_to_response".
+/// \see TMDb::loadConsolidatedFinished
+void TMDb::loadDataConsolidated(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos)
+{
     QNetworkRequest request;
     request.setRawHeader("Accept", "application/json");
+    request.setUrl(getConsolidatedMovieUrl(id, sectionsToLoad(infos)));
 
-    QVector<ScraperData> loadsLeft;
+    // All sections are part of the "Infos" load.
+    movie->controller()->setLoadsLeft({ScraperData::Infos});
 
-    // Infos
-    {
-        loadsLeft.append(ScraperData::Infos);
+    QNetworkReply* const reply = m_network.getWithWatcher(request);
+    reply->setProperty("storage", Storage::toVariant(reply, movie));
+    reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
+    reply->setProperty("tmdbMovieId", id);
+    connect(reply, &QNetworkReply::finished, this, &TMDb::loadConsolidatedFinished);
+}
+
+/// \brief Load the movie's details and each section in a separate request.
+/// Fallback if the consolidated request can't be used.
+void TMDb::loadDataPerSection(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos)
+{
+    const QVector<ApiMovieDetails> sections = sectionsToLoad(infos);
 
-        request.setUrl(getMovieUrl(id, ApiMovieDetails::INFOS));
-        QNetworkReply* const reply = m_network.getWithWatcher(request);
-        reply->setProperty("storage", Storage::toVariant(reply, movie));
-        reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
-        connect(reply, &QNetworkReply::finished, this, &TMDb::loadFinished);
+    QVector<ScraperData> loadsLeft{ScraperData::Infos};
+    for (const ApiMovieDetails section : sections) {
+        loadsLeft.append(scraperDataForSection(section));
     }
+    movie->controller()->setLoadsLeft(loadsLeft);
 
-    // Casts
+    loadSection(id, movie, infos, ApiMovieDetails::INFOS);
+    for (const ApiMovieDetails section : sections) {
+        loadSection(id, movie, infos, section);
+    }
+}
+
+void TMDb::loadSection(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos, ApiMovieDetails section)
+{
+    QNetworkRequest request;
+    request.setRawHeader("Accept", "application/json");
+    request.setUrl(getMovieUrl(id, section));
+
+    QNetworkReply* const reply = m_network.getWithWatcher(request);
+    reply->setProperty("storage", Storage::toVariant(reply, movie));
+    reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
+
+    switch (section) {
+    case ApiMovieDetails::INFOS: connect(reply, &QNetworkReply::finished, this, &TMDb::loadFinished); break;
+    case ApiMovieDetails::CASTS: connect(reply, &QNetworkReply::finished, this, &TMDb::loadCastsFinished); break;
+    case ApiMovieDetails::TRAILERS: connect(reply, &QNetworkReply::finished, this, &TMDb::loadTrailersFinished); break;
+    case ApiMovieDetails::IMAGES: connect(reply, &QNetworkReply::finished, this, &TMDb::loadImagesFinished); break;
+    case ApiMovieDetails::RELEASES: connect(reply, &QNetworkReply::finished, this, &TMDb::loadReleasesFinished); break;
+    }
+}
+
+/// \brief Sections that have to be loaded in addition to the movie's details.
+QVector<TMDb::ApiMovieDetails> TMDb::sectionsToLoad(const QSet<MovieScraperInfo>& infos)
+{
+    QVector<ApiMovieDetails> sections;
     if (infos.contains(MovieScraperInfo::Actors) || infos.contains(MovieScraperInfo::Director)
         || infos.contains(MovieScraperInfo::Writer)) {
-        loadsLeft.append(ScraperData::Casts);
-        request.setUrl(getMovieUrl(id, ApiMovieDetails::CASTS));
-        QNetworkReply* const reply = m_network.getWithWatcher(request);
-        reply->setProperty("storage", Storage::toVariant(reply, movie));
-        reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
-        connect(reply, &QNetworkReply::finished, this, &TMDb::loadCastsFinished);
+        sections.append(ApiMovieDetails::CASTS);
     }
-
-    // Trailers
     if (infos.contains(MovieScraperInfo::Trailer)) {
-        loadsLeft.append(ScraperData::Trailers);
-        request.setUrl(getMovieUrl(id, ApiMovieDetails::TRAILERS));
-        QNetworkReply* const reply = m_network.getWithWatcher(request);
-        reply->setProperty("storage", Storage::toVariant(reply, movie));
-        reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
-        connect(reply, &QNetworkReply::finished, this, &TMDb::loadTrailersFinished);
+        sections.append(ApiMovieDetails::TRAILERS);
     }
-
-    // Images
     if (infos.contains(MovieScraperInfo::Poster) || infos.contains(MovieScraperInfo::Backdrop)) {
-        loadsLeft.append(ScraperData::Images);
-        request.setUrl(getMovieUrl(id, ApiMovieDetails::IMAGES));
-        QNetworkReply* const reply = m_network.getWithWatcher(request);
-        reply->setProperty("storage", Storage::toVariant(reply, movie));
-        reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
-        connect(reply, &QNetworkReply::finished, this, &TMDb::loadImagesFinished);
+        sections.append(ApiMovieDetails::IMAGES);
     }
-
-    // Releases
     if (infos.contains(MovieScraperInfo::Certification)) {
-        loadsLeft.append(ScraperData::Releases);
-        request.setUrl(getMovieUrl(id, ApiMovieDetails::RELEASES));
-        QNetworkReply* const reply = m_network.getWithWatcher(request);
-        reply->setProperty("storage", Storage::toVariant(reply, movie));
-        reply->setProperty("infosToLoad", Storage::toVariant(reply, infos));
-        connect(reply, &QNetworkReply::finished, this, &TMDb::loadReleasesFinished);
+        sections.append(ApiMovieDetails::RELEASES);
     }
+    return sections;
+}
 
-    movie->controller()->setLoadsLeft(loadsLeft);
+ScraperData TMDb::scraperDataForSection(ApiMovieDetails section)
+{
+    switch (section) {
+    case ApiMovieDetails::INFOS: return ScraperData::Infos;
+    case ApiMovieDetails::CASTS: return ScraperData::Casts;
+    case ApiMovieDetails::TRAILERS: return ScraperData::Trailers;
+    case ApiMovieDetails::IMAGES: return ScraperData::Images;
+    case ApiMovieDetails::RELEASES: return ScraperData::Releases;
+    }
+    return ScraperData::Infos;
+}
+
+/// Called when the consolidated movie details (including all requested sections) are downloaded.
+/// Sections missing in the response are loaded separately.
+/// \see TMDb::parseAndAssignInfos
+void TMDb::loadConsolidatedFinished()
+{
+    auto* reply = dynamic_cast<QNetworkReply*>(QObject::sender());
+    Movie* const movie = reply->property("storage").value<Storage*>()->movie();
+    const QSet<MovieScraperInfo> infos = reply->property("infosToLoad").value<Storage*>()->movieInfosToLoad();
+    const QString id = reply->property("tmdbMovieId").toString();
+    reply->deleteLater();
+    if (movie == nullptr) {
+        return;
+    }
+
+    if (reply->error() != QNetworkReply::NoError) {
+        // Separate requests won't help if the movie does not exist or the API key is invalid.
+        if (reply->error() == QNetworkReply::ContentNotFoundError
+            || reply->error() == QNetworkReply::AuthenticationRequiredError) {
+            showNetworkError(*reply);
+            qWarning() << "Network Error (load)" << reply->errorString();
+            movie->controller()->removeFromLoadsLeft(ScraperData::Infos);
+            return;
+        }
+        qWarning() << "[TMDb] Consolidated request failed, loading sections separately:" << reply->errorString();
+        loadDataPerSection(id, movie, infos);
+        return;
+    }
+
+    QJsonParseError parseError{};
+    const QJsonObject parsedJson = QJsonDocument::fromJson(reply->readAll(), &parseError).object();
+    if (parseError.error != QJsonParseError::NoError) {
+        qWarning() << "[TMDb] Error parsing consolidated json, loading sections separately:"
+                   << parseError.errorString();
+        loadDataPerSection(id, movie, infos);
+        return;
+    }
+
+    parseAndAssignInfos(parsedJson, movie, infos);
+
+    QVector<ScraperData> loadsLeft{ScraperData::Infos};
+    QVector<ApiMovieDetails> missingSections;
+    for (const ApiMovieDetails section : sectionsToLoad(infos)) {
+        const QJsonValue sectionJson = parsedJson.value(apiMovieDetailsString(section));
+        if (sectionJson.isObject()) {
+            parseAndAssignInfos(sectionJson.toObject(), movie, infos);
+        } else {
+            missingSections.append(section);
+            loadsLeft.append(scraperDataForSection(section));
+        }
+    }
+
+    if (!missingSections.isEmpty()) {
+        qDebug() << "[TMDb] Sections missing in consolidated response, loading them separately";
+        movie->controller()->setLoadsLeft(loadsLeft);
+        for (const ApiMovieDetails section : missingSections) {
+            loadSection(id, movie, infos, section);
+        }
+    }
+
+    // if the movie is part of a collection then download the collection data
+    // and delay the call to removeFromLoadsLeft(ScraperData::Infos)
+    // to loadCollectionFinished()
+    if (infos.contains(MovieScraperInfo::Set)) {
+        loadCollection(movie, movie->set().tmdbId);
+        return;
+    }
+
+    movie->controller()->removeFromLoadsLeft(ScraperData::Infos);
 }
 
 /// Called when the movie infos are downloaded
@@ -762,19 +863,27 @@ QUrl TMDb::getMovieSearchUrl(const QString& searchStr, const UrlParameterMap& pa
     return QUrl{url.append(queries.toString())};
 }
 
+/// \brief Name of the section in TMDb's API, e.g. "casts" for "/movie/{id}/casts".
+/// Empty for the movie's details.
+QString TMDb::apiMovieDetailsString(ApiMovieDetails type)
+{
+    switch (type) {
+    case ApiMovieDetails::INFOS: return QString{};
+    case ApiMovieDetails::IMAGES: return QStringLiteral("images");
+    case ApiMovieDetails::CASTS: return QStringLiteral("casts");
+    case ApiMovieDetails::TRAILERS: return QStringLiteral("trailers");
+    case ApiMovieDetails::RELEASES: return QStringLiteral("releases");
+    }
+    return QString{};
+}
+
 /// \brief Get the movie URL for TMDb. Adds the API key.
 QUrl TMDb::getMovieUrl(QString movieId, ApiMovieDetails type, const UrlParameterMap& parameters) const
 {
-    const auto typeStr = [type]() {
-        switch (type) {
-        case ApiMovieDetails::INFOS: return QString{};
-        case ApiMovieDetails::IMAGES: return QStringLiteral("/images");
-        case ApiMovieDetails::CASTS: return QStringLiteral("/casts");
-        case ApiMovieDetails::TRAILERS: return QStringLiteral("/trailers");
-        case ApiMovieDetails::RELEASES: return QStringLiteral("/releases");
-        }
-        return QString{};
-    }();
+    QString typeStr = apiMovieDetailsString(type);
+    if (!typeStr.isEmpty()) {
+        typeStr.prepend('/');
+    }
 
     auto url =
         QStringLiteral("https://api.themoviedb.org/3/movie/%1%2?").arg(QUrl::toPercentEncoding(movieId), typeStr);
@@ -793,6 +902,28 @@ QUrl TMDb::getMovieUrl(QString movieId, ApiMovieDetails type, const UrlParameter
     return QUrl{url.append(queries.toString())};
 }
 
+/// \brief Get the URL for the movie's details including the given sections. Adds the API key.
+QUrl TMDb::getConsolidatedMovieUrl(QString movieId, const QVector<ApiMovieDetails>& sections) const
+{
+    auto url = QStringLiteral("https://api.themoviedb.org/3/movie/%1?").arg(QString(QUrl::toPercentEncoding(movieId)));
+    QUrlQuery queries;
+    queries.addQueryItem("api_key", TMDb::apiKey());
+    queries.addQueryItem("language", localeForTMDb());
+
+    QStringList appendToResponse;
+    for (const ApiMovieDetails section : sections) {
+        appendToResponse << apiMovieDetailsString(section);
+        if (section == ApiMovieDetails::IMAGES) {
+            queries.addQueryItem("include_image_language", "en,null," + language());
+        }
+    }
+    if (!appendToResponse.isEmpty()) {
+        queries.addQueryItem("append_to_response", appendToResponse.join(','));
+    }
+
+    return QUrl{url.append(queries.toString())};
+}
+
 /// \brief Get the collection URL for TMDb. Adds the API key.
 QUrl TMDb::getCollectionUrl(QString collectionId) const
 {
@@ -820,7 +951,15 @@ void TMDb::parseAndAssignInfos(QString json, Movie* movie, QSet<MovieScraperInfo
         qWarning() << "Error parsing info json " << parseError.errorString();
         return;
     }
+    parseAndAssignInfos(parsedJson, movie, infos);
+}
 
+/**
+ * \brief Assigns the already parsed JSON data to the given movie object.
+ *        The object may be the movie's details or one of its sections (releases, trailers, casts, images).
+ */
+void TMDb::parseAndAssignInfos(const QJsonObject& parsedJson, Movie* movie, const QSet<MovieScraperInfo>& infos)
+{
     // Infos
     int tmdbId = parsedJson.value("id").toInt(-1);
     if (tmdbId > -1) {
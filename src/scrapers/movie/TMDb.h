@@ -5,6 +5,7 @@
 #include "scrapers/movie/MovieScraperInterface.h"
 
 #include <QComboBox>
+#include <QJsonObject>
 #include <QLocale>
 #include <QMap>
 #include <QMutex>
@@ -42,6 +43,7 @@ public:
 
 private slots:
     void searchFinished();
+    void loadConsolidatedFinished();
     void loadFinished();
     void loadCollectionFinished();
     void loadCastsFinished();
@@ -85,9 +87,18 @@ private:
     QUrl getMovieSearchUrl(const QString& searchStr, const UrlParameterMap& parameters) const;
     QUrl
     getMovieUrl(QString movieId, ApiMovieDetails type, const UrlParameterMap& parameters = UrlParameterMap{}) const;
+    QUrl getConsolidatedMovieUrl(QString movieId, const QVector<ApiMovieDetails>& sections) const;
     QUrl getCollectionUrl(QString collectionId) const;
+    static QString apiMovieDetailsString(ApiMovieDetails type);
+
+    void loadDataConsolidated(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos);
+    void loadDataPerSection(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos);
+    void loadSection(const QString& id, Movie* movie, const QSet<MovieScraperInfo>& infos, ApiMovieDetails section);
+    static QVector<ApiMovieDetails> sectionsToLoad(const QSet<MovieScraperInfo>& infos);
+    static ScraperData scraperDataForSection(ApiMovieDetails section);
 
     void parseAndAssignInfos(QString json, Movie* movie, QSet<MovieScraperInfo> infos);
+    void parseAndAssignInfos(const QJsonObject& parsedJson, Movie* movie, const QSet<MovieScraperInfo>& infos);
     /// Load the given collection (TMDb id) and store the content in the movie.
     void loadCollection(Movie* movie, const TmdbId& collectionTmdbId);
 };
@@ -30,7 +30,10 @@
  * \param parent Parent QObject that owns the instance.
  */
 TheTvDb::TheTvDb(QObject* parent) :
-    m_widget{new QWidget(MainWindow::instance())}, m_imdb{new IMDB(this)}, m_dummyMovie{new Movie(QStringList(), this)}
+    m_episodeBatchLoader{new thetvdb::EpisodeBatchLoader(this)},
+    m_widget{new QWidget(MainWindow::instance())},
+    m_imdb{new IMDB(this)},
+    m_dummyMovie{new Movie(QStringList(), this)}
 {
     setParent(parent);
 
@@ -109,7 +112,8 @@ void TheTvDb::loadTvShowData(TvDbId tvDbId,
 
     // Load the show and update database with episodes
     show->setTvdbId(tvDbId);
-    auto* loader = new thetvdb::ShowLoader(*show, m_language, showInfosToLoad, episodeInfosToLoad, updateType, this);
+    auto* loader = new thetvdb::ShowLoader(
+        *show, m_language, showInfosToLoad, episodeInfosToLoad, updateType, *m_episodeBatchLoader, this);
     connect(loader, &thetvdb::ShowLoader::sigLoadDone, this, [=]() {
         qDebug() << "[TheTvDb] TV show with ID" << tvDbId.toString() << "loaded";
         loader->storeEpisodesInDatabase();
@@ -137,7 +141,7 @@ void TheTvDb::loadShowFromImdb(TvShow& show,
     auto request = mediaelch::network::requestWithDefaults(url);
     request.setRawHeader("Accept-Language", "en;q=0.8");
 
-    QNetworkReply* reply = m_qnam.get(request);
+    QNetworkReply* reply = m_network.get(request);
     new NetworkReplyWatcher(this, reply);
 
     connect(reply, &QNetworkReply::finished, this, [=, &show]() {
@@ -182,7 +186,7 @@ void TheTvDb::loadEpisodesFromImdb(TvShow& show, QVector<TvShowEpisode*> episode
         auto request = mediaelch::network::requestWithDefaults(url);
         request.setRawHeader("Accept-Language", "en;q=0.8");
 
-        QNetworkReply* reply = m_qnam.get(request);
+        QNetworkReply* reply = m_network.get(request);
         reply->setProperty("storage", Storage::toVariant(reply, episode));
         reply->setProperty("show", Storage::toVariant(reply, &show));
         reply->setProperty("episodes", Storage::toVariant(reply, episodes));
@@ -214,7 +218,7 @@ void TheTvDb::loadEpisodesFromImdb(TvShow& show, QVector<TvShowEpisode*> episode
     QNetworkRequest request{url};
     request.setRawHeader("Accept-Language", "en;q=0.8");
 
-    QNetworkReply* reply = m_qnam.get(request);
+    QNetworkReply* reply = m_network.get(request);
     reply->setProperty("storage", Storage::toVariant(reply, episode));
     reply->setProperty("show", Storage::toVariant(reply, &show));
     reply->setProperty("episodes", Storage::toVariant(reply, episodes));
@@ -230,7 +234,7 @@ void TheTvDb::loadTvShowEpisodeData(TvDbId tvDbId, TvShowEpisode* episode, QSet<
     qDebug() << "[TheTvDb] Load single episode of TV show with ID:" << tvDbId.toString();
     episode->clear(infosToLoad);
 
-    auto* api = new thetvdb::EpisodeLoader(tvDbId, *episode, m_language, infosToLoad, this);
+    auto* api = new thetvdb::EpisodeLoader(tvDbId, *episode, m_language, infosToLoad, *m_episodeBatchLoader, this);
     connect(api, &thetvdb::EpisodeLoader::sigLoadDone, this, [=]() {
         qDebug() << "[TheTvDb] Single episode scraper done";
         api->deleteLater();
@@ -360,7 +364,8 @@ void TheTvDb::fillDatabaseWithAllEpisodes(TvShow& show, std::function<void()> ca
         ShowScraperInfo::Thumbnail};
 
     const TvDbId id = show.tvdbId();
-    auto* loader = new thetvdb::ShowLoader(show, m_language, {}, episodeInfos, TvShowUpdateType::AllEpisodes, this);
+    auto* loader = new thetvdb::ShowLoader(
+        show, m_language, {}, episodeInfos, TvShowUpdateType::AllEpisodes, *m_episodeBatchLoader, this);
 
     connect(loader, &thetvdb::ShowLoader::sigLoadDone, this, [=]() {
         qDebug() << "[TheTvDb] All episodes with show ID" << id.toString() << "loaded";
@@ -476,7 +481,7 @@ void TheTvDb::onImdbSeasonLoaded()
     auto request = mediaelch::network::requestWithDefaults(url);
     request.setRawHeader("Accept-Language", "en;q=0.8");
 
-    QNetworkReply* imdbReply = m_qnam.get(request);
+    QNetworkReply* imdbReply = m_network.get(request);
     new NetworkReplyWatcher(this, imdbReply);
     imdbReply->setProperty("storage", Storage::toVariant(imdbReply, episode));
     imdbReply->setProperty("infosToLoad", Storage::toVariant(imdbReply, infos));
@@ -523,7 +528,7 @@ void TheTvDb::onEpisodesImdbSeasonLoaded()
         auto request = mediaelch::network::requestWithDefaults(url);
         request.setRawHeader("Accept-Language", "en;q=0.8");
 
-        QNetworkReply* episodeImdbReply = m_qnam.get(request);
+        QNetworkReply* episodeImdbReply = m_network.get(request);
         new NetworkReplyWatcher(this, episodeImdbReply);
         episodeImdbReply->setProperty("storage", Storage::toVariant(episodeImdbReply, episode));
         episodeImdbReply->setProperty("show", Storage::toVariant(episodeImdbReply, show));
@@ -2,15 +2,16 @@
 
 #include "data/ImdbId.h"
 #include "globals/ScraperInfos.h"
+#include "network/NetworkManager.h"
 #include "scrapers/movie/IMDB.h"
 #include "scrapers/tv_show/TvScraperInterface.h"
+#include "scrapers/tv_show/thetvdb/EpisodeBatchLoader.h"
 #include "tv_shows/EpisodeNumber.h"
 #include "tv_shows/SeasonNumber.h"
 
 #include <QComboBox>
 #include <QDomElement>
 #include <QList>
-#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QObject>
 #include <QString>
@@ -57,7 +58,9 @@ private slots:
 
 private:
     QString m_language{"en"};
-    QNetworkAccessManager m_qnam;
+    mediaelch::network::NetworkManager m_network;
+    /// Shared by all show and episode loaders so that a show's episode list is only loaded once.
+    thetvdb::EpisodeBatchLoader* m_episodeBatchLoader = nullptr;
 
     // UI
     QComboBox* m_languageComboBox = nullptr;
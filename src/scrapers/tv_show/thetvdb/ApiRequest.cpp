@@ -31,8 +31,7 @@ void ApiRequest::sendGetRequest(const QUrl& url, std::function<void(QString)> ca
         QNetworkRequest request(url);
         addHeadersToRequest(request);
 
-        QNetworkReply* reply(m_qnam.get(request));
-        new NetworkReplyWatcher(this, reply);
+        QNetworkReply* reply = m_network.getWithWatcher(request);
 
         connect(reply, &QNetworkReply::finished, [reply, callback]() {
             QString data{"{}"};
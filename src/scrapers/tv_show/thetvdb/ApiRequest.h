@@ -1,6 +1,6 @@
 #pragma once
 
-#include "network/NetworkReplyWatcher.h"
+#include "network/NetworkManager.h"
 #include "scrapers/tv_show/thetvdb/Cache.h"
 
 #include <QByteArray>
@@ -49,7 +49,7 @@ private:
     void addHeadersToRequest(QNetworkRequest& request);
 
     const QString m_language;
-    QNetworkAccessManager m_qnam;
+    mediaelch::network::NetworkManager m_network;
 };
 
 } // namespace thetvdb
@@ -0,0 +1,126 @@
+#include "scrapers/tv_show/thetvdb/EpisodeBatchLoader.h"
+
+#include "scrapers/tv_show/thetvdb/ApiRequest.h"
+
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <memory>
+
+namespace thetvdb {
+
+void EpisodeBatchLoader::loadEpisodes(TvDbId showId,
+    const QString& language,
+    std::function<void(const Episodes&)> callback)
+{
+    const QString key = QStringLiteral("%1/%2").arg(showId.toString(), language);
+    if (!m_cache.request(key, std::move(callback))) {
+        return;
+    }
+
+    qDebug() << "[TheTvDb][EpisodeBatchLoader] Load all episodes of show" << showId.toString();
+
+    auto* request = new ApiRequest(language, this);
+    const auto finish = [this, request, key](const Episodes& episodes, bool isComplete) {
+        request->deleteLater();
+        // Don't cache errors or lists with missing pages.
+        m_cache.finish(key, episodes, isComplete && !episodes.isEmpty());
+    };
+
+    request->sendGetRequest(getEpisodesUrl(showId, 1), [request, showId, finish](QString json) {
+        Episodes firstPage;
+        Paginate paginate;
+        const bool ok = parsePage(json, firstPage, paginate);
+        if (!ok || paginate.last <= 1) {
+            finish(firstPage, ok);
+            return;
+        }
+
+        // Request all remaining pages at once and merge them in order once all have arrived.
+        auto pages = std::make_shared<QVector<Episodes>>(paginate.last);
+        (*pages)[0] = firstPage;
+        auto pagesLeft = std::make_shared<int>(paginate.last - 1);
+        auto isComplete = std::make_shared<bool>(true);
+
+        for (ApiPage page = 2; page <= paginate.last; ++page) {
+            const auto onPage = [page, pages, pagesLeft, isComplete, finish](QString pageJson) {
+                Paginate pagePaginate;
+                if (!parsePage(pageJson, (*pages)[page - 1], pagePaginate)) {
+                    *isComplete = false;
+                }
+                if (--(*pagesLeft) > 0) {
+                    return;
+                }
+                Episodes episodes;
+                for (const Episodes& pageEpisodes : *pages) {
+                    episodes << pageEpisodes;
+                }
+                finish(episodes, *isComplete);
+            };
+            request->sendGetRequest(getEpisodesUrl(showId, page), onPage);
+        }
+    });
+}
+
+QJsonObject EpisodeBatchLoader::findEpisode(const Episodes& episodes, TvDbId episodeId)
+{
+    for (const QJsonObject& episode : episodes) {
+        if (TvDbId(episode.value("id").toInt(-2)) == episodeId) {
+            return episode;
+        }
+    }
+    return {};
+}
+
+QJsonObject
+EpisodeBatchLoader::findEpisode(const Episodes& episodes, SeasonNumber season, EpisodeNumber episode, SeasonOrder order)
+{
+    const bool isDvdOrder = (order == SeasonOrder::Dvd);
+    const QString seasonKey = isDvdOrder ? "dvdSeason" : "airedSeason";
+    const QString episodeKey = isDvdOrder ? "dvdEpisodeNumber" : "airedEpisodeNumber";
+
+    for (const QJsonObject& episodeObj : episodes) {
+        if (SeasonNumber(episodeObj.value(seasonKey).toInt(-2)) == season
+            && EpisodeNumber(episodeObj.value(episodeKey).toInt(-2)) == episode) {
+            return episodeObj;
+        }
+    }
+    return {};
+}
+
+QUrl EpisodeBatchLoader::getEpisodesUrl(TvDbId showId, ApiPage page)
+{
+    return ApiRequest::getFullUrl(
+        QStringLiteral("/series/%1/episodes?page=%2").arg(showId.toString(), QString::number(page)));
+}
+
+bool EpisodeBatchLoader::parsePage(const QString& json, Episodes& episodes, Paginate& paginate)
+{
+    QJsonParseError parseError{};
+    const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
+
+    if (parseError.error != QJsonParseError::NoError) {
+        qWarning() << "[TheTvDb][EpisodeBatchLoader] Error parsing TheTvDb episode data:" << parseError.errorString();
+        return false;
+    }
+    // ApiRequest passes "{}" on network errors.
+    if (!parsedJson.value("data").isArray()) {
+        return false;
+    }
+
+    const auto episodesArray = parsedJson.value("data").toArray();
+    episodes.reserve(episodes.size() + episodesArray.size());
+    for (const auto& episodeValue : episodesArray) {
+        episodes.append(episodeValue.toObject());
+    }
+
+    const auto paginateObj = parsedJson.value("links").toObject();
+    paginate.first = paginateObj.value("first").toInt();
+    paginate.last = paginateObj.value("last").toInt();
+    paginate.next = paginateObj.value("next").toInt();
+    paginate.prev = paginateObj.value("prev").toInt();
+    return true;
+}
+
+} // namespace thetvdb
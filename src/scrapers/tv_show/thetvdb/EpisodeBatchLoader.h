@@ -0,0 +1,56 @@
+#pragma once
+
+#include "globals/Globals.h"
+#include "network/SingleFlightCache.h"
+#include "scrapers/tv_show/thetvdb/ShowParser.h"
+#include "tv_shows/EpisodeNumber.h"
+#include "tv_shows/SeasonNumber.h"
+#include "tv_shows/SeasonOrder.h"
+
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+#include <QUrl>
+#include <QVector>
+
+#include <functional>
+
+namespace thetvdb {
+
+/**
+ * \brief Loads all episodes of a TV show from TheTvDb's paginated episode list.
+ *
+ * The first page tells us how many pages there are; all remaining pages are
+ * requested at once. Concurrent requests for the same show share one load and
+ * the result is kept for a short time, so that scraping the episodes of a show
+ * one by one only loads the episode list once.
+ */
+class EpisodeBatchLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// Episode objects of all pages in TheTvDb's order.
+    using Episodes = QVector<QJsonObject>;
+
+    explicit EpisodeBatchLoader(QObject* parent = nullptr) : QObject(parent) {}
+
+    /// \brief Loads all episodes of the show and passes them to the callback.
+    /// The list is empty if the episodes could not be loaded.
+    void loadEpisodes(TvDbId showId, const QString& language, std::function<void(const Episodes&)> callback);
+
+    /// \brief Returns the episode with the given TheTvDb id or an empty object.
+    static QJsonObject findEpisode(const Episodes& episodes, TvDbId episodeId);
+    /// \brief Returns the episode with the given season and episode number or an empty object.
+    static QJsonObject
+    findEpisode(const Episodes& episodes, SeasonNumber season, EpisodeNumber episode, SeasonOrder order);
+
+private:
+    static QUrl getEpisodesUrl(TvDbId showId, ApiPage page);
+    /// \brief Appends the page's episodes. Returns false if the page could not be loaded or parsed.
+    static bool parsePage(const QString& json, Episodes& episodes, Paginate& paginate);
+
+    mediaelch::network::SingleFlightCache<Episodes> m_cache{this};
+};
+
+} // namespace thetvdb
@@ -5,7 +5,9 @@
 #include "settings/Settings.h"
 #include "tv_shows/TvShowEpisode.h"
 
+#include <QHash>
 #include <QObject>
+#include <QPointer>
 #include <QString>
 #include <utility>
 
@@ -26,17 +28,57 @@ EpisodeLoader::EpisodeLoader(TvDbId showId,
     TvShowEpisode& episode,
     QString language,
     QSet<ShowScraperInfo> infosToLoad,
+    EpisodeBatchLoader& batchLoader,
     QObject* parent) :
     QObject(parent),
     m_showId{std::move(showId)},
     m_episode{episode},
+    m_language{language},
     m_apiRequest(language),
+    m_batchLoader{batchLoader},
     m_infosToLoad{std::move(infosToLoad)}
 {
     setParent(parent);
 }
 
 void EpisodeLoader::loadData()
+{
+    if (m_showId.isValid()) {
+        loadFromEpisodeList();
+        return;
+    }
+    loadWithoutEpisodeList();
+}
+
+/// \brief Loads the episode from the show's episode list.
+/// The list is shared by all episodes of the show, so scraping a whole season
+/// only loads it once. The episode itself is only requested if the list lacks
+/// some of the requested details.
+void EpisodeLoader::loadFromEpisodeList()
+{
+    // The batch loader is shared and may call back after this loader was deleted.
+    QPointer<EpisodeLoader> self(this);
+    m_batchLoader.loadEpisodes(m_showId, m_language, [this, self](const EpisodeBatchLoader::Episodes& episodes) {
+        if (self.isNull()) {
+            return;
+        }
+        const QJsonObject episodeObj = findEpisode(episodes);
+        if (episodeObj.isEmpty()) {
+            loadWithoutEpisodeList();
+            return;
+        }
+        if (hasAllInfos(episodeObj)) {
+            EpisodeParser parser(m_episode, m_infosToLoad);
+            parser.parseInfos(episodeObj);
+            emit sigLoadDone();
+            return;
+        }
+        m_episode.setTvdbId(TvDbId(episodeObj.value("id").toInt()));
+        loadEpisode();
+    });
+}
+
+void EpisodeLoader::loadWithoutEpisodeList()
 {
     if (m_episode.tvdbId().isValid()) {
         loadEpisode();
@@ -46,6 +88,36 @@ void EpisodeLoader::loadData()
     loadSeason();
 }
 
+QJsonObject EpisodeLoader::findEpisode(const EpisodeBatchLoader::Episodes& episodes) const
+{
+    if (m_episode.tvdbId().isValid()) {
+        return EpisodeBatchLoader::findEpisode(episodes, m_episode.tvdbId());
+    }
+    return EpisodeBatchLoader::findEpisode(
+        episodes, m_episode.seasonNumber(), m_episode.episodeNumber(), Settings::instance()->seasonOrder());
+}
+
+/// \brief Checks whether the episode list contains all details that should be loaded.
+/// TheTvDb's episode list may omit some fields that /episodes/{id} returns.
+bool EpisodeLoader::hasAllInfos(const QJsonObject& episodeObj) const
+{
+    static const QHash<ShowScraperInfo, QString> jsonKeys = {
+        {ShowScraperInfo::Director, "directors"},
+        {ShowScraperInfo::Writer, "writers"},
+        {ShowScraperInfo::Title, "episodeName"},
+        {ShowScraperInfo::FirstAired, "firstAired"},
+        {ShowScraperInfo::Overview, "overview"},
+        {ShowScraperInfo::Rating, "siteRating"},
+        {ShowScraperInfo::Thumbnail, "filename"},
+    };
+    for (const ShowScraperInfo info : m_infosToLoad) {
+        if (jsonKeys.contains(info) && !episodeObj.contains(jsonKeys.value(info))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void EpisodeLoader::loadSeason()
 {
     qDebug() << "[TheTvDb][EpisodeLoader] Have to load season first.";
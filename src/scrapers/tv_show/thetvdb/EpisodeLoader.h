@@ -2,10 +2,11 @@
 
 #include "globals/Globals.h"
 #include "scrapers/tv_show/thetvdb/ApiRequest.h"
+#include "scrapers/tv_show/thetvdb/EpisodeBatchLoader.h"
 #include "tv_shows/SeasonOrder.h"
 #include "tv_shows/TvShowEpisode.h"
 
-#include <QNetworkAccessManager>
+#include <QJsonObject>
 #include <QObject>
 #include <QString>
 #include <QUrl>
@@ -26,12 +27,14 @@ public:
      * \param episode     Episode to store data in.
      * \param language    TheTvDb's language key.
      * \param infosToLoad Information that should be loaded from TheTvDb
+     * \param batchLoader Loader for the show's episode list. Shared with other loaders.
      * \param parent      Parent QObject that owns this instance.
      */
     EpisodeLoader(TvDbId showId,
         TvShowEpisode& episode,
         QString language,
         QSet<ShowScraperInfo> infosToLoad,
+        EpisodeBatchLoader& batchLoader,
         QObject* parent = nullptr);
 
     static const QSet<ShowScraperInfo> scraperInfos;
@@ -42,14 +45,19 @@ signals:
     void sigLoadDone();
 
 private:
-    QNetworkAccessManager m_qnam;
     QSet<ShowScraperInfo> m_loaded;
 
     TvDbId m_showId;
     TvShowEpisode& m_episode;
+    QString m_language;
     ApiRequest m_apiRequest;
+    EpisodeBatchLoader& m_batchLoader;
     QSet<ShowScraperInfo> m_infosToLoad;
 
+    void loadFromEpisodeList();
+    void loadWithoutEpisodeList();
+    QJsonObject findEpisode(const EpisodeBatchLoader::Episodes& episodes) const;
+    bool hasAllInfos(const QJsonObject& episodeObj) const;
     void loadSeason();
     void loadEpisode();
     void emitLoaded();
@@ -5,7 +5,6 @@
 #include "scrapers/tv_show/thetvdb/ApiRequest.h"
 
 #include <QJsonObject>
-#include <QNetworkAccessManager>
 #include <QObject>
 #include <QString>
 
@@ -23,7 +22,6 @@ signals:
     void sigSearchDone(QVector<ScraperSearchResult>);
 
 private:
-    QNetworkAccessManager m_qnam;
     ApiRequest m_apiRequest;
 
     QVector<ScraperSearchResult> parseSearch(const QString& json);
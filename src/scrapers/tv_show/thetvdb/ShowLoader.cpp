@@ -37,15 +37,19 @@ const QSet<ShowScraperInfo> ShowLoader::scraperInfos = {ShowScraperInfo::Actors,
 /// \param showInfosToLoad    Show information to load. If no item is given, only basic information will be scraped.
 /// \param episodeInfosToLoad Episode information to load.
 /// \param updateType         Tells whether to update only the show, all episodes, new episodes, etc.
+/// \param episodeBatchLoader Loader for the show's episode list. Shared with other loaders.
 ShowLoader::ShowLoader(TvShow& show,
     QString language,
     QSet<ShowScraperInfo> showInfosToLoad,
     QSet<ShowScraperInfo> episodeInfosToLoad,
     TvShowUpdateType updateType,
+    EpisodeBatchLoader& episodeBatchLoader,
     QObject* parent) :
     QObject(parent),
     m_show{show},
+    m_language{language},
     m_apiRequest(language),
+    m_episodeBatchLoader{episodeBatchLoader},
     m_episodeInfosToLoad{std::move(episodeInfosToLoad)},
     m_updateType{updateType},
     m_parser(show, showInfosToLoad)
@@ -73,7 +77,7 @@ void ShowLoader::loadShowAndEpisodes()
     }
 
     if (isEpisodeUpdateType(m_updateType)) {
-        loadAndStoreEpisodes(ApiPage{1});
+        loadAndStoreEpisodes();
     } else {
         m_episodesLoaded = true;
     }
@@ -158,17 +162,14 @@ void ShowLoader::loadImages(ShowScraperInfo imageType)
     });
 }
 
-void ShowLoader::loadAndStoreEpisodes(ApiPage page)
+void ShowLoader::loadAndStoreEpisodes()
 {
-    m_apiRequest.sendGetRequest(getEpisodesUrl(page), [this](QString json) {
-        Paginate p = m_parser.parseEpisodes(json, m_episodeInfosToLoad);
-        if (p.hasNextPage()) {
-            return loadAndStoreEpisodes(p.next);
-        }
-
-        m_episodesLoaded = true;
-        checkIfDone();
-    });
+    m_episodeBatchLoader.loadEpisodes(
+        m_show.tvdbId(), m_language, [this](const EpisodeBatchLoader::Episodes& episodes) {
+            m_parser.parseEpisodes(episodes, m_episodeInfosToLoad);
+            m_episodesLoaded = true;
+            checkIfDone();
+        });
 }
 
 void ShowLoader::storeEpisodesInDatabase()
@@ -250,12 +251,6 @@ QUrl ShowLoader::getImagesUrl(ShowScraperInfo type) const
         QStringLiteral("/series/%1/images/query?keyType=%2").arg(m_show.tvdbId().toString(), typeStr));
 }
 
-QUrl ShowLoader::getEpisodesUrl(ApiPage page) const
-{
-    return ApiRequest::getFullUrl(
-        QStringLiteral("/series/%1/episodes?page=%2").arg(m_show.tvdbId().toString(), QString::number(page)));
-}
-
 void ShowLoader::mergeEpisode(TvShowEpisode* episode)
 {
     if (episode == nullptr) {
@@ -3,10 +3,10 @@
 #include "globals/Globals.h"
 #include "scrapers/tv_show/thetvdb/ApiRequest.h"
 #include "scrapers/tv_show/thetvdb/Cache.h"
+#include "scrapers/tv_show/thetvdb/EpisodeBatchLoader.h"
 #include "scrapers/tv_show/thetvdb/ShowParser.h"
 #include "tv_shows/TvShow.h"
 
-#include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QObject>
@@ -25,6 +25,7 @@ public:
         QSet<ShowScraperInfo> showInfosToLoad,
         QSet<ShowScraperInfo> episodeInfosToLoad,
         TvShowUpdateType updateType,
+        EpisodeBatchLoader& episodeBatchLoader,
         QObject* parent = nullptr);
 
     static const QSet<ShowScraperInfo> scraperInfos;
@@ -51,7 +52,9 @@ private:
     bool m_episodesLoaded{false};
 
     TvShow& m_show;
+    QString m_language;
     ApiRequest m_apiRequest;
+    EpisodeBatchLoader& m_episodeBatchLoader;
     QSet<ShowScraperInfo> m_infosToLoad;
     QSet<ShowScraperInfo> m_episodeInfosToLoad;
     TvShowUpdateType m_updateType;
@@ -60,13 +63,12 @@ private:
     void loadTvShow();
     void loadActors();
     void loadImages(ShowScraperInfo imageType);
-    void loadAndStoreEpisodes(ApiPage page);
+    void loadAndStoreEpisodes();
 
     void checkIfDone();
     QUrl getFullUrl(const QString& suffix) const;
     QUrl getShowUrl(ApiShowDetails type) const;
     QUrl getImagesUrl(ShowScraperInfo type) const;
-    QUrl getEpisodesUrl(ApiPage page) const;
 
     void mergeEpisode(TvShowEpisode* episode);
     const TvShowEpisode* findLoadedEpisode(SeasonNumber season, EpisodeNumber episode);
@@ -156,40 +156,23 @@ void ShowParser::parseImages(const QString& json)
 }
 
 /**
- * \brief Parses episodes from the json and stores them in this object.
+ * \brief Parses the given episode objects and stores them in this object.
  * \see ShowParser::episodes()
  */
-Paginate ShowParser::parseEpisodes(const QString& json, QSet<ShowScraperInfo> episodeInfosToLoad)
+void ShowParser::parseEpisodes(const QVector<QJsonObject>& episodes, QSet<ShowScraperInfo> episodeInfosToLoad)
 {
     if (!m_show.tvdbId().isValid()) {
         qWarning() << "[TheTvDb][ShowParser] Can't parse episodes without TheTvDb id:" << m_show.tvdbId().toString();
-        return Paginate{};
-    }
-
-    QJsonParseError parseError{};
-    const auto parsedJson = QJsonDocument::fromJson(json.toUtf8(), &parseError).object();
-    const auto paginateObj = parsedJson.value("links").toObject();
-    const auto episodesArray = parsedJson.value("data").toArray();
-
-    if (parseError.error != QJsonParseError::NoError) {
-        qWarning() << "[TheTvDb][ShowParser] Error parsing TheTvDb episode data:" << parseError.errorString() << json;
-        return Paginate{};
+        return;
     }
 
-    for (const auto& episodeValue : episodesArray) {
-        const auto episodeObj = episodeValue.toObject();
+    m_episodes.reserve(m_episodes.size() + static_cast<size_t>(episodes.size()));
+    for (const QJsonObject& episodeObj : episodes) {
         auto episode = std::make_unique<TvShowEpisode>();
         EpisodeParser parser(*episode, episodeInfosToLoad);
         parser.parseInfos(episodeObj);
         m_episodes.push_back(std::move(episode));
     }
-
-    Paginate p;
-    p.first = paginateObj.value("first").toInt();
-    p.last = paginateObj.value("last").toInt();
-    p.next = paginateObj.value("next").toInt();
-    p.prev = paginateObj.value("prev").toInt();
-    return p;
 }
 
 } // namespace thetvdb
@@ -3,6 +3,7 @@
 #include "globals/Globals.h"
 #include "tv_shows/TvShow.h"
 
+#include <QJsonObject>
 #include <QString>
 #include <QVector>
 #include <memory>
@@ -30,7 +31,7 @@ public:
     void parseInfos(const QString& json);
     void parseActors(const QString& json);
     void parseImages(const QString& json);
-    Paginate parseEpisodes(const QString& json, QSet<ShowScraperInfo> episodeInfosToLoad);
+    void parseEpisodes(const QVector<QJsonObject>& episodes, QSet<ShowScraperInfo> episodeInfosToLoad);
 
     const std::vector<std::unique_ptr<TvShowEpisode>>& episodes() const { return m_episodes; }
 
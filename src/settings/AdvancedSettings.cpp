@@ -159,6 +159,21 @@ bool AdvancedSettings::writeThumbUrlsToNfo() const
     return m_writeThumbUrlsToNfo;
 }
 
+bool AdvancedSettings::verifyImportedFiles() const
+{
+    return m_verifyImportedFiles;
+}
+
+int AdvancedSettings::parallelExtractions() const
+{
+    return m_parallelExtractions;
+}
+
+bool AdvancedSettings::watchLibrary() const
+{
+    return m_watchLibrary;
+}
+
 mediaelch::ThumbnailDimensions AdvancedSettings::episodeThumbnailDimensions() const
 {
     return m_episodeThumbnailDimensions;
@@ -166,22 +181,30 @@ mediaelch::ThumbnailDimensions AdvancedSettings::episodeThumbnailDimensions() co
 
 bool AdvancedSettings::isFileExcluded(QString file) const
 {
-    for (const auto& pattern : m_excludePatterns) {
-        if (pattern.matchFilename(file)) {
-            return true;
-        }
-    }
-    return false;
+    return m_excludeMatcher.matchFile(file).hasMatch();
 }
 
 bool AdvancedSettings::isFolderExcluded(QString dir) const
 {
-    for (const auto& pattern : m_excludePatterns) {
-        if (pattern.matchFoldername(dir)) {
-            return true;
+    return m_excludeMatcher.matchFolder(dir).hasMatch();
+}
+
+const mediaelch::FileNameMatcher& AdvancedSettings::excludeMatcher() const
+{
+    return m_excludeMatcher;
+}
+
+void AdvancedSettings::compileExcludePatterns()
+{
+    m_excludeMatcher = mediaelch::FileNameMatcher();
+    for (const FileSearchExclude& pattern : m_excludePatterns) {
+        if (pattern.isFilePattern()) {
+            m_excludeMatcher.addFilePattern(pattern.regex());
+        } else {
+            m_excludeMatcher.addFolderPattern(pattern.regex());
         }
     }
-    return false;
+    m_excludeMatcher.compile();
 }
 
 bool AdvancedSettings::useFirstStudioOnly() const
@@ -242,6 +265,9 @@ QDebug operator<<(QDebug dbg, const AdvancedSettings& settings)
     out << "        width:               " << settings.m_episodeThumbnailDimensions.width << nl;
     out << "        height:              " << settings.m_episodeThumbnailDimensions.height << nl;
     out << "    bookletCut:              " << settings.m_bookletCut << nl;
+    out << "    verifyImportedFiles:     " << (settings.m_verifyImportedFiles ? "true" : "false") << nl;
+    out << "    parallelExtractions:     " << settings.m_parallelExtractions << nl;
+    out << "    watchLibrary:            " << (settings.m_watchLibrary ? "true" : "false") << nl;
     out << "    useFirstStudioOnly:      " << (settings.m_useFirstStudioOnly ? "true" : "false") << nl;
     out << "    exclude patterns:        " << nl;
     printExcludePatterns(settings.m_excludePatterns);
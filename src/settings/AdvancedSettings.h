@@ -1,6 +1,7 @@
 #pragma once
 
 #include "file/FileFilter.h"
+#include "file/FileNameMatcher.h"
 #include "globals/Globals.h"
 #include "image/ThumbnailDimensions.h"
 
@@ -45,6 +46,9 @@ public:
 
     QString toString() const { return excludeTypeToString(m_type) + ": " + m_regex.pattern(); }
 
+    bool isFilePattern() const { return m_type == ExcludeType::File; }
+    const QRegularExpression& regex() const { return m_regex; }
+
 private:
     enum class ExcludeType
     {
@@ -96,16 +100,23 @@ public:
     bool portableMode() const;
     int bookletCut() const;
     bool writeThumbUrlsToNfo() const;
+    bool verifyImportedFiles() const;
+    int parallelExtractions() const;
+    bool watchLibrary() const;
     mediaelch::ThumbnailDimensions episodeThumbnailDimensions() const;
 
     bool isFileExcluded(QString file) const;
     bool isFolderExcluded(QString dir) const;
+    /// \brief Compiled matcher of all exclude patterns. File searchers may add
+    /// their own rules to a copy, see FileNameMatcher.
+    const mediaelch::FileNameMatcher& excludeMatcher() const;
 
     friend class AdvancedSettingsXmlReader;
     friend QDebug operator<<(QDebug dbg, const AdvancedSettings& settings);
 
 private:
     void setLocale(const QString& locale);
+    void compileExcludePatterns();
 
 private:
     bool m_debugLog = false;
@@ -124,10 +135,14 @@ private:
     QHash<QString, QString> m_countryMappings;
     mediaelch::ThumbnailDimensions m_episodeThumbnailDimensions;
     QVector<FileSearchExclude> m_excludePatterns;
+    mediaelch::FileNameMatcher m_excludeMatcher;
     bool m_forceCache = false;
     bool m_portableMode = false;
     int m_bookletCut = 2;
     bool m_writeThumbUrlsToNfo = true;
+    bool m_verifyImportedFiles = false;
+    int m_parallelExtractions = 2;
+    bool m_watchLibrary = false;
     bool m_useFirstStudioOnly = false;
 };
 
@@ -99,6 +99,16 @@ void AdvancedSettingsXmlReader::parseSettings(const QString& xmlSource)
         } else if (m_xml.name() == "writeThumbUrlsToNfo") {
             expectBool(m_settings.m_writeThumbUrlsToNfo);
 
+        } else if (m_xml.name() == "verifyImportedFiles") {
+            expectBool(m_settings.m_verifyImportedFiles);
+
+        } else if (m_xml.name() == "parallelExtractions") {
+            const auto inRange = [](int jobs) { return jobs >= 1 && jobs <= 16; };
+            expectIntChecked(m_settings.m_parallelExtractions, inRange);
+
+        } else if (m_xml.name() == "watchLibrary") {
+            expectBool(m_settings.m_watchLibrary);
+
         } else if (m_xml.name() == "episodeThumb") {
             while (m_xml.readNextStartElement()) {
                 if (m_xml.name() == "width") {
@@ -253,7 +263,7 @@ void AdvancedSettingsXmlReader::loadExcludePatterns()
             if (!pattern.isValid()) {
                 qCritical() << "[AdvancedSettings] Invalid regular expression! Message:" << pattern.errorString();
                 addError("pattern", ParseErrorType::InvalidValue);
-                return;
+                break;
             }
             pattern.optimize();
 
@@ -271,6 +281,7 @@ void AdvancedSettingsXmlReader::loadExcludePatterns()
             skipUnsupportedTag();
         }
     }
+    m_settings.compileExcludePatterns();
 }
 
 void AdvancedSettingsXmlReader::addError(QString tag, ParseErrorType type)
@@ -0,0 +1,162 @@
+#include "tv_shows/EpisodeFileNameParser.h"
+
+#include "globals/Helper.h"
+
+#include <QRegularExpression>
+#include <QStringRef>
+
+namespace {
+
+struct EpisodeNumberPattern
+{
+    QRegularExpression regex;
+    /// If true, we apply a heuristic to avoid matching the video's resolution.
+    bool mayBeAmbiguous = false;
+};
+
+QRegularExpression compiledPattern(const QString& pattern)
+{
+    QRegularExpression regex(pattern, QRegularExpression::CaseInsensitiveOption);
+    // Compile the pattern right away so that threads sharing it don't do it lazily.
+    regex.optimize();
+    return regex;
+}
+
+/// Patterns are tried in order; the first one that matches wins.
+const QVector<QRegularExpression>& seasonPatterns()
+{
+    static const QVector<QRegularExpression> patterns{compiledPattern(R"(S(\d+)[ ._-]?E)"),
+        compiledPattern(R"((\d+)?x(\d+))"),
+        compiledPattern(R"((\d+).(\d){2,4})"),
+        compiledPattern(R"(Season[ ._]?(\d+)[ ._]?Episode)")};
+    return patterns;
+}
+
+/// Patterns are tried in order; the first one that matches wins.
+const QVector<EpisodeNumberPattern>& episodePatterns()
+{
+    static const QVector<EpisodeNumberPattern> patterns{{compiledPattern(R"(S(\d+)[ ._-]?E(\d+))"), false},
+        {compiledPattern(R"(S(\d+)[ ._-]?EP(\d+))"), false},
+        {compiledPattern(R"(Season[ ._-]?(\d+)[._ -]?Episode[ ._-]?(\d+))"), false},
+        {compiledPattern(R"((\d+)x(\d+))"), true},
+        {compiledPattern(R"((\d+).(\d){2,4})"), true}};
+    return patterns;
+}
+
+/// Matches follow-up episodes of multi-episode files, e.g. "-E05" in "S01E04-E05".
+/// Must match directly at the given offset, hence \G instead of ^.
+const QRegularExpression& followUpEpisodePattern()
+{
+    static const QRegularExpression pattern = compiledPattern(R"(\G[-_EeXx]+([0-9]+)($|[\-\._\sE]))");
+    return pattern;
+}
+
+/// Returns the n-th path segment counted from the end (0 being the last one)
+/// or a null string if the path does not have enough segments.
+QString segmentFromEnd(const QString& path, int n)
+{
+    int end = path.size();
+    for (int i = 0; i < n; ++i) {
+        if (end == 0) {
+            return {};
+        }
+        const int slash = path.lastIndexOf('/', end - 1);
+        if (slash == -1) {
+            return {};
+        }
+        end = slash;
+    }
+    const int start = (end == 0) ? 0 : path.lastIndexOf('/', end - 1) + 1;
+    return path.mid(start, end - start);
+}
+
+/// Scans the given filename for the given pattern and appends all found episodes.
+/// Returns true if the pattern matched.
+bool scanWithPattern(const QString& filename, const EpisodeNumberPattern& pattern, QVector<EpisodeNumber>& episodes)
+{
+    int pos = 0;
+    int lastPos = -1;
+    QRegularExpressionMatch match = pattern.regex.match(filename, pos);
+    while (match.hasMatch()) {
+        const int matchStart = match.capturedStart(0);
+        // if between the last match and this one are more than five characters: break
+        // this way we can try to filter "false matches" like in "21x04 - Hammond vs. 6x6.mp4"
+        if (pattern.mayBeAmbiguous && lastPos != -1 && lastPos < matchStart + 5) {
+            return true;
+        }
+        episodes << EpisodeNumber(match.capturedRef(2).toInt());
+        pos = matchStart + match.capturedLength(0);
+        lastPos = pos;
+        match = pattern.regex.match(filename, pos);
+    }
+    pos = lastPos;
+
+    if (episodes.isEmpty()) {
+        return false;
+    }
+
+    if (episodes.count() == 1) {
+        match = followUpEpisodePattern().match(filename, pos);
+        while (match.hasMatch()) {
+            episodes << EpisodeNumber(match.capturedRef(1).toInt());
+            pos += match.capturedLength(0) - 1;
+            match = followUpEpisodePattern().match(filename, pos);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace mediaelch {
+
+QString EpisodeFileNameParser::fileNameForParsing(const QString& filePath)
+{
+    const int lastSlash = filePath.lastIndexOf('/');
+    const QString filename = filePath.mid(lastSlash + 1);
+    // Number of path segments is "slashes + 1". Only count them for disc structures.
+    if (filename.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
+        const int segmentCount = filePath.count('/') + 1;
+        if (segmentCount > 1 && helper::isDvd(filePath)) {
+            const QString folder = segmentFromEnd(filePath, 2);
+            return folder.isNull() ? filename : folder;
+        }
+        if (segmentCount > 2 && helper::isDvd(filePath, true)) {
+            return segmentFromEnd(filePath, 1);
+        }
+
+    } else if (filename.endsWith("index.bdmv", Qt::CaseInsensitive)) {
+        const int segmentCount = filePath.count('/') + 1;
+        if (segmentCount > 2) {
+            return segmentFromEnd(filePath, 2);
+        }
+    }
+    return filename;
+}
+
+SeasonNumber EpisodeFileNameParser::seasonNumber(const QString& filePath)
+{
+    const QString filename = fileNameForParsing(filePath);
+    for (const QRegularExpression& regex : seasonPatterns()) {
+        const QRegularExpressionMatch match = regex.match(filename);
+        if (match.hasMatch()) {
+            return SeasonNumber(match.capturedRef(1).toInt());
+        }
+    }
+    // Default if no valid season could be parsed.
+    return SeasonNumber::SpecialsSeason;
+}
+
+QVector<EpisodeNumber> EpisodeFileNameParser::episodeNumbers(const QString& filePath)
+{
+    const QString filename = fileNameForParsing(filePath);
+    QVector<EpisodeNumber> episodes;
+    for (const auto& pattern : episodePatterns()) {
+        if (scanWithPattern(filename, pattern, episodes)) {
+            break;
+        }
+    }
+    return episodes;
+}
+
+} // namespace mediaelch
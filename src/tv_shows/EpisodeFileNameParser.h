@@ -0,0 +1,35 @@
+#pragma once
+
+#include "tv_shows/EpisodeNumber.h"
+#include "tv_shows/SeasonNumber.h"
+
+#include <QString>
+#include <QVector>
+
+namespace mediaelch {
+
+/// \brief Parses season and episode numbers from TV show episode file paths.
+///
+/// All regular expressions are compiled (and JIT-optimized if available) exactly once
+/// per process and are shared between threads. File names are not split into
+/// temporary string lists, so parsing a path only allocates for the result.
+///
+/// The parser yields the same results as the QRegExp based implementation that was
+/// used in TvShowFileSearcher before.
+class EpisodeFileNameParser
+{
+public:
+    /// \brief Returns the season number of the given episode file.
+    /// \details Returns SeasonNumber::SpecialsSeason if no season could be found.
+    static SeasonNumber seasonNumber(const QString& filePath);
+    /// \brief Returns all episode numbers of the given episode file.
+    /// \details Multi-episode files like "S01E04-E05.mkv" result in more than one number.
+    static QVector<EpisodeNumber> episodeNumbers(const QString& filePath);
+
+    /// \brief Returns the part of the path that contains the episode information.
+    /// \details For normal files this is the file name. For DVD and BluRay structures
+    ///          it is the name of the folder that contains the disc structure.
+    static QString fileNameForParsing(const QString& filePath);
+};
+
+} // namespace mediaelch
@@ -11,6 +11,7 @@
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/NameFormatter.h"
+#include "globals/StringPool.h"
 #include "media_centers/MediaCenterInterface.h"
 #include "scrapers/tv_show/TheTvDb.h"
 #include "scrapers/tv_show/TvScraperInterface.h"
@@ -76,7 +77,7 @@ void TvShow::clear(QSet<ShowScraperInfo> infos)
     if (infos.contains(ShowScraperInfo::Banner)) {
         m_banners.clear();
         m_imagesToRemove.remove(ImageType::TvShowBanner);
-        m_images.insert(ImageType::TvShowBanner, QByteArray());
+        m_images.insert(ImageType::TvShowBanner, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowBanner, false);
     }
     if (infos.contains(ShowScraperInfo::Certification)) {
@@ -97,7 +98,7 @@ void TvShow::clear(QSet<ShowScraperInfo> infos)
     if (infos.contains(ShowScraperInfo::Poster)) {
         m_posters.clear();
         m_imagesToRemove.remove(ImageType::TvShowPoster);
-        m_images.insert(ImageType::TvShowPoster, QByteArray());
+        m_images.insert(ImageType::TvShowPoster, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowPoster, false);
     }
     if (infos.contains(ShowScraperInfo::Rating)) {
@@ -132,17 +133,17 @@ void TvShow::clear(QSet<ShowScraperInfo> infos)
     if (infos.contains(ShowScraperInfo::Fanart)) {
         m_backdrops.clear();
         m_imagesToRemove.remove(ImageType::TvShowBackdrop);
-        m_images.insert(ImageType::TvShowBackdrop, QByteArray());
+        m_images.insert(ImageType::TvShowBackdrop, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowBackdrop, false);
     }
     if (infos.contains(ShowScraperInfo::ExtraArts)) {
-        m_images.insert(ImageType::TvShowLogos, QByteArray());
+        m_images.insert(ImageType::TvShowLogos, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowLogos, false);
-        m_images.insert(ImageType::TvShowThumb, QByteArray());
+        m_images.insert(ImageType::TvShowThumb, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowThumb, false);
-        m_images.insert(ImageType::TvShowClearArt, QByteArray());
+        m_images.insert(ImageType::TvShowClearArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowClearArt, false);
-        m_images.insert(ImageType::TvShowCharacterArt, QByteArray());
+        m_images.insert(ImageType::TvShowCharacterArt, mediaelch::ImageBlob());
         m_hasImageChanged.insert(ImageType::TvShowCharacterArt, false);
         m_imagesToRemove.remove(ImageType::TvShowLogos);
         m_imagesToRemove.remove(ImageType::TvShowClearArt);
@@ -162,10 +163,10 @@ void TvShow::clear(QSet<ShowScraperInfo> infos)
 
 void TvShow::clearSeasonImageType(ImageType imageType)
 {
-    QMapIterator<SeasonNumber, QMap<ImageType, QByteArray>> it(m_seasonImages);
+    QMapIterator<SeasonNumber, QMap<ImageType, mediaelch::ImageBlob>> it(m_seasonImages);
     while (it.hasNext()) {
         it.next();
-        m_seasonImages[it.key()].insert(imageType, QByteArray());
+        m_seasonImages[it.key()].insert(imageType, mediaelch::ImageBlob());
     }
     QMapIterator<SeasonNumber, QMap<ImageType, bool>> itC(m_hasSeasonImageChanged);
     while (itC.hasNext()) {
@@ -181,6 +182,48 @@ void TvShow::clearSeasonImageType(ImageType imageType)
 void TvShow::addEpisode(TvShowEpisode* episode)
 {
     m_episodes.push_back(episode);
+    indexEpisode(episode);
+}
+
+void TvShow::episodeNumberChanged(TvShowEpisode* episode, SeasonNumber oldSeason, EpisodeNumber oldEpisode)
+{
+    if (m_episodeIndex.remove(episodeKey(oldSeason, oldEpisode), episode) == 0) {
+        return;
+    }
+    SeasonEpisodeCount& count = m_seasonEpisodeCounts[oldSeason];
+    --count.episodes;
+    if (episode->isDummy()) {
+        --count.dummies;
+    }
+    if (count.episodes == 0) {
+        m_seasonEpisodeCounts.remove(oldSeason);
+    }
+    indexEpisode(episode);
+}
+
+quint64 TvShow::episodeKey(SeasonNumber season, EpisodeNumber episode)
+{
+    return (quint64(quint32(season.toInt())) << 32U) | quint32(episode.toInt());
+}
+
+void TvShow::indexEpisode(TvShowEpisode* episode)
+{
+    m_episodeIndex.insert(episodeKey(episode->seasonNumber(), episode->episodeNumber()), episode);
+    SeasonEpisodeCount& count = m_seasonEpisodeCounts[episode->seasonNumber()];
+    ++count.episodes;
+    if (episode->isDummy()) {
+        ++count.dummies;
+    }
+}
+
+void TvShow::rebuildEpisodeIndex()
+{
+    m_episodeIndex.clear();
+    m_seasonEpisodeCounts.clear();
+    m_episodeIndex.reserve(m_episodes.size());
+    for (TvShowEpisode* episode : m_episodes) {
+        indexEpisode(episode);
+    }
 }
 
 /**
@@ -276,7 +319,7 @@ void TvShow::clearImages()
     m_hasImageChanged.clear();
     m_hasSeasonImageChanged.clear();
     for (auto& actor : m_actors) {
-        actor->image = QByteArray();
+        actor->image = mediaelch::ImageBlob();
     }
     m_extraFanartImagesToAdd.clear();
 }
@@ -606,25 +649,20 @@ const QMap<SeasonNumber, QVector<Poster>>& TvShow::allSeasonThumbs() const
     return m_seasonThumbs;
 }
 
-TvShowEpisode* TvShow::episode(SeasonNumber season, EpisodeNumber episode)
+TvShowEpisode* TvShow::episode(SeasonNumber season, EpisodeNumber episode) const
 {
-    for (int i = 0, n = m_episodes.count(); i < n; ++i) {
-        if (m_episodes[i]->seasonNumber() == season && m_episodes[i]->episodeNumber() == episode) {
-            return m_episodes[i];
-        }
-    }
-    return new TvShowEpisode(QStringList(), this);
+    return m_episodeIndex.value(episodeKey(season, episode), nullptr);
 }
 
 QVector<SeasonNumber> TvShow::seasons(bool includeDummies) const
 {
     QVector<SeasonNumber> seasons;
-    for (TvShowEpisode* episode : m_episodes) {
-        if (episode->isDummy() && !includeDummies) {
+    for (auto it = m_seasonEpisodeCounts.cbegin(); it != m_seasonEpisodeCounts.cend(); ++it) {
+        if (it.key() == SeasonNumber::NoSeason) {
             continue;
         }
-        if (!seasons.contains(episode->seasonNumber()) && episode->seasonNumber() != SeasonNumber::NoSeason) {
-            seasons.append(episode->seasonNumber());
+        if (includeDummies || it.value().episodes > it.value().dummies) {
+            seasons.append(it.key());
         }
     }
     return seasons;
@@ -733,11 +771,9 @@ void TvShow::setGenres(QStringList genres)
     m_genres.clear();
     for (const QString& genre : genres) {
         if (!genre.isEmpty()) {
-            m_genres.append(genre);
+            m_genres.append(mediaelch::StringPool::intern(genre));
         }
     }
-
-    m_genres = genres;
     setChanged(true);
 }
 
@@ -750,13 +786,13 @@ void TvShow::addGenre(QString genre)
     if (genre.isEmpty()) {
         return;
     }
-    m_genres.append(genre);
+    m_genres.append(mediaelch::StringPool::intern(genre));
     setChanged(true);
 }
 
 void TvShow::addTag(QString tag)
 {
-    m_tags.append(tag);
+    m_tags.append(mediaelch::StringPool::intern(tag));
     setChanged(true);
 }
 
@@ -776,7 +812,7 @@ void TvShow::setCertification(Certification certification)
  */
 void TvShow::setNetwork(QString network)
 {
-    m_network = network;
+    m_network = mediaelch::StringPool::intern(network);
     setChanged(true);
 }
 
@@ -825,6 +861,7 @@ void TvShow::addActor(Actor actor)
     if (actor.order == 0 && !m_actors.empty()) {
         actor.order = m_actors.back()->order + 1;
     }
+    actor.name = mediaelch::StringPool::intern(actor.name);
     m_actors.push_back(std::make_unique<Actor>(actor));
     setChanged(true);
 }
@@ -1040,13 +1077,18 @@ void TvShow::setSyncNeeded(bool syncNeeded)
 
 void TvShow::addExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.append(fanart);
+    m_extraFanartImagesToAdd.append(mediaelch::ImageBlob(fanart));
     setChanged(true);
 }
 
 void TvShow::removeExtraFanart(QByteArray fanart)
 {
-    m_extraFanartImagesToAdd.removeOne(fanart);
+    for (int i = 0; i < m_extraFanartImagesToAdd.size(); ++i) {
+        if (m_extraFanartImagesToAdd.at(i).hasSameData(fanart)) {
+            m_extraFanartImagesToAdd.removeAt(i);
+            break;
+        }
+    }
     setChanged(true);
 }
 
@@ -1073,7 +1115,7 @@ QVector<ExtraFanart> TvShow::extraFanarts(MediaCenterInterface* mediaCenterInter
     }
     for (const auto& img : m_extraFanartImagesToAdd) {
         ExtraFanart f;
-        f.image = img;
+        f.image = img.data();
         fanarts.append(f);
     }
     return fanarts;
@@ -1086,7 +1128,11 @@ QStringList TvShow::extraFanartsToRemove()
 
 QVector<QByteArray> TvShow::extraFanartImagesToAdd()
 {
-    return m_extraFanartImagesToAdd;
+    QVector<QByteArray> images;
+    for (const mediaelch::ImageBlob& image : m_extraFanartImagesToAdd) {
+        images.append(image.data());
+    }
+    return images;
 }
 
 void TvShow::clearExtraFanartData()
@@ -1104,8 +1150,8 @@ QMap<ImageType, QVector<SeasonNumber>> TvShow::imagesToRemove() const
 void TvShow::removeImage(ImageType type, SeasonNumber season)
 {
     if (TvShow::seasonImageTypes().contains(type)) {
-        if (m_seasonImages.contains(season) && !m_seasonImages.value(season).value(type, QByteArray()).isNull()) {
-            m_seasonImages[season].insert(type, QByteArray());
+        if (m_seasonImages.contains(season) && !m_seasonImages.value(season).value(type).isNull()) {
+            m_seasonImages[season].insert(type, mediaelch::ImageBlob());
             if (!m_hasSeasonImageChanged.contains(season)) {
                 m_hasSeasonImageChanged.insert(season, QMap<ImageType, bool>());
             }
@@ -1116,8 +1162,8 @@ void TvShow::removeImage(ImageType type, SeasonNumber season)
             m_imagesToRemove[type].append(season);
         }
     } else {
-        if (!m_images.value(type, QByteArray()).isNull()) {
-            m_images.insert(type, QByteArray());
+        if (!m_images.value(type).isNull()) {
+            m_images.insert(type, mediaelch::ImageBlob());
             m_hasImageChanged.insert(type, false);
         } else {
             m_imagesToRemove.insert(type, QVector<SeasonNumber>{SeasonNumber::NoSeason});
@@ -1144,20 +1190,20 @@ bool TvShow::lessThan(TvShow* a, TvShow* b)
 
 QByteArray TvShow::image(ImageType imageType)
 {
-    return m_images.value(imageType);
+    return m_images.value(imageType).data();
 }
 
 QByteArray TvShow::seasonImage(SeasonNumber season, ImageType imageType)
 {
     if (m_seasonImages.contains(season)) {
-        return m_seasonImages.value(season).value(imageType, QByteArray());
+        return m_seasonImages.value(season).value(imageType).data();
     }
     return QByteArray();
 }
 
 void TvShow::setImage(ImageType imageType, QByteArray image)
 {
-    m_images.insert(imageType, image);
+    m_images.insert(imageType, mediaelch::ImageBlob(image));
     m_hasImageChanged.insert(imageType, true);
     setChanged(true);
 }
@@ -1165,9 +1211,9 @@ void TvShow::setImage(ImageType imageType, QByteArray image)
 void TvShow::setSeasonImage(SeasonNumber season, ImageType imageType, QByteArray image)
 {
     if (!m_seasonImages.contains(season)) {
-        m_seasonImages.insert(season, QMap<ImageType, QByteArray>());
+        m_seasonImages.insert(season, QMap<ImageType, mediaelch::ImageBlob>());
     }
-    m_seasonImages[season].insert(imageType, image);
+    m_seasonImages[season].insert(imageType, mediaelch::ImageBlob(image));
 
     if (!m_hasSeasonImageChanged.contains(season)) {
         m_hasSeasonImageChanged.insert(season, QMap<ImageType, bool>());
@@ -1285,25 +1331,20 @@ void TvShow::setSortTitle(QString sortTitle)
 
 bool TvShow::isDummySeason(SeasonNumber season) const
 {
-    for (TvShowEpisode* episode : m_episodes) {
-        if (episode->seasonNumber() == season && !episode->isDummy()) {
-            return false;
-        }
-    }
-    return true;
+    const SeasonEpisodeCount count = m_seasonEpisodeCounts.value(season);
+    return count.episodes == count.dummies;
 }
 
 bool TvShow::hasDummyEpisodes(SeasonNumber season) const
 {
-    return std::any_of(m_episodes.cbegin(), m_episodes.cend(), [season](const TvShowEpisode* const episode) {
-        return episode->seasonNumber() == season && episode->isDummy();
-    });
+    return m_seasonEpisodeCounts.value(season).dummies > 0;
 }
 
 bool TvShow::hasDummyEpisodes() const
 {
-    return std::any_of(
-        m_episodes.cbegin(), m_episodes.cend(), [](const TvShowEpisode* const episode) { return episode->isDummy(); });
+    return std::any_of(m_seasonEpisodeCounts.cbegin(),
+        m_seasonEpisodeCounts.cend(),
+        [](const SeasonEpisodeCount& count) { return count.dummies > 0; });
 }
 
 void TvShow::setShowMissingEpisodes(bool showMissing, bool updateDatabase)
@@ -1341,16 +1382,7 @@ void TvShow::fillMissingEpisodes()
             continue;
         }
 
-        bool found = false;
-        for (int i = 0, n = m_episodes.count(); i < n; ++i) {
-            if (m_episodes[i]->seasonNumber() == episode->seasonNumber()
-                && m_episodes[i]->episodeNumber() == episode->episodeNumber()) {
-                found = true;
-                break;
-            }
-        }
-
-        if (found) {
+        if (m_episodeIndex.contains(episodeKey(episode->seasonNumber(), episode->episodeNumber()))) {
             episode->deleteLater();
             continue;
         }
@@ -1374,6 +1406,7 @@ void TvShow::clearMissingEpisodes()
 {
     const auto isDummyEpisode = [](TvShowEpisode* episode) { return episode->isDummy(); };
     m_episodes.erase(std::remove_if(m_episodes.begin(), m_episodes.end(), isDummyEpisode), m_episodes.end());
+    rebuildEpisodeIndex();
 
     Manager::instance()->tvShowModel()->updateShow(this);
     TvShowFilesWidget::instance().renewModel(true);
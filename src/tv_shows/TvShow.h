@@ -1,5 +1,6 @@
 #pragma once
 
+#include "data/ImageBlob.h"
 #include "data/Rating.h"
 #include "data/TmdbId.h"
 #include "file/Path.h"
@@ -11,7 +12,9 @@
 #include "tv_shows/TvDbId.h"
 #include "tv_shows/TvShowEpisode.h"
 
+#include <QMap>
 #include <QMetaType>
+#include <QMultiHash>
 #include <QObject>
 #include <QStringList>
 #include <QVector>
@@ -32,6 +35,9 @@ public:
     void clear(QSet<ShowScraperInfo> infos);
     void addEpisode(TvShowEpisode* episode);
     int episodeCount() const;
+    /// \brief Updates the episode index after the season or episode number of an episode has changed.
+    /// Called by TvShowEpisode; does nothing if the episode does not belong to this show.
+    void episodeNumberChanged(TvShowEpisode* episode, SeasonNumber oldSeason, EpisodeNumber oldEpisode);
 
     /// \brief Main title of the show.
     QString title() const;
@@ -74,7 +80,9 @@ public:
     const QMap<SeasonNumber, QVector<Poster>>& allSeasonBanners() const;
     const QMap<SeasonNumber, QVector<Poster>>& allSeasonThumbs() const;
 
-    TvShowEpisode* episode(SeasonNumber season, EpisodeNumber episode);
+    /// \brief Returns the episode with the given numbers or nullptr if there is none.
+    TvShowEpisode* episode(SeasonNumber season, EpisodeNumber episode) const;
+    /// \brief Returns all seasons in ascending order.
     QVector<SeasonNumber> seasons(bool includeDummies = true) const;
     const QVector<TvShowEpisode*>& episodes() const;
     QVector<TvShowEpisode*> episodes(SeasonNumber season) const;
@@ -198,7 +206,22 @@ signals:
     void sigChanged(TvShow*);
 
 private:
+    struct SeasonEpisodeCount
+    {
+        int episodes = 0;
+        int dummies = 0;
+    };
+
+    static quint64 episodeKey(SeasonNumber season, EpisodeNumber episode);
+    void indexEpisode(TvShowEpisode* episode);
+    void rebuildEpisodeIndex();
+
     QVector<TvShowEpisode*> m_episodes;
+    /// All episodes by season and episode number, see episodeKey(). Shows can contain
+    /// more than one file for the same episode.
+    QMultiHash<quint64, TvShowEpisode*> m_episodeIndex;
+    /// Number of (dummy) episodes per season
+    QMap<SeasonNumber, SeasonEpisodeCount> m_seasonEpisodeCounts;
     mediaelch::DirectoryPath m_dir;
     QString m_title;
     QString m_showTitle;
@@ -238,7 +261,7 @@ private:
     bool m_syncNeeded = false;
     /// \todo Remove in future versions.
     QSet<ShowScraperInfo> m_infosToLoad;
-    QVector<QByteArray> m_extraFanartImagesToAdd;
+    QVector<mediaelch::ImageBlob> m_extraFanartImagesToAdd;
     QStringList m_extraFanartsToRemove;
     QStringList m_extraFanarts;
     QMap<ImageType, QVector<SeasonNumber>> m_imagesToRemove;
@@ -249,8 +272,8 @@ private:
     QDateTime m_dateAdded;
     QMap<SeasonNumber, QString> m_seasonNameMappings;
 
-    QMap<ImageType, QByteArray> m_images;
-    QMap<SeasonNumber, QMap<ImageType, QByteArray>> m_seasonImages;
+    QMap<ImageType, mediaelch::ImageBlob> m_images;
+    QMap<SeasonNumber, QMap<ImageType, mediaelch::ImageBlob>> m_seasonImages;
     QMap<ImageType, bool> m_hasImageChanged;
     QMap<SeasonNumber, QMap<ImageType, bool>> m_hasSeasonImageChanged;
 
@@ -2,6 +2,7 @@
 
 #include "globals/Globals.h"
 #include "globals/Helper.h"
+#include "globals/StringPool.h"
 #include "media_centers/MediaCenterInterface.h"
 #include "scrapers/tv_show/TvScraperInterface.h"
 #include "settings/Settings.h"
@@ -245,7 +246,7 @@ bool TvShowEpisode::isValid() const
  */
 void TvShowEpisode::clearImages()
 {
-    m_thumbnailImage = QByteArray();
+    m_thumbnailImage = mediaelch::ImageBlob();
 }
 
 /*** GETTER ***/
@@ -483,7 +484,7 @@ QUrl TvShowEpisode::thumbnail() const
  */
 QByteArray TvShowEpisode::thumbnailImage()
 {
-    return m_thumbnailImage;
+    return m_thumbnailImage.data();
 }
 
 bool TvShowEpisode::thumbnailImageChanged() const
@@ -612,7 +613,11 @@ void TvShowEpisode::setUserRating(double rating)
  */
 void TvShowEpisode::setSeason(SeasonNumber season)
 {
+    const SeasonNumber oldSeason = m_season;
     m_season = season;
+    if (m_show != nullptr && oldSeason != season) {
+        m_show->episodeNumberChanged(this, oldSeason, m_episode);
+    }
     setChanged(true);
 }
 
@@ -623,7 +628,11 @@ void TvShowEpisode::setSeason(SeasonNumber season)
  */
 void TvShowEpisode::setEpisode(EpisodeNumber episode)
 {
+    const EpisodeNumber oldEpisode = m_episode;
     m_episode = episode;
+    if (m_show != nullptr && oldEpisode != episode) {
+        m_show->episodeNumberChanged(this, m_season, oldEpisode);
+    }
     setChanged(true);
 }
 
@@ -673,7 +682,7 @@ void TvShowEpisode::setEpBookmark(QTime epBookmark)
  */
 void TvShowEpisode::setWriters(QStringList writers)
 {
-    m_writers = writers;
+    m_writers = mediaelch::StringPool::intern(writers);
     setChanged(true);
 }
 
@@ -684,7 +693,7 @@ void TvShowEpisode::setWriters(QStringList writers)
  */
 void TvShowEpisode::addWriter(QString writer)
 {
-    m_writers.append(writer);
+    m_writers.append(mediaelch::StringPool::intern(writer));
     setChanged(true);
 }
 
@@ -695,7 +704,7 @@ void TvShowEpisode::addWriter(QString writer)
  */
 void TvShowEpisode::addDirector(QString director)
 {
-    m_directors.append(director);
+    m_directors.append(mediaelch::StringPool::intern(director));
     setChanged(true);
 }
 
@@ -706,7 +715,7 @@ void TvShowEpisode::addDirector(QString director)
  */
 void TvShowEpisode::setDirectors(QStringList directors)
 {
-    m_directors = directors;
+    m_directors = mediaelch::StringPool::intern(directors);
     setChanged(true);
 }
 
@@ -761,7 +770,7 @@ void TvShowEpisode::setCertification(Certification certification)
  */
 void TvShowEpisode::setNetwork(QString network)
 {
-    m_network = network;
+    m_network = mediaelch::StringPool::intern(network);
     setChanged(true);
 }
 
@@ -778,7 +787,7 @@ void TvShowEpisode::setThumbnail(QUrl url)
 
 void TvShowEpisode::setThumbnailImage(QByteArray thumbnail)
 {
-    m_thumbnailImage = thumbnail;
+    m_thumbnailImage = mediaelch::ImageBlob(thumbnail);
     m_thumbnailImageChanged = true;
     setChanged(true);
 }
@@ -864,7 +873,7 @@ void TvShowEpisode::removeImage(ImageType type)
 {
     if (type == ImageType::TvShowEpisodeThumb) {
         if (!m_thumbnailImage.isNull()) {
-            m_thumbnailImage = QByteArray();
+            m_thumbnailImage = mediaelch::ImageBlob();
             m_thumbnailImageChanged = false;
         } else if (!m_imagesToRemove.contains(type)) {
             m_imagesToRemove.append(type);
@@ -906,6 +915,7 @@ void TvShowEpisode::addActor(Actor actor)
     if (actor.order == 0 && !m_actors.empty()) {
         actor.order = m_actors.back()->order + 1;
     }
+    actor.name = mediaelch::StringPool::intern(actor.name);
     m_actors.push_back(std::make_unique<Actor>(actor));
     setChanged(true);
 }
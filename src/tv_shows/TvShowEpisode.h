@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/Certification.h"
+#include "data/ImageBlob.h"
 #include "data/ImdbId.h"
 #include "data/Locale.h"
 #include "data/Rating.h"
@@ -177,7 +178,7 @@ private:
     Certification m_certification;
     QString m_network;
     QUrl m_thumbnail;
-    QByteArray m_thumbnailImage;
+    mediaelch::ImageBlob m_thumbnailImage;
     EpisodeModelItem* m_modelItem = nullptr;
     bool m_thumbnailImageChanged = false;
     bool m_infoLoaded = false;
@@ -6,10 +6,14 @@
 #include <QSqlQuery>
 #include <QSqlRecord>
 #include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
 
+#include "globals/BatchCollector.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
+#include "log/Tracer.h"
+#include "tv_shows/EpisodeFileNameParser.h"
 #include "tv_shows/TvShow.h"
 #include "tv_shows/TvShowEpisode.h"
 #include "tv_shows/model/EpisodeModelItem.h"
@@ -19,6 +23,19 @@
 TvShowFileSearcher::TvShowFileSearcher(QObject* parent) :
     QObject(parent), m_progressMessageId{Constants::TvShowSearcherProgressMessageId}, m_aborted{false}
 {
+    connect(this,
+        &TvShowFileSearcher::tvShowsBatchLoaded,
+        this,
+        &TvShowFileSearcher::onTvShowsBatchLoaded,
+        Qt::QueuedConnection);
+    connect(
+        this, &TvShowFileSearcher::workerFinished, this, &TvShowFileSearcher::onWorkerFinished, Qt::QueuedConnection);
+}
+
+TvShowFileSearcher::~TvShowFileSearcher()
+{
+    m_aborted = true;
+    m_worker.waitForFinished();
 }
 
 void TvShowFileSearcher::setTvShowDirectories(QVector<SettingsDir> directories)
@@ -46,24 +63,89 @@ void TvShowFileSearcher::setTvShowDirectories(QVector<SettingsDir> directories)
 void TvShowFileSearcher::reload(bool force)
 {
     qInfo() << "[TvShowFileSearcher] Reload TV shows, clear database:" << force;
+
+    // Only one scan at a time. Deliver pending batches of a previous scan while
+    // m_aborted is still set so that they are discarded.
+    m_aborted = true;
+    m_worker.waitForFinished();
+    QCoreApplication::sendPostedEvents(this, QEvent::MetaCall);
+
     m_aborted = false;
 
     clearOldTvShows(force);
 
     emit searchStarted(tr("Searching for TV Shows..."));
 
-    auto files = readTvShowContent(force);
+    // The database can only be used from the GUI thread: Read everything that
+    // is required before the worker is started.
+    QVector<SettingsDir> directories = directoriesToScan(force);
+    QVector<TvShow*> dbShows = getShowsFromDatabase(force);
+    for (TvShow* show : dbShows) {
+        for (TvShowEpisode* episode : database().episodes(show->databaseId())) {
+            if (episode == nullptr) {
+                continue;
+            }
+            episode->setShow(show);
+            show->addEpisode(episode);
+        }
+    }
+    const int episodeSum = database().episodeCount();
+
+    m_worker = QtConcurrent::run(this, &TvShowFileSearcher::loadTvShows, directories, dbShows, episodeSum);
+}
+
+void TvShowFileSearcher::loadTvShows(QVector<SettingsDir> directories, QVector<TvShow*> dbShows, int episodeSum)
+{
+    QMap<QString, QVector<QStringList>> contents;
+    for (const SettingsDir& dir : directories) {
+        if (m_aborted) {
+            break;
+        }
+        getTvShows(dir.path, contents);
+    }
 
     emit currentDir("");
 
     emit searchStarted(tr("Loading TV Shows..."));
     int episodeCounter = 0;
-    const int episodeSum = database().episodeCount();
 
-    QVector<TvShow*> dbShows = getShowsFromDatabase(force);
-    setupShows(files, episodeCounter, episodeSum);
+    setupShows(contents, episodeCounter, episodeSum);
     setupShowsFromDatabase(dbShows, episodeCounter, episodeSum);
 
+    emit workerFinished();
+}
+
+void TvShowFileSearcher::onTvShowsBatchLoaded(QVector<TvShow*> shows, QString directory, bool storeInDatabase)
+{
+    ELCH_TRACE_SCOPE("scan", "Store TV show batch", directory);
+    if (m_aborted) {
+        for (TvShow* show : shows) {
+            show->deleteLater();
+        }
+        return;
+    }
+
+    if (storeInDatabase) {
+        database().transaction();
+        for (TvShow* show : shows) {
+            show->setParent(this);
+            database().add(show, directory);
+            for (TvShowEpisode* episode : show->episodes()) {
+                database().add(episode, directory, show->databaseId());
+            }
+        }
+        database().commit();
+    }
+
+    Manager::instance()->tvShowModel()->appendShows(shows);
+}
+
+void TvShowFileSearcher::onWorkerFinished()
+{
+    if (m_aborted) {
+        return;
+    }
+
     for (TvShow* show : Manager::instance()->tvShowModel()->tvShows()) {
         if (show->showMissingEpisodes()) {
             show->fillMissingEpisodes();
@@ -71,9 +153,7 @@ void TvShowFileSearcher::reload(bool force)
     }
 
     qDebug() << "[TvShowFileSearcher] Searching for TV shows done";
-    if (!m_aborted) {
-        emit tvShowsLoaded();
-    }
+    emit tvShowsLoaded();
 }
 
 TvShowEpisode* TvShowFileSearcher::loadEpisodeData(TvShowEpisode* episode)
@@ -84,6 +164,7 @@ TvShowEpisode* TvShowFileSearcher::loadEpisodeData(TvShowEpisode* episode)
 
 void TvShowFileSearcher::reloadEpisodes(const mediaelch::DirectoryPath& showDir)
 {
+    ELCH_TRACE_SCOPE("scan", "Reload episodes", showDir.toString());
     database().clearTvShowInDirectory(showDir);
     emit searchStarted(tr("Searching for Episodes..."));
 
@@ -201,6 +282,7 @@ void TvShowFileSearcher::scanTvShowDir(const mediaelch::DirectoryPath& startPath
     const mediaelch::DirectoryPath& path,
     QVector<QStringList>& contents)
 {
+    ELCH_TRACE_SCOPE("scan", "Scan TV show directory", path.toString());
     emit currentDir(path.toString().mid(startPath.toString().length()));
 
     QDir dir(path.toString());
@@ -302,40 +384,7 @@ SeasonNumber TvShowFileSearcher::getSeasonNumber(QStringList files)
     if (files.isEmpty()) {
         return SeasonNumber::NoSeason;
     }
-
-    QStringList filenameParts = files.at(0).split('/');
-    QString filename = filenameParts.last();
-    if (filename.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
-        if (filenameParts.count() > 1 && helper::isDvd(files.at(0))) {
-            filename = filenameParts.at(filenameParts.count() - 3);
-        } else if (filenameParts.count() > 2 && helper::isDvd(files.at(0), true)) {
-            filename = filenameParts.at(filenameParts.count() - 2);
-        }
-    } else if (filename.endsWith("index.bdmv", Qt::CaseInsensitive)) {
-        if (filenameParts.count() > 2) {
-            filename = filenameParts.at(filenameParts.count() - 3);
-        }
-    }
-
-    QRegExp rx(R"(S(\d+)[ ._-]?E)", Qt::CaseInsensitive);
-    if (rx.indexIn(filename) != -1) {
-        return SeasonNumber(rx.cap(1).toInt());
-    }
-    rx.setPattern("(\\d+)?x(\\d+)");
-    if (rx.indexIn(filename) != -1) {
-        return SeasonNumber(rx.cap(1).toInt());
-    }
-    rx.setPattern("(\\d+).(\\d){2,4}");
-    if (rx.indexIn(filename) != -1) {
-        return SeasonNumber(rx.cap(1).toInt());
-    }
-    rx.setPattern("Season[ ._]?(\\d+)[ ._]?Episode");
-    if (rx.indexIn(filename) != -1) {
-        return SeasonNumber(rx.cap(1).toInt());
-    }
-
-    // Default if no valid season could be parsed.
-    return SeasonNumber::SpecialsSeason;
+    return mediaelch::EpisodeFileNameParser::seasonNumber(files.at(0));
 }
 
 QVector<EpisodeNumber> TvShowFileSearcher::getEpisodeNumbers(QStringList files)
@@ -343,78 +392,7 @@ QVector<EpisodeNumber> TvShowFileSearcher::getEpisodeNumbers(QStringList files)
     if (files.isEmpty()) {
         return {};
     }
-
-    QStringList filenameParts = files.at(0).split('/');
-    QString filename = filenameParts.last();
-    if (filename.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
-        if (filenameParts.count() > 1 && helper::isDvd(files.at(0))) {
-            filename = filenameParts.at(filenameParts.count() - 3);
-        } else if (filenameParts.count() > 2 && helper::isDvd(files.at(0), true)) {
-            filename = filenameParts.at(filenameParts.count() - 2);
-        }
-    } else if (filename.endsWith("index.bdmv", Qt::CaseInsensitive)) {
-        if (filenameParts.count() > 2) {
-            filename = filenameParts.at(filenameParts.count() - 3);
-        }
-    }
-
-
-    QVector<EpisodeNumber> episodes;
-
-    /// Scans a given filename for a given pattern.
-    /// If mayBeAmbiguous is true, we apply a heuristic to avoid matching the video's resolution
-    auto scanWithPattern = [&](const QString& pattern, bool mayBeAmbiguous) -> bool {
-        QRegExp rx(pattern);
-        rx.setCaseSensitivity(Qt::CaseInsensitive);
-
-        int pos = 0;
-        int lastPos = -1;
-        while ((pos = rx.indexIn(filename, pos)) != -1) {
-            // if between the last match and this one are more than five characters: break
-            // this way we can try to filter "false matches" like in "21x04 - Hammond vs. 6x6.mp4"
-            if (mayBeAmbiguous && lastPos != -1 && lastPos < pos + 5) {
-                return true;
-            }
-            episodes << EpisodeNumber(rx.cap(2).toInt());
-            pos += rx.matchedLength();
-            lastPos = pos;
-        }
-        pos = lastPos;
-
-        // Pattern matched
-        if (episodes.isEmpty()) {
-            return false;
-        }
-
-        if (episodes.count() == 1) {
-            rx.setPattern(R"(^[-_EeXx]+([0-9]+)($|[\-\._\sE]))");
-            while (rx.indexIn(filename, pos, QRegExp::CaretAtOffset) != -1) {
-                episodes << EpisodeNumber(rx.cap(1).toInt());
-                pos += rx.matchedLength() - 1;
-            }
-        }
-        return true;
-    };
-
-    struct EpisodeNumberPattern
-    {
-        QString regex;
-        bool mayBeAmbiguous = false;
-    };
-
-    QVector<EpisodeNumberPattern> patterns{{R"(S(\d+)[ ._-]?E(\d+))", false},
-        {R"(S(\d+)[ ._-]?EP(\d+))", false},
-        {R"(Season[ ._-]?(\d+)[._ -]?Episode[ ._-]?(\d+))", false},
-        {R"((\d+)x(\d+))", true},
-        {R"((\d+).(\d){2,4})", true}};
-
-    for (const auto& pattern : patterns) {
-        if (scanWithPattern(pattern.regex, pattern.mayBeAmbiguous)) {
-            break;
-        }
-    }
-
-    return episodes;
+    return mediaelch::EpisodeFileNameParser::episodeNumbers(files.at(0));
 }
 
 Database& TvShowFileSearcher::database()
@@ -442,33 +420,29 @@ void TvShowFileSearcher::clearOldTvShows(bool forceClear)
 
 void TvShowFileSearcher::setupShowsFromDatabase(QVector<TvShow*>& dbShows, int episodeCounter, int episodeSum)
 {
+    BatchCollector<TvShow*> collector(
+        [&](QVector<TvShow*> shows) { emit tvShowsBatchLoaded(shows, QString(), false); });
+
     for (TvShow* show : dbShows) {
         if (m_aborted) {
-            return;
+            break;
         }
 
         show->loadData(Manager::instance()->mediaCenterInterfaceTvShow(), false);
 
-        QVector<TvShowEpisode*> episodes = database().episodes(show->databaseId());
+        QVector<TvShowEpisode*> episodes = show->episodes();
         QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::loadEpisodeData);
-        for (TvShowEpisode* episode : episodes) {
-            if (episode == nullptr) {
-                continue;
-            }
-            episode->setShow(show);
-            show->addEpisode(episode);
-            emit progress(++episodeCounter, episodeSum, m_progressMessageId);
-            if (episodeCounter % 1000 == 0) {
-                emit currentDir("");
-            }
-        }
+        episodeCounter += episodes.size();
+        emit progress(episodeCounter, episodeSum, m_progressMessageId);
 
-        Manager::instance()->tvShowModel()->appendShow(show);
+        collector.add(show);
     }
+    collector.flush();
 }
 
 void TvShowFileSearcher::setupShows(QMap<QString, QVector<QStringList>>& contents, int& episodeCounter, int episodeSum)
 {
+    ELCH_TRACE_SCOPE("scan", "Create TV shows");
     QMapIterator<QString, QVector<QStringList>> it(contents);
     while (it.hasNext()) {
         it.next();
@@ -476,16 +450,20 @@ void TvShowFileSearcher::setupShows(QMap<QString, QVector<QStringList>>& content
     }
     it.toFront();
 
+    // All shows of a batch belong to the same TV show directory.
+    QString path;
+    BatchCollector<TvShow*> collector([&](QVector<TvShow*> shows) { emit tvShowsBatchLoaded(shows, path, true); });
+
     // Setup shows
     while (it.hasNext()) {
         if (m_aborted) {
-            return;
+            break;
         }
 
         it.next();
 
         // get path
-        QString path;
+        QString showPath;
         int index = -1;
         for (int i = 0, n = m_directories.count(); i < n; ++i) {
             if (it.key().startsWith(m_directories[i].path.path())) {
@@ -497,15 +475,18 @@ void TvShowFileSearcher::setupShows(QMap<QString, QVector<QStringList>>& content
             }
         }
         if (index != -1) {
-            path = m_directories[index].path.path();
+            showPath = m_directories[index].path.path();
+        }
+        if (showPath != path) {
+            collector.flush();
+            path = showPath;
         }
 
-        auto* show = new TvShow(it.key(), this);
+        // The show is created without parent so that it can be moved to the GUI thread.
+        auto* show = new TvShow(it.key());
         show->loadData(Manager::instance()->mediaCenterInterfaceTvShow());
         emit currentDir(show->title());
-        database().add(show, path);
 
-        database().transaction();
         QVector<TvShowEpisode*> episodes;
 
         // Setup episodes list
@@ -523,30 +504,28 @@ void TvShowFileSearcher::setupShows(QMap<QString, QVector<QStringList>>& content
         // Load episodes data
         QtConcurrent::blockingMapped(episodes, TvShowFileSearcher::reloadEpisodeData);
 
-        // Add episodes to model
         for (TvShowEpisode* episode : episodes) {
-            database().add(episode, path, show->databaseId());
             show->addEpisode(episode);
-            emit progress(++episodeCounter, episodeSum, m_progressMessageId);
         }
+        episodeCounter += episodes.size();
+        emit progress(episodeCounter, episodeSum, m_progressMessageId);
 
-        database().commit();
-        Manager::instance()->tvShowModel()->appendShow(show);
+        // Episodes are children of the show and are moved as well.
+        show->moveToThread(QCoreApplication::instance()->thread());
+        collector.add(show);
     }
+    collector.flush();
 
     emit currentDir("");
 }
 
-QMap<QString, QVector<QStringList>> TvShowFileSearcher::readTvShowContent(bool forceReload)
+QVector<SettingsDir> TvShowFileSearcher::directoriesToScan(bool forceReload)
 {
-    QMap<QString, QVector<QStringList>> contents;
+    QVector<SettingsDir> directories;
     for (const SettingsDir& dir : m_directories) {
-        if (m_aborted) {
-            break;
-        }
         // Do we need to reload shows from disk?
         if (dir.autoReload || forceReload) {
-            getTvShows(dir.path, contents);
+            directories.append(dir);
             continue;
         }
         // TODO: Check if necessary?
@@ -554,11 +533,11 @@ QMap<QString, QVector<QStringList>> TvShowFileSearcher::readTvShowContent(bool f
         // all shows regardless of forceReload.
         const int showsFromDatabase = database().showCount(dir.path);
         if (showsFromDatabase == 0) {
-            getTvShows(dir.path, contents);
+            directories.append(dir);
             continue;
         }
     }
-    return contents;
+    return directories;
 }
 
 
@@ -4,15 +4,23 @@
 #include "tv_shows/TvShowEpisode.h"
 
 #include <QDir>
+#include <QFuture>
 #include <QObject>
+#include <atomic>
 
 class Database;
 
+/// \brief Loads all TV shows and their episodes of the configured TV show directories.
+///
+/// Directories are scanned and NFO files are loaded in a worker thread. Fully loaded
+/// shows (including their episodes) are handed to the GUI thread in batches which are
+/// stored in the database and added to the TV show model.
 class TvShowFileSearcher : public QObject
 {
     Q_OBJECT
 public:
     explicit TvShowFileSearcher(QObject* parent = nullptr);
+    ~TvShowFileSearcher() override;
     void setTvShowDirectories(QVector<SettingsDir> directories);
     static SeasonNumber getSeasonNumber(QStringList files);
     static QVector<EpisodeNumber> getEpisodeNumbers(QStringList files);
@@ -30,6 +38,17 @@ signals:
     void tvShowsLoaded();
     void currentDir(QString);
 
+    /// \brief Emitted by the worker thread for each batch of loaded shows.
+    /// If storeInDatabase is true, the shows and their episodes were read from disk
+    /// and are not yet stored in the database. Internal signal, don't connect to it.
+    void tvShowsBatchLoaded(QVector<TvShow*> shows, QString directory, bool storeInDatabase);
+    /// \brief Emitted by the worker thread after the last batch. Internal signal.
+    void workerFinished();
+
+private slots:
+    void onTvShowsBatchLoaded(QVector<TvShow*> shows, QString directory, bool storeInDatabase);
+    void onWorkerFinished();
+
 private:
     QVector<SettingsDir> m_directories;
     int m_progressMessageId;
@@ -38,15 +57,19 @@ private:
         const mediaelch::DirectoryPath& path,
         QVector<QStringList>& contents);
     QStringList getFiles(const mediaelch::DirectoryPath& path);
-    bool m_aborted;
+    std::atomic<bool> m_aborted;
+    QFuture<void> m_worker;
 
 private:
     Database& database();
 
     void clearOldTvShows(bool forceClear);
-    /// \brief Get a map of TV show paths and their respective files in the show folder.
-    QMap<QString, QVector<QStringList>> readTvShowContent(bool forceReload);
+    /// \brief Directories that have to be scanned, i.e. that can't be loaded from the database.
+    QVector<SettingsDir> directoriesToScan(bool forceReload);
     QVector<TvShow*> getShowsFromDatabase(bool forceReload);
+
+    /// \brief Entry point of the worker thread.
+    void loadTvShows(QVector<SettingsDir> directories, QVector<TvShow*> dbShows, int episodeSum);
     void setupShows(QMap<QString, QVector<QStringList>>& contents, int& episodeCounter, int episodeSum);
     void setupShowsFromDatabase(QVector<TvShow*>& dbShows, int episodeCounter, int episodeSum);
 };
@@ -5,6 +5,7 @@
 #include "globals/Globals.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "log/Tracer.h"
 #include "tv_shows/TvShowModel.h"
 #include "tv_shows/model/EpisodeModelItem.h"
 #include "tv_shows/model/SeasonModelItem.h"
@@ -213,24 +214,42 @@ void TvShowModel::appendShow(TvShow* show)
     const int size = m_rootItem.shows().size();
 
     beginInsertRows(QModelIndex{}, size, size);
-    {
-        TvShowModelItem* showItem = m_rootItem.appendShow(show);
+    appendShowItem(show);
+    endInsertRows();
+}
 
-        connect(showItem, &TvShowModelItem::sigChanged, this, &TvShowModel::onSigChanged);
-        connect(show, &TvShow::sigChanged, this, &TvShowModel::onShowChanged);
+void TvShowModel::appendShows(const QVector<TvShow*>& shows)
+{
+    ELCH_TRACE_SCOPE("model", "Add TV shows to model");
+    if (shows.isEmpty()) {
+        return;
+    }
+    const int size = m_rootItem.shows().size();
 
-        QMap<SeasonNumber, SeasonModelItem*> seasonItems;
-        for (TvShowEpisode* episode : show->episodes()) {
-            if (!seasonItems.contains(episode->seasonNumber())) {
-                seasonItems.insert(episode->seasonNumber(),
-                    showItem->appendSeason(episode->seasonNumber(), episode->seasonString(), show));
-            }
-            seasonItems.value(episode->seasonNumber())->appendEpisode(episode);
-        }
+    beginInsertRows(QModelIndex{}, size, size + shows.size() - 1);
+    for (TvShow* show : shows) {
+        appendShowItem(show);
     }
     endInsertRows();
 }
 
+void TvShowModel::appendShowItem(TvShow* show)
+{
+    TvShowModelItem* showItem = m_rootItem.appendShow(show);
+
+    connect(showItem, &TvShowModelItem::sigChanged, this, &TvShowModel::onSigChanged);
+    connect(show, &TvShow::sigChanged, this, &TvShowModel::onShowChanged);
+
+    QMap<SeasonNumber, SeasonModelItem*> seasonItems;
+    for (TvShowEpisode* episode : show->episodes()) {
+        if (!seasonItems.contains(episode->seasonNumber())) {
+            seasonItems.insert(episode->seasonNumber(),
+                showItem->appendSeason(episode->seasonNumber(), episode->seasonString(), show));
+        }
+        seasonItems.value(episode->seasonNumber())->appendEpisode(episode);
+    }
+}
+
 bool TvShowModel::removeShow(TvShow* show)
 {
     TvShowModelItem* showModel = findModelForShow(show);
@@ -285,6 +304,7 @@ int TvShowModel::rowCount(const QModelIndex& parent) const
 /// \brief Removes all children
 void TvShowModel::clear()
 {
+    ELCH_TRACE_SCOPE("model", "Clear TV show model");
     const int size = m_rootItem.shows().size();
     beginRemoveRows(QModelIndex(), 0, size);
     m_rootItem.removeChildren(0, size);
@@ -32,6 +32,8 @@ public:
 
     /// Append a TV show and its seasons and episodes to the tree view.
     void appendShow(TvShow* show);
+    /// Append all TV shows with a single row insertion.
+    void appendShows(const QVector<TvShow*>& shows);
     /// Remove a show from the TreeView
     /// \return true if the show was found and removed, false otherwise
     bool removeShow(TvShow* show);
@@ -53,6 +55,8 @@ private slots:
 
 private:
     TvShowModelItem* findModelForShow(TvShow* show);
+    /// Append the show to the root item. Must be called between beginInsertRows() and endInsertRows().
+    void appendShowItem(TvShow* show);
 
 private:
     TvShowRootModelItem m_rootItem;
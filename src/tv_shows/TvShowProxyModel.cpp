@@ -1,5 +1,6 @@
 #include "TvShowProxyModel.h"
 
+#include "data/Database.h"
 #include "globals/Globals.h"
 #include "globals/Manager.h"
 #include "tv_shows/model/EpisodeModelItem.h"
@@ -51,6 +52,15 @@ bool TvShowProxyModel::filterAcceptsRow(int source_row, const QModelIndex& sourc
 
 bool TvShowProxyModel::filterAcceptsRowItself(int sourceRow, const QModelIndex& sourceParent) const
 {
+    if (!m_searchResults.isEmpty() && !sourceParent.isValid()) {
+        // Top level items are TV shows; they are also found by their original title.
+        auto* model = dynamic_cast<TvShowModel*>(sourceModel());
+        TvShowBaseModelItem& item = model->getItem(sourceModel()->index(sourceRow, 0, sourceParent));
+        if (item.type() == TvShowType::TvShow && !item.tvShow()->hasChanged()
+            && m_searchResults.contains(item.tvShow()->databaseId())) {
+            return true;
+        }
+    }
     return QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
 }
 
@@ -122,4 +132,14 @@ void TvShowProxyModel::setFilter(QVector<Filter*> filters, QString text)
 {
     m_filters = filters;
     m_filterText = text;
+
+    m_searchResults.clear();
+    for (Filter* filter : m_filters) {
+        if (filter->isInfo(TvShowFilters::Title)) {
+            const QVector<int> ids = Manager::instance()->database()->searchTvShows(
+                filter->shortText(), mediaelch::LibrarySearchIndex::Columns::Titles);
+            m_searchResults = QSet<int>::fromList(ids.toList());
+            break;
+        }
+    }
 }
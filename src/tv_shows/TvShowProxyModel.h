@@ -2,6 +2,7 @@
 
 #include "globals/Filter.h"
 
+#include <QSet>
 #include <QSortFilterProxyModel>
 
 /**
@@ -23,4 +24,6 @@ protected:
 private:
     QVector<Filter*> m_filters;
     QString m_filterText;
+    /// TV shows found in the database's full-text index for the title filter.
+    QSet<int> m_searchResults;
 };
@@ -421,8 +421,9 @@ void ConcertWidget::updateImages(QVector<ImageType> images)
 
 void ConcertWidget::updateImage(ImageType imageType, ClosableImage* image)
 {
-    if (!m_concert->image(imageType).isNull()) {
-        image->setImage(m_concert->image(imageType));
+    const QByteArray data = m_concert->image(imageType);
+    if (!data.isNull()) {
+        image->setImage(data);
 
     } else if (!m_concert->imagesToRemove().contains(imageType) && m_concert->hasImage(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_concert, imageType);
@@ -9,10 +9,12 @@
 #include "data/Storage.h"
 #include "globals/Helper.h"
 #include "globals/Manager.h"
+#include "globals/MessageIds.h"
 #include "settings/Settings.h"
 #include "tv_shows/TvShowModel.h"
 #include "ui/imports/ImportActions.h"
 #include "ui/imports/UnpackButtons.h"
+#include "ui/notifications/NotificationBox.h"
 #include "ui/notifications/MacNotificationHandler.h"
 #include "ui/notifications/Notificator.h"
 #include "ui/small_widgets/MessageLabel.h"
@@ -47,6 +49,9 @@ DownloadsWidget::DownloadsWidget(QWidget* parent) : QWidget(parent), ui(new Ui::
     connect(m_extractor, &Extractor::sigError, this, &DownloadsWidget::onExtractorError);
     connect(m_extractor, &Extractor::sigFinished, this, &DownloadsWidget::onExtractorFinished);
     connect(m_extractor, &Extractor::sigProgress, this, &DownloadsWidget::onExtractorProgress);
+    connect(m_extractor, &Extractor::sigQueueProgress, this, &DownloadsWidget::onExtractorQueueProgress);
+    connect(m_extractor, &Extractor::sigQueueFinished, this, &DownloadsWidget::onExtractorQueueFinished);
+    connect(ui->tablePackages, &QTableWidget::itemSelectionChanged, this, &DownloadsWidget::onPackageSelectionChanged);
     connect(ui->btnImportMakeMkv, &QAbstractButton::clicked, this, &DownloadsWidget::onImportWithMakeMkv);
 
     connect(Manager::instance()->tvShowFileSearcher(),
@@ -148,7 +153,24 @@ void DownloadsWidget::onUnpack(QString baseName, QString password)
             ui->tablePackages->setCellWidget(row, 4, nullptr);
         }
     }
-    m_extractor->extract(baseName, m_packages[baseName].files, password);
+    m_extractor->extract(baseName, m_packages[baseName].files, password, extractionPriority(baseName));
+}
+
+void DownloadsWidget::onPackageSelectionChanged()
+{
+    for (const QString& baseName : m_packages.keys()) {
+        m_extractor->setPriority(baseName, extractionPriority(baseName));
+    }
+}
+
+int DownloadsWidget::extractionPriority(const QString& baseName) const
+{
+    for (const QTableWidgetItem* item : ui->tablePackages->selectedItems()) {
+        if (item->column() == 0 && item->data(Qt::UserRole).toString() == baseName) {
+            return 1;
+        }
+    }
+    return 0;
 }
 
 void DownloadsWidget::onDelete(QString baseName)
@@ -243,6 +265,18 @@ void DownloadsWidget::onExtractorProgress(QString baseName, int progress)
     }
 }
 
+void DownloadsWidget::onExtractorQueueProgress(int progress)
+{
+    NotificationBox::instance()->showProgressBar(
+        tr("Extracting archives..."), Constants::ExtractorProgressMessageId, true);
+    NotificationBox::instance()->progressBarProgress(progress, 100, Constants::ExtractorProgressMessageId);
+}
+
+void DownloadsWidget::onExtractorQueueFinished()
+{
+    NotificationBox::instance()->hideProgressBar(Constants::ExtractorProgressMessageId);
+}
+
 void DownloadsWidget::updateImportsList(const QMap<QString, mediaelch::DownloadFileSearcher::Import>& imports)
 {
     m_imports = imports;
@@ -40,6 +40,9 @@ private slots:
     void onExtractorError(QString baseName, QString msg);
     void onExtractorFinished(QString baseName, bool success);
     void onExtractorProgress(QString baseName, int progress);
+    void onExtractorQueueProgress(int progress);
+    void onExtractorQueueFinished();
+    void onPackageSelectionChanged();
     void onChangeImportType(int currentIndex);
     void onChangeImportType(int currentIndex, QComboBox* box);
     void onChangeImportDetail(int currentIndex);
@@ -49,6 +52,9 @@ private slots:
     void onScanFinished(mediaelch::DownloadFileSearcher* searcher);
 
 private:
+    /// \brief Selected packages are extracted before other queued packages.
+    int extractionPriority(const QString& baseName) const;
+
     Ui::DownloadsWidget* ui;
 
     QMap<QString, mediaelch::DownloadFileSearcher::Package> m_packages;
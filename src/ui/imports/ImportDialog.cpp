@@ -30,8 +30,6 @@ ImportDialog::ImportDialog(QWidget* parent) : QDialog(parent), ui(new Ui::Import
     loadingMovie->start();
     ui->loading->setMovie(loadingMovie);
 
-    m_timer.setInterval(500);
-
     m_posterDownloadManager = new DownloadManager(this);
     connect(
         m_posterDownloadManager, &DownloadManager::sigDownloadFinished, this, &ImportDialog::onEpisodeDownloadFinished);
@@ -40,7 +38,6 @@ ImportDialog::ImportDialog(QWidget* parent) : QDialog(parent), ui(new Ui::Import
     connect(ui->concertSearchWidget, &ConcertSearchWidget::sigResultClicked, this, &ImportDialog::onConcertChosen);
     connect(ui->tvShowSearchEpisode, &TvShowSearchEpisode::sigResultClicked, this, &ImportDialog::onTvShowChosen);
     connect(ui->btnImport, &QAbstractButton::clicked, this, &ImportDialog::onImport);
-    connect(&m_timer, &QTimer::timeout, this, &ImportDialog::onFileWatcherTimeout);
 }
 
 ImportDialog::~ImportDialog()
@@ -600,6 +597,7 @@ void ImportDialog::onImport()
     ui->btnReject->setEnabled(false);
     m_worker = new FileWorker();
     m_worker->setFiles(m_filesToMove);
+    m_worker->setVerifyCopies(Settings::instance()->advanced()->verifyImportedFiles());
     m_workerThread = new QThread(this);
     if (ui->chkKeepSourceFiles->isChecked()) {
         connect(m_workerThread.data(), &QThread::started, m_worker.data(), &FileWorker::copyFiles);
@@ -609,40 +607,23 @@ void ImportDialog::onImport()
     connect(m_workerThread.data(), &QThread::finished, m_worker.data(), &QObject::deleteLater);
     connect(m_workerThread.data(), &QThread::finished, m_workerThread.data(), &QObject::deleteLater);
     connect(m_worker.data(), &FileWorker::sigFinished, m_workerThread.data(), &QThread::quit);
+    connect(m_worker.data(), &FileWorker::sigProgress, this, &ImportDialog::onMovingFilesProgress);
     connect(m_worker.data(), &FileWorker::sigFinished, this, &ImportDialog::onMovingFilesFinished);
     m_worker->moveToThread(m_workerThread);
     m_workerThread->start();
-    m_timer.start();
 }
 
-void ImportDialog::onFileWatcherTimeout()
+void ImportDialog::onMovingFilesProgress(qint64 bytesDone, qint64 bytesTotal)
 {
-    qint64 sourceSize = 0;
-    qint64 destinationSize = 0;
-    QMapIterator<QString, QString> it(m_filesToMove);
-    while (it.hasNext()) {
-        it.next();
-        QFileInfo sourceFi(it.key());
-        sourceSize += sourceFi.size();
-
-        QFileInfo destFi(it.value());
-        if (!destFi.exists()) {
-            continue;
-        }
-        destinationSize += destFi.size();
-    }
-
-    if (sourceSize == 0) {
+    if (bytesTotal <= 0) {
         return;
     }
-
-    ui->progressBar->setValue(qRound(static_cast<float>(destinationSize) * 100.0f / static_cast<float>(sourceSize)));
+    ui->progressBar->setValue(static_cast<int>(bytesDone * 100 / bytesTotal));
 }
 
 void ImportDialog::onMovingFilesFinished()
 {
     ui->progressBar->setValue(100);
-    m_timer.stop();
     if (m_type == "movie") {
         m_movie->setFiles(m_newFiles);
         m_movie->setInSeparateFolder(m_separateFolders);
@@ -13,7 +13,6 @@
 #include <QDialog>
 #include <QPointer>
 #include <QThread>
-#include <QTimer>
 
 namespace Ui {
 class ImportDialog;
@@ -49,7 +48,7 @@ private slots:
     void onTvShowChosen();
     void onEpisodeLoadDone(TvShowEpisode* episode);
     void onImport();
-    void onFileWatcherTimeout();
+    void onMovingFilesProgress(qint64 bytesDone, qint64 bytesTotal);
     void onMovingFilesFinished();
     void onEpisodeDownloadFinished(DownloadManagerElement elem);
 
@@ -64,7 +63,6 @@ private:
     QStringList m_extraFiles;
     QString m_importDir;
     bool m_separateFolders = false;
-    QTimer m_timer;
     QMap<QString, QString> m_filesToMove;
     QPointer<QThread> m_workerThread;
     QPointer<FileWorker> m_worker;
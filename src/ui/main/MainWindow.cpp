@@ -8,6 +8,7 @@
 #include "globals/ImagePreviewDialog.h"
 #include "globals/Manager.h"
 #include "globals/NameFormatter.h"
+#include "log/StartupProfiler.h"
 #include "media_centers/MediaCenterInterface.h"
 #include "scrapers/movie/MovieScraperInterface.h"
 #include "settings/Settings.h"
@@ -47,8 +48,7 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     QMenu* menu = macMenuBar->addMenu("File");
     QAction* mAbout = menu->addAction("About");
     mAbout->setMenuRole(QAction::AboutRole);
-    auto* aboutDialog = new AboutDialog(this);
-    connect(mAbout, &QAction::triggered, aboutDialog, &AboutDialog::exec);
+    connect(mAbout, &QAction::triggered, this, [this]() { aboutDialog()->exec(); });
 
     QMenu* help = macMenuBar->addMenu("Help");
     const auto addHelpUrl = [help](const QString& str, const QString& url) {
@@ -70,6 +70,7 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
 
     ui->setupUi(this);
     setMinimumHeight(500);
+    mediaelch::StartupProfiler::mark("Set up main window widgets");
 
     MainWindow::m_instance = this;
     QApplication::setAttribute(Qt::AA_DontCreateNativeWidgetSiblings);
@@ -100,20 +101,16 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     m_actions[MainWidgets::Concerts][MainActions::FilterWidget] = true;
     m_actions[MainWidgets::Music][MainActions::FilterWidget] = true;
 
-    m_aboutDialog = new AboutDialog(this);
-    m_supportDialog = new SupportDialog(this);
-    m_settingsWindow = new SettingsWindow(this);
+    // The file scanner dialog is shown right after startup.
     m_fileScannerDialog = new FileScannerDialog(this);
-    m_xbmcSync = new KodiSync(Settings::instance()->kodiSettings(), this);
-    m_renamer = new RenamerDialog(this);
     m_settings = Settings::instance(this);
-    m_exportDialog = new ExportDialog(this);
     setupToolbar();
 
     NotificationBox::instance(this)->reposition(this->size());
     Manager::instance();
     TvShowSearch::instance(this);
     Notificator::instance(nullptr, ui->centralWidget);
+    mediaelch::StartupProfiler::mark("Create file scanner dialog and notifications");
 
     if (!m_settings->mainSplitterState().isNull()) {
         ui->movieSplitter->restoreState(m_settings->mainSplitterState());
@@ -221,18 +218,12 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     connect(m_fileScannerDialog,                       &QDialog::accepted,                 this, &MainWindow::setNewMarks);
     connect(ui->downloadsWidget,                       &DownloadsWidget::sigScanFinished,  this, &MainWindow::setNewMarks);
 
-    connect(m_xbmcSync, &KodiSync::sigTriggerReload, this, &MainWindow::onTriggerReloadAll);
-    connect(m_xbmcSync, &KodiSync::sigFinished,      this, &MainWindow::onKodiSyncFinished);
-
-    connect(m_renamer, &RenamerDialog::sigFilesRenamed, this, &MainWindow::onFilesRenamed);
-
-    connect(m_settingsWindow, &SettingsWindow::sigSaved, this, &MainWindow::onRenewModels, Qt::QueuedConnection);
-
     connect(ui->setsWidget,            &SetsWidget::sigJumpToMovie,          this, &MainWindow::onJumpToMovie);
     connect(ui->certificationWidget,   &CertificationWidget::sigJumpToMovie, this, &MainWindow::onJumpToMovie);
     connect(ui->genreWidget,           &GenreWidget::sigJumpToMovie,         this, &MainWindow::onJumpToMovie);
     connect(ui->movieDuplicatesWidget, &MovieDuplicates::sigJumpToMovie,     this, &MainWindow::onJumpToMovie);
     // clang-format on
+    mediaelch::StartupProfiler::mark("Connect main window widgets");
 
 #ifdef Q_OS_WIN
     setStyleSheet(styleSheet() + " #centralWidget { border-bottom: 1px solid rgba(0, 0, 0, 100); } ");
@@ -266,6 +257,7 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
 
     // hack. without only the fileScannerDialog pops up and blocks until it has finished
     show();
+    mediaelch::StartupProfiler::mark("Restore section and layout");
 
     // Start scanning for files
     QTimer::singleShot(0, m_fileScannerDialog, &FileScannerDialog::exec);
@@ -319,16 +311,16 @@ void MainWindow::closeEvent(QCloseEvent* /*event*/)
 void MainWindow::setupToolbar()
 {
     // clang-format off
-    connect(ui->navbar, &Navbar::sigSearch,    this,             &MainWindow::onActionSearch);
-    connect(ui->navbar, &Navbar::sigSave,      this,             &MainWindow::onActionSave);
-    connect(ui->navbar, &Navbar::sigSaveAll,   this,             &MainWindow::onActionSaveAll);
-    connect(ui->navbar, &Navbar::sigReload,    this,             &MainWindow::onActionReload);
-    connect(ui->navbar, &Navbar::sigAbout,     m_aboutDialog,    &AboutDialog::exec);
-    connect(ui->navbar, &Navbar::sigSettings,  m_settingsWindow, &SettingsWindow::show);
-    connect(ui->navbar, &Navbar::sigLike,      m_supportDialog,  &QDialog::exec);
-    connect(ui->navbar, &Navbar::sigSync,      this,             &MainWindow::onActionXbmc);
-    connect(ui->navbar, &Navbar::sigRename,    this,             &MainWindow::onActionRename);
-    connect(ui->navbar, &Navbar::sigExport,    m_exportDialog,   &ExportDialog::exec);
+    connect(ui->navbar, &Navbar::sigSearch,    this, &MainWindow::onActionSearch);
+    connect(ui->navbar, &Navbar::sigSave,      this, &MainWindow::onActionSave);
+    connect(ui->navbar, &Navbar::sigSaveAll,   this, &MainWindow::onActionSaveAll);
+    connect(ui->navbar, &Navbar::sigReload,    this, &MainWindow::onActionReload);
+    connect(ui->navbar, &Navbar::sigAbout,     this, [this]() { aboutDialog()->exec(); });
+    connect(ui->navbar, &Navbar::sigSettings,  this, [this]() { settingsWindow()->show(); });
+    connect(ui->navbar, &Navbar::sigLike,      this, [this]() { supportDialog()->exec(); });
+    connect(ui->navbar, &Navbar::sigSync,      this, &MainWindow::onActionXbmc);
+    connect(ui->navbar, &Navbar::sigRename,    this, &MainWindow::onActionRename);
+    connect(ui->navbar, &Navbar::sigExport,    this, [this]() { exportDialog()->exec(); });
     // clang-format on
 
     ui->navbar->setActionSearchEnabled(false);
@@ -471,23 +463,24 @@ void MainWindow::onActionReload()
 
 void MainWindow::onActionRename()
 {
+    RenamerDialog* dialog = renamer();
     if (ui->stackedWidget->currentIndex() == 0) {
-        m_renamer->setRenameType(Renamer::RenameType::Movies);
-        m_renamer->setMovies(ui->movieFilesWidget->selectedMovies());
+        dialog->setRenameType(Renamer::RenameType::Movies);
+        dialog->setMovies(ui->movieFilesWidget->selectedMovies());
 
     } else if (ui->stackedWidget->currentIndex() == 1) {
-        m_renamer->setRenameType(Renamer::RenameType::TvShows);
-        m_renamer->setShows(ui->tvShowFilesWidget->selectedShows());
-        m_renamer->setEpisodes(ui->tvShowFilesWidget->selectedEpisodes());
+        dialog->setRenameType(Renamer::RenameType::TvShows);
+        dialog->setShows(ui->tvShowFilesWidget->selectedShows());
+        dialog->setEpisodes(ui->tvShowFilesWidget->selectedEpisodes());
 
     } else if (ui->stackedWidget->currentIndex() == 3) {
-        m_renamer->setRenameType(Renamer::RenameType::Concerts);
-        m_renamer->setConcerts(ui->concertFilesWidget->selectedConcerts());
+        dialog->setRenameType(Renamer::RenameType::Concerts);
+        dialog->setConcerts(ui->concertFilesWidget->selectedConcerts());
 
     } else {
         return;
     }
-    m_renamer->exec();
+    dialog->exec();
 }
 
 /**
@@ -613,7 +606,7 @@ void MainWindow::setNewMarks()
 
 void MainWindow::onActionXbmc()
 {
-    m_xbmcSync->exec();
+    kodiSync()->exec();
 }
 
 void MainWindow::onTriggerReloadAll()
@@ -632,7 +625,7 @@ void MainWindow::onKodiSyncFinished()
 
 void MainWindow::onFilesRenamed(Renamer::RenameType type)
 {
-    if (m_renamer->renameErrorOccured()) {
+    if (renamer()->renameErrorOccured()) {
         m_fileScannerDialog->setForceReload(true);
         if (type == Renamer::RenameType::Movies) {
             m_fileScannerDialog->setReloadType(FileScannerDialog::ReloadType::Movies);
@@ -750,3 +743,55 @@ void MainWindow::onMenu(QToolButton* button)
     ui->navbar->setFilterWidgetEnabled(m_actions[widget][MainActions::FilterWidget]);
     ui->navbar->setActiveWidget(widget);
 }
+
+AboutDialog* MainWindow::aboutDialog()
+{
+    if (m_aboutDialog == nullptr) {
+        m_aboutDialog = new AboutDialog(this);
+    }
+    return m_aboutDialog;
+}
+
+SupportDialog* MainWindow::supportDialog()
+{
+    if (m_supportDialog == nullptr) {
+        m_supportDialog = new SupportDialog(this);
+    }
+    return m_supportDialog;
+}
+
+SettingsWindow* MainWindow::settingsWindow()
+{
+    if (m_settingsWindow == nullptr) {
+        m_settingsWindow = new SettingsWindow(this);
+        connect(m_settingsWindow, &SettingsWindow::sigSaved, this, &MainWindow::onRenewModels, Qt::QueuedConnection);
+    }
+    return m_settingsWindow;
+}
+
+ExportDialog* MainWindow::exportDialog()
+{
+    if (m_exportDialog == nullptr) {
+        m_exportDialog = new ExportDialog(this);
+    }
+    return m_exportDialog;
+}
+
+KodiSync* MainWindow::kodiSync()
+{
+    if (m_xbmcSync == nullptr) {
+        m_xbmcSync = new KodiSync(Settings::instance()->kodiSettings(), this);
+        connect(m_xbmcSync, &KodiSync::sigTriggerReload, this, &MainWindow::onTriggerReloadAll);
+        connect(m_xbmcSync, &KodiSync::sigFinished, this, &MainWindow::onKodiSyncFinished);
+    }
+    return m_xbmcSync;
+}
+
+RenamerDialog* MainWindow::renamer()
+{
+    if (m_renamer == nullptr) {
+        m_renamer = new RenamerDialog(this);
+        connect(m_renamer, &RenamerDialog::sigFilesRenamed, this, &MainWindow::onFilesRenamed);
+    }
+    return m_renamer;
+}
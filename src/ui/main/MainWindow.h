@@ -87,4 +87,12 @@ private:
     QColor m_buttonActiveColor;
     void setupToolbar();
     void setIcons(QToolButton* button);
+
+    // Dialogs that are only needed on user interaction are created on first use.
+    AboutDialog* aboutDialog();
+    SupportDialog* supportDialog();
+    SettingsWindow* settingsWindow();
+    ExportDialog* exportDialog();
+    KodiSync* kodiSync();
+    RenamerDialog* renamer();
 };
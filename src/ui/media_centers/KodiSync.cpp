@@ -24,7 +24,9 @@ KodiSync::KodiSync(KodiSettings& settings, QWidget* parent) :
     m_renameArtworkInProgress{false},
     m_artworkWasRenamed{false},
     m_reloadTimeOut{2000},
-    m_requestId{0}
+    m_requestId{0},
+    m_runningRemoveRequests{0},
+    m_removedItems{0}
 {
     ui->setupUi(this);
 
@@ -95,11 +97,17 @@ void KodiSync::startSync()
     m_xbmcConcerts.clear();
     m_xbmcShows.clear();
     m_xbmcEpisodes.clear();
+    m_xbmcMovieFiles.clear();
+    m_xbmcConcertFiles.clear();
+    m_xbmcShowFiles.clear();
+    m_xbmcEpisodeFiles.clear();
 
     m_moviesToRemove.clear();
     m_concertsToRemove.clear();
     m_tvShowsToRemove.clear();
     m_episodesToRemove.clear();
+    m_runningRemoveRequests = 0;
+    m_removedItems = 0;
 
     for (Movie* movie : Manager::instance()->movieModel()->movies()) {
         if (movie->syncNeeded()) {
@@ -159,64 +167,24 @@ void KodiSync::startSync()
         return;
     }
 
-    QJsonObject limits;
-    limits.insert("end", 100000);
-
-    QJsonArray properties;
-    properties.append(QString("file"));
-    properties.append(QString("playcount"));
-    properties.append(QString("lastplayed"));
-
-    QJsonObject params;
-    params.insert("limits", limits);
-    params.insert("properties", properties);
-
-    QJsonObject o;
-    o.insert("jsonrpc", QString("2.0"));
-    o.insert("params", params);
-
     if (!m_moviesToSync.isEmpty()) {
         m_elements.append(Element::Movies);
-        o.insert("method", QString("VideoLibrary.GetMovies"));
-        o.insert("id", ++m_requestId);
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onMovieListFinished);
     }
-
     if (!m_concertsToSync.isEmpty()) {
         m_elements.append(Element::Concerts);
-        o.insert("method", QString("VideoLibrary.GetMusicVideos"));
-        o.insert("id", ++m_requestId);
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onConcertListFinished);
     }
-
     if (!m_tvShowsToSync.isEmpty()) {
         m_elements.append(Element::TvShows);
-        o.insert("method", QString("VideoLibrary.GetTvShows"));
-        o.insert("id", ++m_requestId);
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onTvShowListFinished);
     }
-
     if (!m_episodesToSync.isEmpty()) {
         m_elements.append(Element::Episodes);
-        o.insert("method", QString("VideoLibrary.GetEpisodes"));
-        o.insert("id", ++m_requestId);
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onEpisodeListFinished);
+    }
+
+    m_pagesToLoad.clear();
+    const QVector<Element> elements = m_elements;
+    for (Element element : elements) {
+        m_pagesToLoad.insert(element, 1);
+        requestLibraryPage(element, 0);
     }
 
     if (m_moviesToSync.isEmpty() && m_concertsToSync.isEmpty() && m_tvShowsToSync.isEmpty()
@@ -228,124 +196,128 @@ void KodiSync::startSync()
     }
 }
 
-void KodiSync::onMovieListFinished()
+namespace {
+
+struct LibraryListing
 {
-    auto* reply = dynamic_cast<QNetworkReply*>(sender());
-    if (reply == nullptr) {
-        qDebug() << "invalid response received";
-        return;
-    }
-    reply->deleteLater();
+    QString method;
+    QString resultKey;
+    QString idKey;
+};
 
-    if (reply->error() != QNetworkReply::NoError) {
-        QMessageBox::warning(this, tr("Network error"), reply->errorString());
-    }
-
-    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll());
-    QJsonObject obj = doc.object();
-    QMapIterator<QString, QVariant> it(obj.value("result").toObject().toVariantMap());
-    while (it.hasNext()) {
-        it.next();
-        if (it.key() == "movies" && !it.value().toList().isEmpty()) {
-            for (const QVariant& var : it.value().toList()) {
-                if (var.toMap().value("movieid").toInt() == 0) {
-                    continue;
-                }
-                m_xbmcMovies.insert(var.toMap().value("movieid").toInt(), parseXbmcDataFromMap(var.toMap()));
-            }
-        }
+LibraryListing libraryListing(KodiSync::Element element)
+{
+    switch (element) {
+    case KodiSync::Element::Movies: return {"VideoLibrary.GetMovies", "movies", "movieid"};
+    case KodiSync::Element::Concerts: return {"VideoLibrary.GetMusicVideos", "musicvideos", "musicvideoid"};
+    case KodiSync::Element::TvShows: return {"VideoLibrary.GetTvShows", "tvshows", "tvshowid"};
+    case KodiSync::Element::Episodes: return {"VideoLibrary.GetEpisodes", "episodes", "episodeid"};
     }
-    checkIfListsReady(Element::Movies);
+    qCritical() << "[KodiSync] Unhandled library element!";
+    return {"VideoLibrary.GetMovies", "movies", "movieid"};
 }
 
-void KodiSync::onConcertListFinished()
+} // namespace
+
+/// \brief Requests one page of Kodi's library listing of the given element.
+/// The first page tells us how many items there are; all other pages are
+/// requested at once when it has arrived.
+void KodiSync::requestLibraryPage(Element element, int start)
 {
-    auto* reply = dynamic_cast<QNetworkReply*>(sender());
-    if (reply == nullptr) {
-        qDebug() << "invalid response received";
-        return;
+    const LibraryListing listing = libraryListing(element);
+
+    QJsonObject limits;
+    limits.insert("start", start);
+    limits.insert("end", start + listPageSize);
+
+    // The play count and last played date are only needed to update the watched state.
+    QJsonArray properties;
+    properties.append(QString("file"));
+    if (m_syncType == SyncType::Watched) {
+        properties.append(QString("playcount"));
+        properties.append(QString("lastplayed"));
     }
+
+    QJsonObject params;
+    params.insert("limits", limits);
+    params.insert("properties", properties);
+
+    QJsonObject o;
+    o.insert("jsonrpc", QString("2.0"));
+    o.insert("method", listing.method);
+    o.insert("params", params);
+    o.insert("id", ++m_requestId);
+
+    QNetworkRequest request(xbmcUrl());
+    request.setRawHeader("Content-Type", "application/json");
+    request.setRawHeader("Accept", "application/json");
+    QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
+    connect(reply, &QNetworkReply::finished, this, [this, reply, element, start]() {
+        onLibraryPageFinished(reply, element, start);
+    });
+}
+
+void KodiSync::onLibraryPageFinished(QNetworkReply* reply, Element element, int start)
+{
     reply->deleteLater();
 
     if (reply->error() != QNetworkReply::NoError) {
-        QMessageBox::warning(this, tr("Network error"), reply->errorString());
-    }
-
-    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll());
-    QJsonObject obj = doc.object();
-    QMapIterator<QString, QVariant> it(obj.value("result").toObject().toVariantMap());
-    while (it.hasNext()) {
-        it.next();
-        if (it.key() == "musicvideos" && !it.value().toList().isEmpty()) {
-            for (const QVariant& var : it.value().toList()) {
-                if (var.toMap().value("musicvideoid").toInt() == 0) {
-                    continue;
-                }
-                m_xbmcConcerts.insert(var.toMap().value("musicvideoid").toInt(), parseXbmcDataFromMap(var.toMap()));
-            }
+        if (start == 0) {
+            QMessageBox::warning(this, tr("Network error"), reply->errorString());
+        } else {
+            qWarning() << "[KodiSync] Could not load library page:" << reply->errorString();
         }
     }
-    checkIfListsReady(Element::Concerts);
-}
 
-void KodiSync::onTvShowListFinished()
-{
-    auto* reply = dynamic_cast<QNetworkReply*>(sender());
-    if (reply == nullptr) {
-        qDebug() << "invalid response received";
-        return;
+    const LibraryListing listing = libraryListing(element);
+    const QJsonObject result = QJsonDocument::fromJson(reply->readAll()).object().value("result").toObject();
+    QMap<int, XbmcData>& items = xbmcItems(element);
+    mediaelch::kodi::KodiFileIndex& files = xbmcFiles(element);
+
+    for (const QJsonValue& value : result.value(listing.resultKey).toArray()) {
+        const QJsonObject item = value.toObject();
+        const int id = item.value(listing.idKey).toInt();
+        if (id == 0) {
+            continue;
+        }
+        const XbmcData data = parseXbmcData(item);
+        items.insert(id, data);
+        files.insert(id, data.file);
     }
-    reply->deleteLater();
 
-    if (reply->error() != QNetworkReply::NoError) {
-        QMessageBox::warning(this, tr("Network error"), reply->errorString());
-    }
-
-    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll());
-    QJsonObject obj = doc.object();
-    QMapIterator<QString, QVariant> it(obj.value("result").toObject().toVariantMap());
-    while (it.hasNext()) {
-        it.next();
-        if (it.key() == "tvshows" && !it.value().toList().isEmpty()) {
-            for (const QVariant& var : it.value().toList()) {
-                if (var.toMap().value("tvshowid").toInt() == 0) {
-                    continue;
-                }
-                m_xbmcShows.insert(var.toMap().value("tvshowid").toInt(), parseXbmcDataFromMap(var.toMap()));
-            }
+    if (start == 0) {
+        const int total = result.value("limits").toObject().value("total").toInt();
+        for (int pageStart = listPageSize; pageStart < total; pageStart += listPageSize) {
+            ++m_pagesToLoad[element];
+            requestLibraryPage(element, pageStart);
         }
     }
-    checkIfListsReady(Element::TvShows);
+
+    if (--m_pagesToLoad[element] == 0) {
+        checkIfListsReady(element);
+    }
 }
 
-void KodiSync::onEpisodeListFinished()
+QMap<int, KodiSync::XbmcData>& KodiSync::xbmcItems(Element element)
 {
-    auto* reply = dynamic_cast<QNetworkReply*>(sender());
-    if (reply == nullptr) {
-        qDebug() << "invalid response received";
-        return;
+    switch (element) {
+    case Element::Movies: return m_xbmcMovies;
+    case Element::Concerts: return m_xbmcConcerts;
+    case Element::TvShows: return m_xbmcShows;
+    case Element::Episodes: return m_xbmcEpisodes;
     }
-    reply->deleteLater();
+    return m_xbmcMovies;
+}
 
-    if (reply->error() != QNetworkReply::NoError) {
-        QMessageBox::warning(this, tr("Network error"), reply->errorString());
-    }
-
-    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll());
-    QJsonObject obj = doc.object();
-    QMapIterator<QString, QVariant> it(obj.value("result").toObject().toVariantMap());
-    while (it.hasNext()) {
-        it.next();
-        if (it.key() == "episodes" && !it.value().toList().isEmpty()) {
-            for (const QVariant& var : it.value().toList()) {
-                if (var.toMap().value("episodeid").toInt() == 0) {
-                    continue;
-                }
-                m_xbmcEpisodes.insert(var.toMap().value("episodeid").toInt(), parseXbmcDataFromMap(var.toMap()));
-            }
-        }
+mediaelch::kodi::KodiFileIndex& KodiSync::xbmcFiles(Element element)
+{
+    switch (element) {
+    case Element::Movies: return m_xbmcMovieFiles;
+    case Element::Concerts: return m_xbmcConcertFiles;
+    case Element::TvShows: return m_xbmcShowFiles;
+    case Element::Episodes: return m_xbmcEpisodeFiles;
     }
-    checkIfListsReady(Element::Episodes);
+    return m_xbmcMovieFiles;
 }
 
 void KodiSync::checkIfListsReady(Element element)
@@ -378,7 +350,7 @@ void KodiSync::setupItemsToRemove()
 {
     for (Movie* movie : m_moviesToSync) {
         movie->setSyncNeeded(false);
-        int id = findId(movie->files().toStringList(), m_xbmcMovies);
+        int id = m_xbmcMovieFiles.findId(movie->files().toStringList());
         if (id > 0) {
             m_moviesToRemove.append(id);
         }
@@ -386,7 +358,7 @@ void KodiSync::setupItemsToRemove()
 
     for (Concert* concert : m_concertsToSync) {
         concert->setSyncNeeded(false);
-        int id = findId(concert->files().toStringList(), m_xbmcConcerts);
+        int id = m_xbmcConcertFiles.findId(concert->files().toStringList());
         if (id > 0) {
             m_concertsToRemove.append(id);
         }
@@ -403,7 +375,7 @@ void KodiSync::setupItemsToRemove()
         } else if (!showDir.contains("/") && !showDir.endsWith("\\")) {
             showDir.append("\\");
         }
-        int id = findId(QStringList() << showDir, m_xbmcShows);
+        int id = m_xbmcShowFiles.findId(QStringList() << showDir);
         if (id > 0) {
             m_tvShowsToRemove.append(id);
         }
@@ -411,101 +383,96 @@ void KodiSync::setupItemsToRemove()
 
     for (TvShowEpisode* episode : m_episodesToSync) {
         episode->setSyncNeeded(false);
-        int id = findId(episode->files().toStringList(), m_xbmcEpisodes);
+        int id = m_xbmcEpisodeFiles.findId(episode->files().toStringList());
         if (id > 0) {
             m_episodesToRemove.append(id);
         }
     }
 }
 
+/// \brief Sends the removals to Kodi in JSON-RPC batch requests.
+/// A few batches are sent at the same time so that Kodi can process one batch while
+/// the next one is transferred. Called again whenever a batch request has finished.
 void KodiSync::removeItems()
 {
-    QJsonObject o;
-    o.insert("jsonrpc", QString("2.0"));
-    o.insert("id", ++m_requestId);
+    while (m_runningRemoveRequests < maxParallelRemoveRequests) {
+        if (!m_moviesToRemove.isEmpty()) {
+            ui->status->setText(tr("Removing movies from database"));
+            sendRemoveRequest("VideoLibrary.RemoveMovie", "movieid", m_moviesToRemove);
 
-    if (!m_moviesToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing movies from database"));
-        int id = m_moviesToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("movieid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveMovie"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
-    }
+        } else if (!m_concertsToRemove.isEmpty()) {
+            ui->status->setText(tr("Removing concerts from database"));
+            sendRemoveRequest("VideoLibrary.RemoveMusicVideo", "musicvideoid", m_concertsToRemove);
 
-    if (!m_concertsToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing concerts from database"));
-        int id = m_concertsToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("musicvideoid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveMusicVideo"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+        } else if (!m_tvShowsToRemove.isEmpty()) {
+            ui->status->setText(tr("Removing TV shows from database"));
+            sendRemoveRequest("VideoLibrary.RemoveTVShow", "tvshowid", m_tvShowsToRemove);
+
+        } else if (!m_episodesToRemove.isEmpty()) {
+            ui->status->setText(tr("Removing episodes from database"));
+            sendRemoveRequest("VideoLibrary.RemoveEpisode", "episodeid", m_episodesToRemove);
+
+        } else {
+            break;
+        }
     }
 
-    if (!m_tvShowsToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing TV shows from database"));
-        int id = m_tvShowsToRemove.takeFirst();
-        QJsonObject params;
-        params.insert("tvshowid", id);
-        o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveTVShow"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+    if (m_runningRemoveRequests == 0) {
+        QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
     }
+}
 
-    if (!m_episodesToRemove.isEmpty()) {
-        ui->status->setText(tr("Removing episodes from database"));
-        int id = m_episodesToRemove.takeFirst();
+/// \brief Removes up to removeBatchSize items of the given list from Kodi's library in one request.
+void KodiSync::sendRemoveRequest(const QString& method, const QString& idKey, QVector<int>& ids)
+{
+    int count = ids.count();
+    if (count > removeBatchSize) {
+        count = removeBatchSize;
+    }
 
+    QJsonArray batch;
+    for (int i = 0; i < count; ++i) {
         QJsonObject params;
-        params.insert("episodeid", id);
+        params.insert(idKey, ids.at(i));
+
+        QJsonObject o;
+        o.insert("jsonrpc", QString("2.0"));
+        o.insert("method", method);
         o.insert("params", params);
-        o.insert("method", QString("VideoLibrary.RemoveEpisode"));
-        QNetworkRequest request(xbmcUrl());
-        request.setRawHeader("Content-Type", "application/json");
-        request.setRawHeader("Accept", "application/json");
-        QNetworkReply* reply = m_network.post(request, QJsonDocument(o).toJson(QJsonDocument::Compact));
-        connect(reply, &QNetworkReply::finished, this, &KodiSync::onRemoveFinished);
-        return;
+        o.insert("id", ++m_requestId);
+        batch.append(o);
     }
+    ids.remove(0, count);
 
-    QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
+    QNetworkRequest request(xbmcUrl());
+    request.setRawHeader("Content-Type", "application/json");
+    request.setRawHeader("Accept", "application/json");
+    QNetworkReply* reply = m_network.post(request, QJsonDocument(batch).toJson(QJsonDocument::Compact));
+    ++m_runningRemoveRequests;
+    connect(reply, &QNetworkReply::finished, this, [this, reply, count]() { onRemoveFinished(reply, count); });
 }
 
-void KodiSync::onRemoveFinished()
+void KodiSync::onRemoveFinished(QNetworkReply* reply, int itemCount)
 {
-    auto* reply = dynamic_cast<QNetworkReply*>(sender());
-    if (reply != nullptr) {
-        reply->deleteLater();
-    }
-
-    ui->progressBar->setValue(ui->progressBar->maximum()
-                              - (m_moviesToRemove.count() + m_episodesToRemove.count() + m_tvShowsToRemove.count()
-                                  + m_concertsToRemove.count()));
-    QApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
+    reply->deleteLater();
+    --m_runningRemoveRequests;
+    m_removedItems += itemCount;
 
-    if (!m_moviesToRemove.isEmpty() || !m_concertsToRemove.isEmpty() || !m_tvShowsToRemove.isEmpty()
-        || !m_episodesToRemove.isEmpty()) {
-        removeItems();
+    if (reply->error() != QNetworkReply::NoError) {
+        qWarning() << "[KodiSync] Could not remove items from Kodi's database:" << reply->errorString();
     } else {
-        QTimer::singleShot(m_reloadTimeOut, this, &KodiSync::triggerReload);
+        // Kodi answers a batch request with an array of responses.
+        const QJsonArray responses = QJsonDocument::fromJson(reply->readAll()).array();
+        for (const QJsonValue& response : responses) {
+            const QJsonObject error = response.toObject().value("error").toObject();
+            if (!error.isEmpty()) {
+                qWarning() << "[KodiSync] Kodi could not remove item:" << error.value("message").toString();
+            }
+        }
     }
+
+    ui->progressBar->setValue(m_removedItems);
+    removeItems();
 }
 
 void KodiSync::triggerReload()
@@ -553,7 +520,7 @@ void KodiSync::onCleanFinished()
 void KodiSync::updateWatched()
 {
     for (Movie* movie : m_moviesToSync) {
-        const int id = findId(movie->files().toStringList(), m_xbmcMovies);
+        const int id = m_xbmcMovieFiles.findId(movie->files().toStringList());
         if (id > 0) {
             movie->blockSignals(true);
             movie->setPlayCount(m_xbmcMovies.value(id).playCount);
@@ -566,7 +533,7 @@ void KodiSync::updateWatched()
     }
 
     for (Concert* concert : m_concertsToSync) {
-        const int id = findId(concert->files().toStringList(), m_xbmcConcerts);
+        const int id = m_xbmcConcertFiles.findId(concert->files().toStringList());
         if (id > 0) {
             concert->blockSignals(true);
             concert->setPlayCount(m_xbmcConcerts.value(id).playCount);
@@ -579,7 +546,7 @@ void KodiSync::updateWatched()
     }
 
     for (TvShowEpisode* episode : m_episodesToSync) {
-        const int id = findId(episode->files().toStringList(), m_xbmcEpisodes);
+        const int id = m_xbmcEpisodeFiles.findId(episode->files().toStringList());
         if (id > 0) {
             episode->blockSignals(true);
             episode->setPlayCount(m_xbmcEpisodes.value(id).playCount);
@@ -595,103 +562,6 @@ void KodiSync::updateWatched()
     ui->buttonSync->setEnabled(true);
 }
 
-int KodiSync::findId(const QStringList& files, const QMap<int, XbmcData>& items)
-{
-    if (files.isEmpty()) {
-        return -1;
-    }
-
-    QVector<int> matches;
-    int level = 0;
-
-    do {
-        matches.clear();
-        QMapIterator<int, XbmcData> it(items);
-        while (it.hasNext()) {
-            it.next();
-            QString file = it.value().file;
-            QStringList xbmcFiles;
-            if (file.startsWith("stack://")) {
-                xbmcFiles << file.mid(8).split(" , ");
-            } else {
-                xbmcFiles << file;
-            }
-
-            if (compareFiles(files, xbmcFiles, level)) {
-                matches.append(it.key());
-            }
-        }
-    } while (matches.count() > 1 && level++ < 4);
-
-    if (matches.count() == 1) {
-        return matches.at(0);
-    }
-    if (matches.count() == 0) {
-        return 0;
-    }
-    return -1;
-}
-
-bool KodiSync::compareFiles(const QStringList& files, const QStringList& xbmcFiles, const int& level)
-{
-    if (files.count() == 1 && xbmcFiles.count() == 1) {
-        QStringList file = splitFile(files.at(0));
-        QStringList xbmcFile = splitFile(xbmcFiles.at(0));
-        for (int i = 0; i <= level; ++i) {
-            if (file.isEmpty() || xbmcFile.isEmpty()) {
-                return false;
-            }
-            if (QString::compare(file.takeLast(), xbmcFile.takeLast(), Qt::CaseInsensitive) != 0) {
-                return false;
-            }
-        }
-        return true;
-    }
-    if (files.count() == xbmcFiles.count()) {
-        // construct a new stack
-        QStringList stack;
-        QStringList xbmcStack;
-        for (const QString& file : xbmcFiles) {
-            QStringList parts = splitFile(file);
-            if (parts.count() < level) {
-                return false;
-            }
-            QStringList partsNew;
-            for (int i = 0; i <= level; ++i) {
-                partsNew << parts.takeLast();
-            }
-            xbmcStack << partsNew.join("/");
-        }
-
-        for (const QString& file : files) {
-            QStringList parts = splitFile(file);
-            if (parts.count() < level) {
-                return false;
-            }
-            QStringList partsNew;
-            for (int i = 0; i <= level; ++i) {
-                partsNew << parts.takeLast();
-            }
-            stack << partsNew.join("/");
-        }
-
-        std::sort(stack.begin(), stack.end());
-        std::sort(xbmcStack.begin(), xbmcStack.end());
-
-        return (stack == xbmcStack);
-    }
-    return false;
-}
-
-QStringList KodiSync::splitFile(const QString& file)
-{
-    // Windows file names must not contain /
-    if (file.contains("/")) {
-        return file.split("/");
-    }
-    return file.split("\\");
-}
-
 void KodiSync::onRadioContents()
 {
     ui->labelContents->setVisible(true);
@@ -716,12 +586,12 @@ void KodiSync::onRadioWatched()
     m_syncType = SyncType::Watched;
 }
 
-KodiSync::XbmcData KodiSync::parseXbmcDataFromMap(QMap<QString, QVariant> map)
+KodiSync::XbmcData KodiSync::parseXbmcData(const QJsonObject& item)
 {
     XbmcData d;
-    d.file = map.value("file").toString().normalized(QString::NormalizationForm_C);
-    d.lastPlayed = map.value("lastplayed").toDateTime();
-    d.playCount = map.value("playcount").toInt();
+    d.file = item.value("file").toString().normalized(QString::NormalizationForm_C);
+    d.lastPlayed = item.value("lastplayed").toVariant().toDateTime();
+    d.playCount = item.value("playcount").toInt();
     return d;
 }
 
@@ -1,11 +1,13 @@
 #pragma once
 
+#include "media_centers/kodi/KodiFileIndex.h"
 #include "movies/Movie.h"
 #include "network/NetworkManager.h"
 #include "settings/KodiSettings.h"
 
 #include <QAuthenticator>
 #include <QDialog>
+#include <QJsonObject>
 #include <QMutex>
 #include <QNetworkReply>
 #include <QTcpSocket>
@@ -55,11 +57,6 @@ signals:
 
 private slots:
     void startSync();
-    void onMovieListFinished();
-    void onConcertListFinished();
-    void onTvShowListFinished();
-    void onEpisodeListFinished();
-    void onRemoveFinished();
     void onScanFinished();
     void onCleanFinished();
     void onRadioContents();
@@ -84,10 +81,16 @@ private:
     QMap<int, XbmcData> m_xbmcConcerts;
     QMap<int, XbmcData> m_xbmcShows;
     QMap<int, XbmcData> m_xbmcEpisodes;
+    mediaelch::kodi::KodiFileIndex m_xbmcMovieFiles;
+    mediaelch::kodi::KodiFileIndex m_xbmcConcertFiles;
+    mediaelch::kodi::KodiFileIndex m_xbmcShowFiles;
+    mediaelch::kodi::KodiFileIndex m_xbmcEpisodeFiles;
     QVector<int> m_moviesToRemove;
     QVector<int> m_concertsToRemove;
     QVector<int> m_tvShowsToRemove;
     QVector<int> m_episodesToRemove;
+    /// Number of pages of Kodi's library listings that are still loading.
+    QMap<Element, int> m_pagesToLoad;
     QMutex m_mutex;
     bool m_allReady;
     bool m_aborted;
@@ -97,15 +100,27 @@ private:
     bool m_artworkWasRenamed;
     int m_reloadTimeOut;
     int m_requestId;
+    int m_runningRemoveRequests;
+    int m_removedItems;
 
-    int findId(const QStringList& files, const QMap<int, XbmcData>& items);
-    bool compareFiles(const QStringList& files, const QStringList& xbmcFiles, const int& level);
-    QStringList splitFile(const QString& file);
+    /// Number of items that are requested from Kodi's library listings per request.
+    static constexpr int listPageSize = 500;
+    /// Number of removals that are sent to Kodi in one JSON-RPC batch request.
+    static constexpr int removeBatchSize = 100;
+    /// Number of batch requests that may be sent to Kodi at the same time.
+    static constexpr int maxParallelRemoveRequests = 2;
+
+    void requestLibraryPage(Element element, int start);
+    void onLibraryPageFinished(QNetworkReply* reply, Element element, int start);
+    QMap<int, XbmcData>& xbmcItems(Element element);
+    mediaelch::kodi::KodiFileIndex& xbmcFiles(Element element);
     void setupItemsToRemove();
     void removeItems();
+    void sendRemoveRequest(const QString& method, const QString& idKey, QVector<int>& ids);
+    void onRemoveFinished(QNetworkReply* reply, int itemCount);
     void updateWatched();
     void checkIfListsReady(Element element);
-    KodiSync::XbmcData parseXbmcDataFromMap(QMap<QString, QVariant> map);
+    KodiSync::XbmcData parseXbmcData(const QJsonObject& item);
     void updateFolderLastModified(const QDir& dir);
     void updateFolderLastModified(Movie* movie);
     void updateFolderLastModified(Concert* concert);
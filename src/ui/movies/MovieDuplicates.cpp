@@ -5,6 +5,7 @@
 #include "globals/Manager.h"
 #include "globals/MessageIds.h"
 #include "movies/Movie.h"
+#include "movies/MovieDuplicateFinder.h"
 #include "movies/MovieProxyModel.h"
 #include "ui/movies/MovieDuplicateItem.h"
 #include "ui/notifications/NotificationBox.h"
@@ -70,30 +71,19 @@ void MovieDuplicates::detectDuplicates()
     ui->duplicates->setRowCount(0);
     m_duplicateMovies.clear();
 
-    int counter = 0;
-    int movieCount = Manager::instance()->movieModel()->movies().count();
+    const QVector<Movie*> movies = Manager::instance()->movieModel()->movies();
+    const int movieCount = movies.count();
     NotificationBox::instance()->showProgressBar(
         tr("Detecting duplicate movies..."), Constants::MovieDuplicatesProgressMessageId);
     NotificationBox::instance()->progressBarProgress(0, movieCount, Constants::MovieDuplicatesProgressMessageId);
 
-    for (Movie* movie : Manager::instance()->movieModel()->movies()) {
-        ++counter;
+    m_duplicateMovies = mediaelch::findMovieDuplicates(movies, [movieCount](int counter) {
         QApplication::processEvents();
-
         NotificationBox::instance()->progressBarProgress(
             counter, movieCount, Constants::MovieDuplicatesProgressMessageId);
-        movie->setHasDuplicates(false);
-
-        QVector<Movie*> dups{movie};
-        for (Movie* subMovie : Manager::instance()->movieModel()->movies()) {
-            if (movie != subMovie && subMovie->isDuplicate(movie)) {
-                dups.append(subMovie);
-            }
-        }
-        if (dups.count() > 1) {
-            m_duplicateMovies.insert(movie, dups);
-            movie->setHasDuplicates(true);
-        }
+    });
+    for (Movie* movie : movies) {
+        movie->setHasDuplicates(m_duplicateMovies.contains(movie));
     }
 
     NotificationBox::instance()->hideProgressBar(Constants::MovieDuplicatesProgressMessageId);
@@ -12,6 +12,7 @@
 #include "globals/MessageIds.h"
 #include "globals/TrailerDialog.h"
 #include "image/ImageCapture.h"
+#include "movies/MovieSaveQueue.h"
 #include "scrapers/movie/CustomMovieScraper.h"
 #include "ui/main/MainWindow.h"
 #include "ui/movies/MovieFilesWidget.h"
@@ -27,6 +28,7 @@
 #include <QPainter>
 #include <QPixmapCache>
 #include <QScrollBar>
+#include <QShortcut>
 #include <QtCore/qmath.h>
 
 MovieWidget::MovieWidget(QWidget* parent) : QWidget(parent), ui(new Ui::MovieWidget)
@@ -160,6 +162,14 @@ MovieWidget::MovieWidget(QWidget* parent) : QWidget(parent), ui(new Ui::MovieWid
     m_savingWidget->setMovie(m_loadingMovie);
     m_savingWidget->hide();
 
+    // Saving several movies can be canceled.
+    auto* cancelSaveShortcut = new QShortcut(QKeySequence::Cancel, this);
+    connect(cancelSaveShortcut, &QShortcut::activated, this, [this]() {
+        if (m_saveQueue != nullptr) {
+            m_saveQueue->cancel();
+        }
+    });
+
     ui->btnImdb->setIcon(style()->standardIcon(QStyle::SP_ArrowRight));
     ui->btnTmdb->setIcon(style()->standardIcon(QStyle::SP_ArrowRight));
     ui->btnImdb->setText(QLatin1String(""));
@@ -741,8 +751,9 @@ void MovieWidget::updateImages(QVector<ImageType> images)
 
 void MovieWidget::updateImage(ImageType imageType, ClosableImage* image)
 {
-    if (!m_movie->images().image(imageType).isNull()) {
-        image->setImage(m_movie->images().image(imageType));
+    const QByteArray data = m_movie->images().image(imageType);
+    if (!data.isNull()) {
+        image->setImage(data);
     } else if (!m_movie->images().imagesToRemove().contains(imageType) && m_movie->hasImage(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_movie, imageType);
         if (!imgFileName.isEmpty()) {
@@ -913,35 +924,22 @@ void MovieWidget::saveInformation()
 
     m_savingWidget->show();
     if (movies.count() > 1) {
-        int counter = 0;
-        const int moviesToSave = movies.count();
-
-        NotificationBox::instance()->showProgressBar(tr("Saving movies..."), Constants::MovieWidgetProgressMessageId);
-        NotificationBox::instance()->progressBarProgress(0, moviesToSave, Constants::MovieWidgetProgressMessageId);
-        QApplication::processEvents();
+        QVector<Movie*> changedMovies;
         for (Movie* movie : movies) {
             if (movie->hasChanged()) {
-                counter++;
-                NotificationBox::instance()->progressBarProgress(
-                    counter, moviesToSave, Constants::MovieWidgetProgressMessageId);
-                QApplication::processEvents();
-                movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-                movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-                if (m_movie == movie) {
-                    updateMovieInfo();
-                }
+                changedMovies << movie;
             }
         }
-        NotificationBox::instance()->hideProgressBar(Constants::MovieWidgetProgressMessageId);
-        NotificationBox::instance()->showSuccess(tr("Movies Saved"));
-    } else {
-        const int id = NotificationBox::instance()->showMessage(tr("Saving movie..."));
-        m_movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-        m_movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-        updateMovieInfo();
-        NotificationBox::instance()->removeMessage(id);
-        NotificationBox::instance()->showSuccess(tr("<b>\"%1\"</b> Saved").arg(m_movie->name()));
+        saveMovies(changedMovies);
+        return;
     }
+
+    const int id = NotificationBox::instance()->showMessage(tr("Saving movie..."));
+    m_movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
+    m_movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+    updateMovieInfo();
+    NotificationBox::instance()->removeMessage(id);
+    NotificationBox::instance()->showSuccess(tr("<b>\"%1\"</b> Saved").arg(m_movie->name()));
     setEnabledTrue();
     m_savingWidget->hide();
     ui->buttonRevert->setVisible(false);
@@ -956,35 +954,62 @@ void MovieWidget::saveAll()
     setDisabledTrue();
     m_savingWidget->show();
 
-    int counter = 0;
-    int moviesToSave = 0;
+    QVector<Movie*> changedMovies;
     for (Movie* movie : Manager::instance()->movieModel()->movies()) {
         if (movie->hasChanged()) {
-            moviesToSave++;
+            changedMovies << movie;
         }
     }
+    saveMovies(changedMovies);
+}
+
+/**
+ * \brief Saves the movies in the background. The widget must be disabled until all movies are saved.
+ */
+void MovieWidget::saveMovies(const QVector<Movie*>& movies)
+{
+    if (m_saveQueue == nullptr) {
+        m_saveQueue = new mediaelch::MovieSaveQueue(
+            *Manager::instance()->mediaCenterInterface(), Manager::instance()->database(), this);
+        connect(m_saveQueue, &mediaelch::MovieSaveQueue::sigMovieSaved, this, &MovieWidget::onMovieSaved);
+        connect(m_saveQueue, &mediaelch::MovieSaveQueue::sigProgress, this, &MovieWidget::onSaveProgress);
+        connect(m_saveQueue, &mediaelch::MovieSaveQueue::sigFinished, this, &MovieWidget::onSaveFinished);
+    }
+    if (m_saveQueue->isRunning()) {
+        return;
+    }
 
     NotificationBox::instance()->showProgressBar(tr("Saving movies..."), Constants::MovieWidgetProgressMessageId);
-    NotificationBox::instance()->progressBarProgress(0, moviesToSave, Constants::MovieWidgetProgressMessageId);
-    QApplication::processEvents();
-    for (Movie* movie : Manager::instance()->movieModel()->movies()) {
-        if (movie->hasChanged()) {
-            counter++;
-            NotificationBox::instance()->progressBarProgress(
-                counter, moviesToSave, Constants::MovieWidgetProgressMessageId);
-            QApplication::processEvents();
-            movie->controller()->saveData(Manager::instance()->mediaCenterInterface());
-            movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
-            if (m_movie == movie) {
-                updateMovieInfo();
-            }
-        }
+    m_saveQueue->save(movies);
+}
+
+void MovieWidget::onMovieSaved(Movie* movie, bool saved)
+{
+    Q_UNUSED(saved);
+    movie->controller()->loadData(Manager::instance()->mediaCenterInterface(), true);
+    if (m_movie == movie) {
+        updateMovieInfo();
     }
+}
+
+void MovieWidget::onSaveProgress(int done, int total)
+{
+    NotificationBox::instance()->progressBarProgress(done, total, Constants::MovieWidgetProgressMessageId);
+}
+
+void MovieWidget::onSaveFinished(int saved, int failed, bool canceled)
+{
     setEnabledTrue();
     m_savingWidget->hide();
     NotificationBox::instance()->hideProgressBar(Constants::MovieWidgetProgressMessageId);
-    NotificationBox::instance()->showSuccess(tr("All Movies Saved"));
-    ui->buttonRevert->setVisible(false);
+    if (failed > 0) {
+        NotificationBox::instance()->showError(tr("%n movie(s) could not be saved", "", failed));
+    } else if (canceled) {
+        NotificationBox::instance()->showWarning(tr("Saving canceled; %n movie(s) saved", "", saved));
+    } else {
+        NotificationBox::instance()->showSuccess(tr("Movies Saved"));
+    }
+    ui->buttonRevert->setVisible(m_movie != nullptr && m_movie->hasChanged());
 }
 
 /**
@@ -1141,7 +1166,7 @@ void MovieWidget::onActorChanged()
 
     auto* actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
     if (!actor->image.isNull()) {
-        QPixmap p = QPixmap::fromImage(QImage::fromData(actor->image));
+        QPixmap p = QPixmap::fromImage(QImage::fromData(actor->image.data()));
         ui->actorResolution->setText(QString("%1 x %2").arg(p.width()).arg(p.height()));
         p = p.scaled(QSize(120, 180) * helper::devicePixelRatio(this), Qt::KeepAspectRatio, Qt::SmoothTransformation);
         helper::setDevicePixelRatio(p, helper::devicePixelRatio(this));
@@ -1178,7 +1203,7 @@ void MovieWidget::onChangeActorImage()
         QFile file(fileName);
         if (file.open(QIODevice::ReadOnly)) {
             auto actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
-            actor->image = file.readAll();
+            actor->image = mediaelch::ImageBlob(file.readAll());
             actor->imageHasChanged = true;
             onActorChanged();
             m_movie->setChanged(true);
@@ -15,6 +15,10 @@ namespace Ui {
 class MovieWidget;
 }
 
+namespace mediaelch {
+class MovieSaveQueue;
+}
+
 class ClosableImage;
 
 /**
@@ -121,6 +125,10 @@ private slots:
 
     void updateImage(ImageType imageType, ClosableImage* image);
 
+    void onMovieSaved(Movie* movie, bool saved);
+    void onSaveProgress(int done, int total);
+    void onSaveFinished(int saved, int failed, bool canceled);
+
 private:
     Ui::MovieWidget* ui;
     QPointer<Movie> m_movie;
@@ -130,5 +138,7 @@ private:
     QVector<QVector<QLineEdit*>> m_streamDetailsAudio;
     QVector<QVector<QLineEdit*>> m_streamDetailsSubtitles;
     QLabel* m_backgroundLabel;
+    mediaelch::MovieSaveQueue* m_saveQueue = nullptr;
     void updateImages(QVector<ImageType> images);
+    void saveMovies(const QVector<Movie*>& movies);
 };
@@ -301,8 +301,9 @@ void MusicWidgetAlbum::updateAlbumInfo()
 
 void MusicWidgetAlbum::updateImage(ImageType imageType, ClosableImage* image)
 {
-    if (!m_album->rawImage(imageType).isNull()) {
-        image->setImage(m_album->rawImage(imageType));
+    const QByteArray data = m_album->rawImage(imageType);
+    if (!data.isNull()) {
+        image->setImage(data);
     } else if (!m_album->imagesToRemove().contains(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_album, imageType);
         if (!imgFileName.isEmpty()) {
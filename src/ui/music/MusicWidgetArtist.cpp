@@ -287,8 +287,9 @@ void MusicWidgetArtist::updateArtistInfo()
 
 void MusicWidgetArtist::updateImage(ImageType imageType, ClosableImage* image)
 {
-    if (!m_artist->rawImage(imageType).isNull()) {
-        image->setImage(m_artist->rawImage(imageType));
+    const QByteArray data = m_artist->rawImage(imageType);
+    if (!data.isNull()) {
+        image->setImage(data);
 
     } else if (!m_artist->imagesToRemove().contains(imageType)) {
         QString imgFileName = Manager::instance()->mediaCenterInterface()->imageFileName(m_artist, imageType);
@@ -2,6 +2,7 @@
 #include "ui_FilterWidget.h"
 
 #include <QGraphicsDropShadowEffect>
+#include <QSet>
 
 #include "globals/Globals.h"
 #include "globals/Helper.h"
@@ -298,19 +299,26 @@ QVector<Filter*> FilterWidget::setupMovieFilters()
     // TODO: QVector<MovieSet>
     QStringList sets;
 
-    const auto copyNotEmptyUnique = [](const QStringList& from, QStringList& to) {
+    // Sets of the values in the lists above to avoid searching the lists.
+    QSet<QString> genreSet;
+    QSet<QString> studioSet;
+    QSet<QString> countrySet;
+    QSet<QString> tagSet;
+
+    const auto copyNotEmptyUnique = [](const QStringList& from, QStringList& to, QSet<QString>& set) {
         for (const QString& str : from) {
-            if (!str.isEmpty() && !to.contains(str)) {
+            if (!str.isEmpty() && !set.contains(str)) {
+                set.insert(str);
                 to.append(str);
             }
         }
     };
 
     for (Movie* movie : Manager::instance()->movieModel()->movies()) {
-        copyNotEmptyUnique(movie->genres(), genres);
-        copyNotEmptyUnique(movie->studios(), studios);
-        copyNotEmptyUnique(movie->countries(), countries);
-        copyNotEmptyUnique(movie->tags(), tags);
+        copyNotEmptyUnique(movie->genres(), genres, genreSet);
+        copyNotEmptyUnique(movie->studios(), studios, studioSet);
+        copyNotEmptyUnique(movie->countries(), countries, countrySet);
+        copyNotEmptyUnique(movie->tags(), tags, tagSet);
 
         if (!directors.contains(movie->director())) {
             directors.append(movie->director());
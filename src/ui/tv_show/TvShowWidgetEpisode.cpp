@@ -431,8 +431,9 @@ void TvShowWidgetEpisode::updateEpisodeInfo()
     ui->videoScantype->setEnabled(m_episode->streamDetailsLoaded());
     ui->stereoMode->setEnabled(m_episode->streamDetailsLoaded());
 
-    if (!m_episode->thumbnailImage().isNull()) {
-        ui->thumbnail->setImage(m_episode->thumbnailImage());
+    const QByteArray thumbnail = m_episode->thumbnailImage();
+    if (!thumbnail.isNull()) {
+        ui->thumbnail->setImage(thumbnail);
     } else if (!Manager::instance()
                     ->mediaCenterInterface()
                     ->imageFileName(m_episode, ImageType::TvShowEpisodeThumb)
@@ -1102,7 +1103,7 @@ void TvShowWidgetEpisode::onActorChanged()
 
     auto actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
     if (!actor->image.isNull()) {
-        QImage img = QImage::fromData(actor->image);
+        QImage img = QImage::fromData(actor->image.data());
         ui->actor->setPixmap(QPixmap::fromImage(img).scaled(120, 180, Qt::KeepAspectRatio, Qt::SmoothTransformation));
         ui->actorResolution->setText(QString("%1 x %2").arg(img.width()).arg(img.height()));
     } else if (!Manager::instance()->mediaCenterInterface()->actorImageName(m_episode, *actor).isEmpty()) {
@@ -1131,7 +1132,7 @@ void TvShowWidgetEpisode::onChangeActorImage()
             QBuffer buffer(&ba);
             img.save(&buffer, "jpg", 100);
             auto actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
-            actor->image = ba;
+            actor->image = mediaelch::ImageBlob(ba);
             actor->imageHasChanged = true;
             onActorChanged();
             m_episode->setChanged(true);
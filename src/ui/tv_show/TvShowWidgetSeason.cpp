@@ -136,8 +136,9 @@ void TvShowWidgetSeason::updateImages(QVector<ImageType> images)
             continue;
         }
 
-        if (!m_show->seasonImage(m_season, imageType).isNull()) {
-            image->setImage(m_show->seasonImage(m_season, imageType));
+        const QByteArray data = m_show->seasonImage(m_season, imageType);
+        if (!data.isNull()) {
+            image->setImage(data);
         } else if (!Manager::instance()
                         ->mediaCenterInterfaceTvShow()
                         ->imageFileName(m_show, imageType, m_season)
@@ -427,8 +427,9 @@ void TvShowWidgetTvShow::updateImages(QVector<ImageType> images)
             continue;
         }
 
-        if (!m_show->image(imageType).isNull()) {
-            image->setImage(m_show->image(imageType));
+        const QByteArray data = m_show->image(imageType);
+        if (!data.isNull()) {
+            image->setImage(data);
         } else if (!m_show->imagesToRemove().contains(imageType)
                    && !Manager::instance()->mediaCenterInterface()->imageFileName(m_show, imageType).isEmpty()) {
             image->setImage(Manager::instance()->mediaCenterInterface()->imageFileName(m_show, imageType));
@@ -913,7 +914,7 @@ void TvShowWidgetTvShow::onActorChanged()
 
     auto actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
     if (!actor->image.isNull()) {
-        QImage img = QImage::fromData(actor->image);
+        QImage img = QImage::fromData(actor->image.data());
         ui->actorResolution->setText(QString("%1 x %2").arg(img.width()).arg(img.height()));
         QPixmap pixmap = QPixmap::fromImage(img).scaled(
             QSize(120, 180) * helper::devicePixelRatio(this), Qt::KeepAspectRatio, Qt::SmoothTransformation);
@@ -952,7 +953,7 @@ void TvShowWidgetTvShow::onChangeActorImage()
             QBuffer buffer(&ba);
             img.save(&buffer, "jpg", 100);
             auto actor = ui->actors->item(ui->actors->currentRow(), 1)->data(Qt::UserRole).value<Actor*>();
-            actor->image = ba;
+            actor->image = mediaelch::ImageBlob(ba);
             actor->imageHasChanged = true;
             onActorChanged();
             m_show->setChanged(true);
@@ -0,0 +1,393 @@
+#include "test/benchmarks/SyntheticLibrary.h"
+
+#include "media_centers/kodi/v18/EpisodeXmlWriterV18.h"
+#include "media_centers/kodi/v18/MovieXmlWriterV18.h"
+#include "media_centers/kodi/v18/TvShowXmlWriterV18.h"
+#include "movies/Movie.h"
+#include "tv_shows/TvShow.h"
+#include "tv_shows/TvShowEpisode.h"
+
+#include <QBuffer>
+#include <QDate>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QTextStream>
+#include <chrono>
+#include <random>
+
+namespace {
+
+// The output of std::mt19937 is defined by the standard, unlike the
+// distributions, so only use its raw output to stay reproducible.
+template<std::size_t N>
+const char* pick(std::mt19937& rng, const char* const (&words)[N])
+{
+    return words[rng() % N];
+}
+
+const char* const titleWords[] = {"Dark", "Star", "Night", "Last", "Lost", "City", "River", "Storm", "Silent",
+    "Golden", "Iron", "Broken", "Hidden", "Winter", "Summer", "Shadow", "Fire", "Ocean", "Empire", "Dream",
+    "Amélie", "Mädchen", "Déjà", "Kingdom", "Legacy", "Return", "Rise", "Fall", "Secret", "Journey"};
+const char* const genres[] = {"Action", "Adventure", "Animation", "Comedy", "Crime", "Documentary", "Drama",
+    "Family", "Fantasy", "History", "Horror", "Music", "Mystery", "Romance", "Science Fiction", "Thriller", "War",
+    "Western"};
+const char* const studios[] = {"Warner Bros.", "Universal Pictures", "Paramount", "20th Century Fox", "Columbia",
+    "Metro-Goldwyn-Mayer", "Lionsgate", "StudioCanal", "Constantin Film", "Toho", "Gaumont", "A24"};
+const char* const countries[] = {"United States of America", "United Kingdom", "Germany", "France", "Japan",
+    "Canada", "Italy", "Spain", "South Korea", "Australia"};
+const char* const firstNames[] = {"Anna", "Ben", "Clara", "David", "Emma", "Felix", "Grace", "Henry", "Ines",
+    "Jonas", "Kate", "Liam", "Mia", "Noah", "Olivia", "Paul", "Rosa", "Sam", "Tom", "Zoe"};
+const char* const lastNames[] = {"Smith", "Miller", "Müller", "Dubois", "Tanaka", "Rossi", "García", "Kim", "Brown",
+    "Wilson", "Schmidt", "Martin", "Lee", "Walker", "Young", "King", "Wright", "Scott", "Green", "Baker"};
+const char* const certifications[] = {"Rated G", "Rated PG", "Rated PG-13", "Rated R", "FSK 12", "FSK 16"};
+const char* const networks[] = {"HBO", "BBC One", "Netflix", "AMC", "FX", "ZDF", "NHK", "CBS"};
+
+QString sentence(std::mt19937& rng, int words)
+{
+    QStringList list;
+    for (int i = 0; i < words; ++i) {
+        list << QString::fromUtf8(pick(rng, titleWords)).toLower();
+    }
+    QString text = list.join(' ') + '.';
+    text[0] = text[0].toUpper();
+    return text;
+}
+
+QString personName(std::mt19937& rng)
+{
+    const QString firstName = QString::fromUtf8(pick(rng, firstNames));
+    return QStringLiteral("%1 %2").arg(firstName, QString::fromUtf8(pick(rng, lastNames)));
+}
+
+QDate date(std::mt19937& rng, int firstYear, int years)
+{
+    // Separate statements: the evaluation order of function arguments is unspecified.
+    const int year = firstYear + static_cast<int>(rng() % static_cast<unsigned>(years));
+    const int month = 1 + static_cast<int>(rng() % 12);
+    return QDate(year, month, 1);
+}
+
+QString plot(std::mt19937& rng)
+{
+    QStringList sentences;
+    for (int i = 0; i < 4; ++i) {
+        sentences << sentence(rng, 8 + static_cast<int>(rng() % 8));
+    }
+    return sentences.join(' ');
+}
+
+QVector<Actor> actors(std::mt19937& rng, int count)
+{
+    QVector<Actor> list;
+    for (int i = 0; i < count; ++i) {
+        Actor actor;
+        actor.name = personName(rng);
+        actor.role = personName(rng);
+        actor.thumb = QStringLiteral("https://image.tmdb.org/t/p/original/%1.jpg").arg(rng(), 8, 16, QChar('0'));
+        actor.order = i;
+        list << actor;
+    }
+    return list;
+}
+
+/// A small but valid JPEG that is used for all artwork.
+const QByteArray& artworkStub()
+{
+    static const QByteArray stub = []() {
+        QImage image(32, 48, QImage::Format_RGB32);
+        image.fill(Qt::darkBlue);
+        QByteArray data;
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::WriteOnly);
+        image.save(&buffer, "jpg", 80);
+        return data;
+    }();
+    return stub;
+}
+
+bool writeFile(const QString& path, const QByteArray& content)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCritical() << "[SyntheticLibrary] Could not write" << path;
+        return false;
+    }
+    return file.write(content) == content.size();
+}
+
+QString markerFile(const QDir& root)
+{
+    return root.filePath("synthetic-library.txt");
+}
+
+} // namespace
+
+SyntheticLibrary::SyntheticLibrary(QDir root, SyntheticLibraryConfig config) :
+    m_root{std::move(root)}, m_config{config}
+{
+}
+
+bool SyntheticLibrary::generate()
+{
+    QFile marker(markerFile(m_root));
+    if (marker.open(QIODevice::ReadOnly) && QString::fromUtf8(marker.readAll()) == configString()) {
+        qInfo() << "[SyntheticLibrary] Reusing library in" << m_root.absolutePath();
+        return true;
+    }
+    marker.close();
+
+    qInfo() << "[SyntheticLibrary] Generating library in" << m_root.absolutePath() << configString();
+    // Only ever delete libraries that were generated by us, never e.g. a user's real library.
+    const QDir::Filters allEntries = QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot;
+    if (m_root.exists() && !m_root.entryList(allEntries).isEmpty()) {
+        if (!marker.exists()) {
+            qCritical() << "[SyntheticLibrary] Refusing to generate a library in a non-empty directory without"
+                        << markerFile(m_root);
+            return false;
+        }
+        if (!m_root.removeRecursively()) {
+            qCritical() << "[SyntheticLibrary] Could not remove old library";
+            return false;
+        }
+    }
+    if (!m_root.mkpath(movieDir()) || !m_root.mkpath(showDir())) {
+        qCritical() << "[SyntheticLibrary] Could not create library directories";
+        return false;
+    }
+    if (!writeMovies() || !writeShows()) {
+        return false;
+    }
+    // Written last, so that an aborted generation is started again.
+    return writeFile(markerFile(m_root), configString().toUtf8());
+}
+
+QString SyntheticLibrary::movieDir() const
+{
+    return m_root.absoluteFilePath("movies");
+}
+
+QString SyntheticLibrary::showDir() const
+{
+    return m_root.absoluteFilePath("shows");
+}
+
+QStringList SyntheticLibrary::movieNfoFiles() const
+{
+    QStringList files;
+    for (int i = 0; i < m_config.movies; ++i) {
+        const QString name = movieBaseName(i);
+        files << QStringLiteral("%1/%2/%2.nfo").arg(movieDir(), name);
+    }
+    return files;
+}
+
+QStringList SyntheticLibrary::episodeNfoFiles() const
+{
+    QStringList files;
+    for (int show = 0; show < m_config.shows; ++show) {
+        const QString name = showName(show);
+        for (int episode = 0; episode < m_config.episodesPerShow; ++episode) {
+            const int season = episode / m_config.episodesPerSeason + 1;
+            const int number = episode % m_config.episodesPerSeason + 1;
+            files << QStringLiteral("%1/%2/Season %3/%2 S%4E%5.nfo")
+                         .arg(showDir(), name)
+                         .arg(season)
+                         .arg(season, 2, 10, QChar('0'))
+                         .arg(number, 2, 10, QChar('0'));
+        }
+    }
+    return files;
+}
+
+std::unique_ptr<Movie> SyntheticLibrary::createMovie(int index) const
+{
+    // Duplicates share the title and IMDb id of their predecessor.
+    const bool isDuplicate = m_config.duplicateEvery > 0 && index > 0 && index % m_config.duplicateEvery == 0;
+    const int titleIndex = isDuplicate ? index - 1 : index;
+
+    std::mt19937 titleRng(m_config.seed + static_cast<unsigned>(titleIndex));
+    std::mt19937 rng(m_config.seed * 31U + static_cast<unsigned>(index));
+
+    auto movie = std::make_unique<Movie>();
+    QString title = sentence(titleRng, 1 + static_cast<int>(titleRng() % 3));
+    title.chop(1);
+    movie->setName(title);
+    movie->setOriginalName(title);
+    movie->setId(ImdbId(QStringLiteral("tt%1").arg(titleIndex + 1, 7, 10, QChar('0'))));
+    movie->setTmdbId(TmdbId(index + 1));
+    movie->setReleased(date(rng, 1950, 72));
+    movie->setRuntime(std::chrono::minutes(80 + rng() % 100));
+    movie->setOverview(plot(rng));
+    movie->setTagline(sentence(rng, 5));
+    movie->setCertification(Certification(QString::fromUtf8(pick(rng, certifications))));
+    movie->setDirector(personName(rng));
+    const QString writer = personName(rng);
+    movie->setWriter(writer + ", " + personName(rng));
+    for (unsigned i = 0, n = 1 + rng() % 3; i < n; ++i) {
+        movie->addGenre(QString::fromUtf8(pick(rng, genres)));
+    }
+    movie->addStudio(QString::fromUtf8(pick(rng, studios)));
+    movie->addCountry(QString::fromUtf8(pick(rng, countries)));
+    if (rng() % 4 == 0) {
+        movie->addTag(QStringLiteral("Tag %1").arg(rng() % 100));
+    }
+    Rating rating;
+    rating.source = "themoviedb";
+    rating.rating = static_cast<double>(rng() % 100) / 10.0;
+    rating.voteCount = static_cast<int>(rng() % 20000);
+    movie->ratings().append(rating);
+    movie->setActors(actors(rng, 5 + static_cast<int>(rng() % 10)));
+
+    const QString name = movieBaseName(index);
+    movie->setFiles(QStringList{QStringLiteral("%1/%2/%2.mkv").arg(movieDir(), name)});
+    movie->setInSeparateFolder(true);
+    movie->setChanged(false);
+    return movie;
+}
+
+std::vector<std::unique_ptr<Movie>> SyntheticLibrary::createMovies(int count) const
+{
+    std::vector<std::unique_ptr<Movie>> movies;
+    movies.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        movies.push_back(createMovie(i));
+    }
+    return movies;
+}
+
+std::unique_ptr<TvShow> SyntheticLibrary::createShow(int index) const
+{
+    std::mt19937 rng(m_config.seed * 17U + static_cast<unsigned>(index));
+    const QString name = showName(index);
+
+    auto show = std::make_unique<TvShow>(mediaelch::DirectoryPath(showDir() + "/" + name));
+    show->setTitle(name);
+    show->setShowTitle(name);
+    show->setTvdbId(TvDbId(100000 + index));
+    show->setImdbId(ImdbId(QStringLiteral("tt%1").arg(5000000 + index, 7, 10, QChar('0'))));
+    show->setFirstAired(date(rng, 1990, 31));
+    show->setOverview(plot(rng));
+    show->setNetwork(QString::fromUtf8(pick(rng, networks)));
+    show->setCertification(Certification(QString::fromUtf8(pick(rng, certifications))));
+    show->addGenre(QString::fromUtf8(pick(rng, genres)));
+    show->addGenre(QString::fromUtf8(pick(rng, genres)));
+    for (const Actor& actor : actors(rng, 8)) {
+        show->addActor(actor);
+    }
+    show->setChanged(false);
+    return show;
+}
+
+std::unique_ptr<TvShowEpisode> SyntheticLibrary::createEpisode(TvShow& show, int showIndex, int episodeIndex) const
+{
+    std::mt19937 rng(m_config.seed * 13U + static_cast<unsigned>(showIndex * m_config.episodesPerShow + episodeIndex));
+    const int season = episodeIndex / m_config.episodesPerSeason + 1;
+    const int number = episodeIndex % m_config.episodesPerSeason + 1;
+    const QString name = showName(showIndex);
+    const QString file = QStringLiteral("%1/%2/Season %3/%2 S%4E%5.mkv")
+                             .arg(showDir(), name)
+                             .arg(season)
+                             .arg(season, 2, 10, QChar('0'))
+                             .arg(number, 2, 10, QChar('0'));
+
+    auto episode = std::make_unique<TvShowEpisode>(mediaelch::FileList(QStringList{file}), &show);
+    episode->setShowTitle(name);
+    episode->setTitle(sentence(rng, 2 + static_cast<int>(rng() % 4)));
+    episode->setSeason(SeasonNumber(season));
+    episode->setEpisode(EpisodeNumber(number));
+    episode->setOverview(plot(rng));
+    episode->setFirstAired(date(rng, 1990, 31));
+    episode->setTvdbId(TvDbId(1000000 + showIndex * m_config.episodesPerShow + episodeIndex));
+    episode->addDirector(personName(rng));
+    episode->addWriter(personName(rng));
+    for (const Actor& actor : actors(rng, 3)) {
+        episode->addActor(actor);
+    }
+    episode->setChanged(false);
+    return episode;
+}
+
+QString SyntheticLibrary::configString() const
+{
+    return QStringLiteral("version=1 movies=%1 shows=%2 episodesPerShow=%3 episodesPerSeason=%4 duplicateEvery=%5 "
+                          "seed=%6")
+        .arg(m_config.movies)
+        .arg(m_config.shows)
+        .arg(m_config.episodesPerShow)
+        .arg(m_config.episodesPerSeason)
+        .arg(m_config.duplicateEvery)
+        .arg(m_config.seed);
+}
+
+QString SyntheticLibrary::movieBaseName(int index) const
+{
+    // The index keeps folder names unique even for duplicates.
+    std::mt19937 rng(m_config.seed + static_cast<unsigned>(index));
+    QString title = sentence(rng, 1 + static_cast<int>(rng() % 3));
+    title.chop(1);
+    return QStringLiteral("%1 (%2)").arg(title).arg(index, 6, 10, QChar('0'));
+}
+
+QString SyntheticLibrary::showName(int index) const
+{
+    std::mt19937 rng(m_config.seed * 7U + static_cast<unsigned>(index));
+    QString title = sentence(rng, 2);
+    title.chop(1);
+    return QStringLiteral("%1 %2").arg(title).arg(index, 4, 10, QChar('0'));
+}
+
+bool SyntheticLibrary::writeMovies()
+{
+    for (int i = 0; i < m_config.movies; ++i) {
+        const QString name = movieBaseName(i);
+        const QString dir = movieDir() + "/" + name;
+        if (!m_root.mkpath(dir)) {
+            return false;
+        }
+        std::unique_ptr<Movie> movie = createMovie(i);
+        mediaelch::kodi::MovieXmlWriterV18 writer(*movie);
+        const bool success = writeFile(QStringLiteral("%1/%2.mkv").arg(dir, name), QByteArray())
+                             && writeFile(QStringLiteral("%1/%2.nfo").arg(dir, name), writer.getMovieXml())
+                             && writeFile(QStringLiteral("%1/%2-poster.jpg").arg(dir, name), artworkStub())
+                             && writeFile(QStringLiteral("%1/%2-fanart.jpg").arg(dir, name), artworkStub());
+        if (!success) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SyntheticLibrary::writeShows()
+{
+    for (int i = 0; i < m_config.shows; ++i) {
+        std::unique_ptr<TvShow> show = createShow(i);
+        const QString dir = show->dir().toString();
+        if (!m_root.mkpath(dir)) {
+            return false;
+        }
+        mediaelch::kodi::TvShowXmlWriterV18 showWriter(*show);
+        if (!writeFile(dir + "/tvshow.nfo", showWriter.getTvShowXml())
+            || !writeFile(dir + "/poster.jpg", artworkStub())) {
+            return false;
+        }
+
+        for (int e = 0; e < m_config.episodesPerShow; ++e) {
+            std::unique_ptr<TvShowEpisode> episode = createEpisode(*show, i, e);
+            const QString file = episode->files().first().toString();
+            const QString baseName = file.left(file.size() - 4);
+            if (!m_root.mkpath(QFileInfo(file).absolutePath())) {
+                return false;
+            }
+            mediaelch::kodi::EpisodeXmlWriterV18 episodeWriter(QVector<TvShowEpisode*>{episode.get()});
+            const bool success = writeFile(file, QByteArray())
+                                 && writeFile(baseName + ".nfo", episodeWriter.getEpisodeXml())
+                                 && writeFile(baseName + "-thumb.jpg", artworkStub());
+            if (!success) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QDir>
+#include <QString>
+#include <memory>
+#include <vector>
+
+class Movie;
+class TvShow;
+class TvShowEpisode;
+
+/// \brief Size of the synthetic library used by the benchmarks.
+struct SyntheticLibraryConfig
+{
+    int movies = 50000;
+    int shows = 2000;
+    int episodesPerShow = 50;
+    int episodesPerSeason = 10;
+    /// Every n-th movie has the same title and IMDb id as its predecessor.
+    int duplicateEvery = 50;
+    unsigned seed = 42;
+};
+
+/// \brief Writes a reproducible library of movies and TV shows to disk.
+///
+/// Movies are stored in separate folders with a Kodi v18 NFO file, a poster
+/// and a fanart stub. TV shows have a tvshow.nfo, a poster and one folder per
+/// season with an NFO file and a thumbnail stub for each episode. Video files
+/// are empty.
+///
+/// The same configuration always results in the same library, so results can
+/// be compared between commits. An existing library with the same configuration
+/// is reused instead of being generated again.
+///
+/// \par Example
+/// \code{cpp}
+///   SyntheticLibrary library(QDir("/tmp/library"), SyntheticLibraryConfig{});
+///   library.generate();
+///   QString movies = library.movieDir();
+/// \endcode
+class SyntheticLibrary
+{
+public:
+    SyntheticLibrary(QDir root, SyntheticLibraryConfig config);
+
+    /// \brief Writes the library unless it already exists. Returns false on errors.
+    bool generate();
+
+    const SyntheticLibraryConfig& config() const { return m_config; }
+    QString movieDir() const;
+    QString showDir() const;
+    /// \brief Absolute paths of all movie NFO files.
+    QStringList movieNfoFiles() const;
+    /// \brief Absolute paths of all episode NFO files.
+    QStringList episodeNfoFiles() const;
+
+    /// \brief Creates the movie with the given index, as it is stored on disk.
+    std::unique_ptr<Movie> createMovie(int index) const;
+    std::vector<std::unique_ptr<Movie>> createMovies(int count) const;
+    std::unique_ptr<TvShow> createShow(int index) const;
+    std::unique_ptr<TvShowEpisode> createEpisode(TvShow& show, int showIndex, int episodeIndex) const;
+
+private:
+    QString configString() const;
+    QString movieBaseName(int index) const;
+    QString showName(int index) const;
+    bool writeMovies();
+    bool writeShows();
+
+    QDir m_root;
+    SyntheticLibraryConfig m_config;
+};
@@ -0,0 +1,46 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "data/Database.h"
+#include "globals/Manager.h"
+#include "movies/Movie.h"
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <algorithm>
+
+using namespace mediaelch;
+
+TEST_CASE("Movie database round-trip", "[benchmark][database]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const auto movies = library.createMovies(std::min(5000, library.config().movies));
+    const DirectoryPath directory(library.movieDir());
+    Database* database = Manager::instance()->database();
+
+    const auto store = [&]() {
+        database->transaction();
+        database->clearMoviesInDirectory(directory);
+        for (const auto& movie : movies) {
+            database->add(movie.get(), directory);
+        }
+        database->commit();
+    };
+
+    BENCHMARK("Store movies")
+    {
+        store();
+        return movies.size();
+    };
+
+    BENCHMARK("Load movies")
+    {
+        QVector<Movie*> loaded = database->moviesInDirectory(directory);
+        const int count = loaded.count();
+        qDeleteAll(loaded);
+        return count;
+    };
+
+    QVector<Movie*> stored = database->moviesInDirectory(directory);
+    CHECK(stored.count() == static_cast<int>(movies.size()));
+    qDeleteAll(stored);
+    database->clearMoviesInDirectory(directory);
+}
@@ -0,0 +1,73 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "data/Database.h"
+#include "file/DirectoryListingCache.h"
+#include "globals/Manager.h"
+#include "movies/MovieModel.h"
+#include "movies/file_searcher/MovieFileSearcher.h"
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <QDirIterator>
+#include <QEventLoop>
+
+using namespace mediaelch;
+
+TEST_CASE("Scan movie directories", "[benchmark][scan]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+
+    BENCHMARK("Recursive directory listing")
+    {
+        int count = 0;
+        QDirIterator it(library.movieDir(), QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            it.next();
+            ++count;
+        }
+        return count;
+    };
+
+    BENCHMARK("DirectoryListingCache lookups")
+    {
+        const QStringList nfoFiles = library.movieNfoFiles();
+        DirectoryListingCache cache;
+        DirectoryListingCache::Scope scope(cache);
+        int found = 0;
+        for (const QString& nfo : nfoFiles) {
+            // Similar to the lookups of a file searcher for each movie.
+            found += DirectoryListingCache::isFile(nfo) ? 1 : 0;
+            found += DirectoryListingCache::isFile(nfo.left(nfo.size() - 4) + "-poster.jpg") ? 1 : 0;
+            found += DirectoryListingCache::isFile(nfo.left(nfo.size() - 4) + ".en.srt") ? 1 : 0;
+        }
+        return found;
+    };
+}
+
+TEST_CASE("Load movie library", "[benchmark][scan]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+
+    SettingsDir directory;
+    directory.path = QDir(library.movieDir());
+    directory.separateFolders = true;
+
+    MovieFileSearcher* searcher = Manager::instance()->movieFileSearcher();
+    searcher->setMovieDirectories({directory});
+
+    const auto reload = [searcher](bool force) {
+        QEventLoop loop;
+        QObject::connect(searcher, &MovieFileSearcher::moviesLoaded, &loop, &QEventLoop::quit);
+        searcher->reload(force);
+        loop.exec();
+        return Manager::instance()->movieModel()->movies().count();
+    };
+
+    BENCHMARK("Full reload from disk") { return reload(true); };
+
+    // The previous reload stored all movies in the database.
+    BENCHMARK("Reload from database") { return reload(false); };
+
+    CHECK(Manager::instance()->movieModel()->movies().count() == library.config().movies);
+    Manager::instance()->movieModel()->clear();
+    Manager::instance()->database()->clearAllMovies();
+}
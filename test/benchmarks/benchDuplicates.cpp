@@ -0,0 +1,26 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "movies/Movie.h"
+#include "movies/MovieDuplicateFinder.h"
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <algorithm>
+
+using namespace mediaelch;
+
+TEST_CASE("Movie duplicates", "[benchmark][duplicates]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const auto ownedMovies = library.createMovies(std::min(2000, library.config().movies));
+    QVector<Movie*> movies;
+    movies.reserve(static_cast<int>(ownedMovies.size()));
+    for (const auto& movie : ownedMovies) {
+        movies.append(movie.get());
+    }
+
+    // Same function as used by MovieDuplicates::detectDuplicates().
+    BENCHMARK("Detect duplicates")
+    {
+        return findMovieDuplicates(movies).size();
+    };
+}
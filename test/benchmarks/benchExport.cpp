@@ -0,0 +1,40 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "export/ExportTemplate.h"
+#include "export/SimpleEngine.h"
+#include "movies/Movie.h"
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <algorithm>
+#include <QTemporaryDir>
+#include <atomic>
+
+using namespace mediaelch;
+
+TEST_CASE("HTML export", "[benchmark][export]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const auto movies = library.createMovies(std::min(1000, library.config().movies));
+    QVector<Movie*> pointers;
+    for (const auto& movie : movies) {
+        pointers << movie.get();
+    }
+
+    ExportTemplate exportTemplate;
+    exportTemplate.setName("Benchmark Template");
+    exportTemplate.setTemplateEngine(ExportEngine::Simple);
+    exportTemplate.setRemote(false);
+    exportTemplate.setIdentifier("benchmark-template");
+    exportTemplate.setDirectory(resourceDir().filePath("export/simple"));
+
+    QTemporaryDir outputDir;
+    REQUIRE(outputDir.isValid());
+    std::atomic_bool cancelFlag{false};
+
+    BENCHMARK("Export movies")
+    {
+        SimpleEngine engine(exportTemplate, QDir(outputDir.path()), cancelFlag);
+        engine.exportMovies(pointers);
+        return pointers.size();
+    };
+}
@@ -0,0 +1,83 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "globals/Filter.h"
+#include "movies/Movie.h"
+#include "movies/MovieModel.h"
+#include "movies/MovieProxyModel.h"
+#include "test/benchmarks/benchmark_environment.h"
+
+using namespace mediaelch;
+
+namespace {
+
+QVector<Movie*> toPointers(const std::vector<std::unique_ptr<Movie>>& movies)
+{
+    QVector<Movie*> pointers;
+    pointers.reserve(static_cast<int>(movies.size()));
+    for (const auto& movie : movies) {
+        pointers << movie.get();
+    }
+    return pointers;
+}
+
+} // namespace
+
+TEST_CASE("Movie model", "[benchmark][model]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const auto movies = library.createMovies(library.config().movies);
+    const QVector<Movie*> pointers = toPointers(movies);
+
+    BENCHMARK("Add movies to model")
+    {
+        MovieModel model;
+        model.addMovies(pointers);
+        return model.rowCount();
+    };
+
+    MovieModel model;
+    model.addMovies(pointers);
+    MovieProxyModel proxy;
+    proxy.setSourceModel(&model);
+
+    BENCHMARK("Sort by name")
+    {
+        proxy.setSortBy(SortBy::Year);
+        proxy.setSortBy(SortBy::Name);
+        return proxy.rowCount();
+    };
+
+    BENCHMARK("Sort by year")
+    {
+        proxy.setSortBy(SortBy::Name);
+        proxy.setSortBy(SortBy::Year);
+        return proxy.rowCount();
+    };
+
+    // Same as MovieFilesWidget::setFilter()
+    const auto applyFilter = [&proxy](QVector<Filter*> filters, const QString& text) {
+        proxy.setFilter(filters, text);
+        proxy.setFilterWildcard("*" + text + "*");
+        return proxy.rowCount();
+    };
+
+    Filter genreFilter("Genre \"Drama\"", "Drama", {"Genre", "Drama"}, MovieFilters::Genres, true);
+    Filter titleFilter("Title", "star", QStringList(), MovieFilters::Title, true);
+
+    BENCHMARK("Filter by genre")
+    {
+        const int count = applyFilter({&genreFilter}, "");
+        applyFilter({}, "");
+        return count;
+    };
+
+    BENCHMARK("Filter by title")
+    {
+        const int count = applyFilter({&titleFilter}, "star");
+        applyFilter({}, "");
+        return count;
+    };
+
+    proxy.setSourceModel(nullptr);
+    model.clear();
+}
@@ -0,0 +1,105 @@
+#include "third_party/catch2/catch.hpp"
+
+#include "media_centers/kodi/EpisodeXmlReader.h"
+#include "media_centers/kodi/MovieXmlReader.h"
+#include "media_centers/kodi/v18/EpisodeXmlWriterV18.h"
+#include "media_centers/kodi/v18/MovieXmlWriterV18.h"
+#include "movies/Movie.h"
+#include "test/benchmarks/benchmark_environment.h"
+#include "tv_shows/TvShow.h"
+#include "tv_shows/TvShowEpisode.h"
+
+#include <algorithm>
+#include <QDomDocument>
+#include <QFile>
+
+using namespace mediaelch;
+
+namespace {
+
+/// Number of NFO files read or written per benchmark run.
+constexpr int nfoCount = 2000;
+
+QVector<QByteArray> readFiles(QStringList files)
+{
+    QVector<QByteArray> contents;
+    for (const QString& fileName : files.mid(0, nfoCount)) {
+        QFile file(fileName);
+        if (file.open(QIODevice::ReadOnly)) {
+            contents << file.readAll();
+        }
+    }
+    return contents;
+}
+
+} // namespace
+
+TEST_CASE("Movie NFO files", "[benchmark][nfo]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const QVector<QByteArray> contents = readFiles(library.movieNfoFiles());
+    REQUIRE(!contents.isEmpty());
+
+    BENCHMARK("Parse movie NFO files")
+    {
+        int actors = 0;
+        for (const QByteArray& content : contents) {
+            Movie movie;
+            QDomDocument domDoc;
+            domDoc.setContent(content);
+            kodi::MovieXmlReader(movie).parseNfoDom(domDoc);
+            actors += movie.actors().size();
+        }
+        return actors;
+    };
+
+    const auto movies = library.createMovies(std::min(nfoCount, library.config().movies));
+
+    BENCHMARK("Write movie NFO files")
+    {
+        int size = 0;
+        for (const auto& movie : movies) {
+            kodi::MovieXmlWriterV18 writer(*movie);
+            size += writer.getMovieXml().size();
+        }
+        return size;
+    };
+}
+
+TEST_CASE("Episode NFO files", "[benchmark][nfo]")
+{
+    const SyntheticLibrary& library = benchmarkLibrary();
+    const QVector<QByteArray> contents = readFiles(library.episodeNfoFiles());
+    REQUIRE(!contents.isEmpty());
+
+    TvShow show;
+
+    BENCHMARK("Parse episode NFO files")
+    {
+        int actors = 0;
+        for (const QByteArray& content : contents) {
+            TvShowEpisode episode({}, &show);
+            QDomDocument domDoc;
+            domDoc.setContent(content);
+            kodi::EpisodeXmlReader(episode).parseNfoDom(domDoc.elementsByTagName("episodedetails").at(0).toElement());
+            actors += episode.actors().size();
+        }
+        return actors;
+    };
+
+    std::vector<std::unique_ptr<TvShowEpisode>> episodes;
+    for (int i = 0; i < contents.size(); ++i) {
+        const int showIndex = i / library.config().episodesPerShow;
+        episodes.push_back(library.createEpisode(show, showIndex, i % library.config().episodesPerShow));
+    }
+
+    BENCHMARK("Write episode NFO files")
+    {
+        int size = 0;
+        for (const auto& episode : episodes) {
+            kodi::EpisodeXmlWriterV18 writer(QVector<TvShowEpisode*>{episode.get()});
+            size += writer.getEpisodeXml().size();
+        }
+        return size;
+    };
+}
@@ -0,0 +1,38 @@
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <memory>
+#include <stdexcept>
+
+static std::unique_ptr<SyntheticLibrary> s_library;
+static bool s_isGenerated = false;
+static QDir s_resourceDir;
+
+void setBenchmarkLibrary(QDir root, SyntheticLibraryConfig config)
+{
+    s_library = std::make_unique<SyntheticLibrary>(std::move(root), config);
+    s_isGenerated = false;
+}
+
+SyntheticLibrary& benchmarkLibrary()
+{
+    if (s_library == nullptr) {
+        throw std::runtime_error("No benchmark library was configured");
+    }
+    if (!s_isGenerated) {
+        if (!s_library->generate()) {
+            throw std::runtime_error("Could not generate the benchmark library");
+        }
+        s_isGenerated = true;
+    }
+    return *s_library;
+}
+
+QDir resourceDir()
+{
+    return s_resourceDir;
+}
+
+void setResourceDir(QDir dir)
+{
+    s_resourceDir = std::move(dir);
+}
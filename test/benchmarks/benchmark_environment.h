@@ -0,0 +1,14 @@
+#pragma once
+
+#include "test/benchmarks/SyntheticLibrary.h"
+
+#include <QDir>
+
+/// \brief Configures the library returned by benchmarkLibrary(). Called by main().
+void setBenchmarkLibrary(QDir root, SyntheticLibraryConfig config);
+/// \brief Returns the synthetic library. It is generated on first access.
+/// Throws if it could not be generated.
+SyntheticLibrary& benchmarkLibrary();
+
+QDir resourceDir();
+void setResourceDir(QDir dir);
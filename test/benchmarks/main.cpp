@@ -0,0 +1,64 @@
+#define CATCH_CONFIG_RUNNER
+#include "third_party/catch2/catch.hpp"
+
+#include "test/benchmarks/benchmark_environment.h"
+
+#include <QApplication>
+#include <QDir>
+#include <QStandardPaths>
+#include <QtGlobal>
+
+int main(int argc, char** argv)
+{
+    // Same as for integration tests: get a deterministic XML output.
+    qSetGlobalQHashSeed(0);
+    // The database and settings must not touch the user's data.
+    QStandardPaths::setTestModeEnabled(true);
+
+    QApplication app(argc, argv);
+    Catch::Session session; // NOLINT(clang-analyzer-core.uninitialized.UndefReturn)
+
+    std::string libraryDirString;
+    std::string resourceDirString;
+    SyntheticLibraryConfig config;
+
+    using namespace Catch::clara;
+    auto cli = session.cli()
+               | Opt(libraryDirString, "directory")["--library-dir"](
+                   "Directory of the synthetic library. It is generated if it does not exist.")
+               | Opt(resourceDirString, "directory")["-w"]["--resource-dir"](
+                   "The test resource directory which contains export templates.")
+               | Opt(config.movies, "count")["--movies"]("Number of movies in the synthetic library.")
+               | Opt(config.shows, "count")["--shows"]("Number of TV shows in the synthetic library.")
+               | Opt(config.episodesPerShow, "count")["--episodes-per-show"]("Number of episodes per TV show.");
+
+    session.cli(cli);
+
+    const int returnCode = session.applyCommandLine(argc, argv);
+    if (returnCode != 0) {
+        return returnCode;
+    }
+
+    if (session.config().listTests() || session.config().listTestNamesOnly() || session.config().listTags()
+        || session.config().listReporters()) {
+        return session.run();
+    }
+
+    if (libraryDirString.empty()) {
+        std::cerr << "Missing library directory argument!" << std::endl;
+        return 1;
+    }
+    if (resourceDirString.empty() || !QDir(resourceDirString.c_str()).exists()) {
+        std::cerr << "Missing or invalid resource directory argument!" << std::endl;
+        return 1;
+    }
+    if (config.movies < 1 || config.shows < 1 || config.episodesPerShow < 1) {
+        std::cerr << "The library must contain at least one movie, TV show and episode!" << std::endl;
+        return 1;
+    }
+
+    setBenchmarkLibrary(QDir(libraryDirString.c_str()), config);
+    setResourceDir(QDir(resourceDirString.c_str()));
+
+    return session.run();
+}
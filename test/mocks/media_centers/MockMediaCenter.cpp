@@ -0,0 +1,39 @@
+#include "test/mocks/media_centers/MockMediaCenter.h"
+
+#include "movies/Movie.h"
+
+#include <algorithm>
+
+bool MockMediaCenter::saveMovie(Movie* movie)
+{
+    const QByteArray nfoContent = movieNfoContent(movie);
+    const mediaelch::FileWriteBatch batch = movieFileWrites(movie, nfoContent);
+    return finishMovieSave(movie, batch, batch.execute());
+}
+
+QByteArray MockMediaCenter::movieNfoContent(Movie* movie)
+{
+    return movie->name().toUtf8();
+}
+
+mediaelch::FileWriteBatch MockMediaCenter::movieFileWrites(Movie* movie, const QByteArray& nfoContent)
+{
+    mediaelch::FileWriteBatch batch;
+    batch.writeTextFile(nfoFilePath(movie), nfoContent);
+    return batch;
+}
+
+bool MockMediaCenter::finishMovieSave(Movie* movie,
+    const mediaelch::FileWriteBatch& batch,
+    const QVector<mediaelch::FileWriteBatch::Result>& results)
+{
+    Q_UNUSED(batch);
+    finishedMovies.append(movie->name());
+    return !failingMovies.contains(movie->name())
+           && std::all_of(results.cbegin(), results.cend(), &mediaelch::FileWriteBatch::succeeded);
+}
+
+QString MockMediaCenter::nfoFilePath(Movie* movie)
+{
+    return directory + "/" + movie->name() + ".nfo";
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "media_centers/MediaCenterInterface.h"
+
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+/// \brief Media center that saves movies as "<directory>/<movie name>.nfo" and nothing else.
+class MockMediaCenter : public MediaCenterInterface
+{
+public:
+    /// Directory for NFO files.
+    QString directory;
+    /// Names of movies whose save fails in finishMovieSave().
+    QSet<QString> failingMovies;
+    /// Names of movies in the order finishMovieSave() was called.
+    QStringList finishedMovies;
+
+    bool hasFeature(MediaCenterFeature) override { return false; }
+
+    bool saveMovie(Movie* movie) override;
+    bool loadMovie(Movie*, QString) override { return false; }
+    QByteArray movieNfoContent(Movie* movie) override;
+    mediaelch::FileWriteBatch movieFileWrites(Movie* movie, const QByteArray& nfoContent) override;
+    bool finishMovieSave(Movie* movie,
+        const mediaelch::FileWriteBatch& batch,
+        const QVector<mediaelch::FileWriteBatch::Result>& results) override;
+    QImage movieSetPoster(QString) override { return {}; }
+    QImage movieSetBackdrop(QString) override { return {}; }
+    void saveMovieSetPoster(QString, QImage) override {}
+    void saveMovieSetBackdrop(QString, QImage) override {}
+
+    bool saveConcert(Concert*) override { return false; }
+    bool loadConcert(Concert*, QString) override { return false; }
+
+    bool loadTvShow(TvShow*, QString) override { return false; }
+    bool loadTvShowEpisode(TvShowEpisode*, QString) override { return false; }
+    bool saveTvShow(TvShow*) override { return false; }
+    bool saveTvShowEpisode(TvShowEpisode*) override { return false; }
+
+    QStringList extraFanartNames(Movie*) override { return {}; }
+    QStringList extraFanartNames(TvShow*) override { return {}; }
+    QStringList extraFanartNames(Concert*) override { return {}; }
+    QStringList extraFanartNames(Artist*) override { return {}; }
+
+    bool saveArtist(Artist*) override { return false; }
+    bool saveAlbum(Album*) override { return false; }
+    bool loadArtist(Artist*, QString) override { return false; }
+    bool loadAlbum(Album*, QString) override { return false; }
+
+    QString actorImageName(Movie*, Actor) override { return {}; }
+    QString actorImageName(TvShow*, Actor) override { return {}; }
+    QString actorImageName(TvShowEpisode*, Actor) override { return {}; }
+
+    QString nfoFilePath(Movie* movie) override;
+    QString nfoFilePath(Concert*) override { return {}; }
+    QString nfoFilePath(TvShowEpisode*) override { return {}; }
+    QString nfoFilePath(TvShow*) override { return {}; }
+    QString nfoFilePath(Artist*) override { return {}; }
+    QString nfoFilePath(Album*) override { return {}; }
+
+    // clang-format off
+    QString imageFileName(const Movie*,         ImageType, QVector<DataFile>, bool) override { return {}; }
+    QString imageFileName(const Concert*,       ImageType, QVector<DataFile>, bool) override { return {}; }
+    QString imageFileName(const TvShowEpisode*, ImageType, QVector<DataFile>, bool) override { return {}; }
+    QString imageFileName(const Artist*,        ImageType, QVector<DataFile>, bool) override { return {}; }
+    QString imageFileName(const Album*,         ImageType, QVector<DataFile>, bool) override { return {}; }
+    QString imageFileName(const TvShow*,        ImageType, SeasonNumber, QVector<DataFile>, bool) override { return {}; }
+    // clang-format on
+
+    void loadBooklets(Album*) override {}
+};
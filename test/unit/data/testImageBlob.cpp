@@ -0,0 +1,61 @@
+#include "test/test_helpers.h"
+
+#include "data/ImageBlob.h"
+
+using namespace mediaelch;
+
+TEST_CASE("ImageBlob stores image data", "[data][image]")
+{
+    SECTION("null data results in a null blob")
+    {
+        ImageBlob blob{QByteArray()};
+        CHECK(blob.isNull());
+        CHECK(blob.size() == 0);
+        CHECK(blob.data().isNull());
+        CHECK(ImageBlob().isNull());
+    }
+
+    SECTION("empty data is not null")
+    {
+        ImageBlob blob{QByteArray("")};
+        CHECK_FALSE(blob.isNull());
+        CHECK(blob.data().isEmpty());
+        CHECK_FALSE(blob.data().isNull());
+    }
+
+    SECTION("data can be read again")
+    {
+        const QByteArray data("\xFF\xD8\xFF\xE0 some JPEG data \x00\x01", 25);
+        ImageBlob blob(data);
+        CHECK_FALSE(blob.isNull());
+        CHECK(blob.size() == data.size());
+        CHECK(blob.hash() == ImageBlob::hashOf(data));
+        CHECK(blob.data() == data);
+        CHECK(blob.hasSameData(data));
+        CHECK_FALSE(blob.hasSameData("other data"));
+        CHECK_FALSE(ImageBlob().hasSameData(QByteArray()));
+    }
+
+    SECTION("identical data is stored once")
+    {
+        const int countBefore = ImageBlob::storedCount();
+        {
+            ImageBlob first(QByteArray("poster"));
+            ImageBlob second(QByteArray("poster"));
+            ImageBlob other(QByteArray("fanart"));
+            CHECK(first == second);
+            CHECK(first != other);
+            CHECK(ImageBlob::storedCount() == countBefore + 2);
+
+            ImageBlob copy = other;
+            other = ImageBlob();
+            CHECK(copy.data() == "fanart");
+            CHECK(ImageBlob::storedCount() == countBefore + 2);
+        }
+        CHECK(ImageBlob::storedCount() == countBefore);
+
+        // Storing the same data again after it was released works.
+        ImageBlob again(QByteArray("poster"));
+        CHECK(again.data() == "poster");
+    }
+}
@@ -0,0 +1,145 @@
+#include "test/test_helpers.h"
+
+#include "data/LibrarySearchIndex.h"
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+#include <algorithm>
+
+using namespace mediaelch;
+
+TEST_CASE("LibrarySearchIndex match expression", "[data][search]")
+{
+    CHECK(LibrarySearchIndex::matchExpression("").isEmpty());
+    CHECK(LibrarySearchIndex::matchExpression(" - ").isEmpty());
+    CHECK(LibrarySearchIndex::matchExpression("star") == R"("star"*)");
+    CHECK(LibrarySearchIndex::matchExpression("Star  Wa") == R"("Star"* "Wa"*)");
+    // Query syntax is not interpreted
+    CHECK(LibrarySearchIndex::matchExpression(R"(a" OR b*)") == R"("a"* "OR"* "b"*)");
+    CHECK(LibrarySearchIndex::matchExpression("Amélie") == R"("Amélie"*)");
+}
+
+TEST_CASE("LibrarySearchIndex finds documents", "[data][search]")
+{
+    using MediaType = LibrarySearchIndex::MediaType;
+    using Columns = LibrarySearchIndex::Columns;
+    const auto sorted = [](QVector<int> ids) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "testLibrarySearchIndex");
+        db.setDatabaseName(":memory:");
+        REQUIRE(db.open());
+
+        LibrarySearchIndex index(db);
+        if (!index.create()) {
+            WARN("SQLite was built without FTS5");
+            db.close();
+        } else {
+            LibrarySearchIndex::Document starWars;
+            starWars.title = "Star Wars";
+            starWars.paths = QStringList{"/movies/Star Wars (1977)/Star.Wars.mkv"};
+
+            LibrarySearchIndex::Document amelie;
+            amelie.title = "Die fabelhafte Welt der Amélie";
+            amelie.originalTitle = "Le fabuleux destin d'Amélie Poulain";
+            amelie.paths = QStringList{"/movies/Amelie/Amelie.cd1.mkv", "/movies/Amelie/Amelie.cd2.mkv"};
+
+            index.index(MediaType::Movie, 1, starWars);
+            index.index(MediaType::Movie, 2, amelie);
+            index.index(MediaType::Concert, 1, amelie);
+
+            CHECK(index.search(MediaType::Movie, "star", Columns::Titles) == QVector<int>{1});
+            CHECK(index.search(MediaType::Movie, "amelie poul", Columns::Titles) == QVector<int>{2});
+            CHECK(index.search(MediaType::Movie, "poulain", Columns::Titles) == QVector<int>{2});
+            CHECK(index.search(MediaType::Movie, "star trek", Columns::Titles).isEmpty());
+            CHECK(index.search(MediaType::Movie, "1977", Columns::Titles).isEmpty());
+            CHECK(index.search(MediaType::TvShow, "star", Columns::Titles).isEmpty());
+
+            CHECK(index.search(MediaType::Movie, "1977", Columns::Paths) == QVector<int>{1});
+            CHECK(index.search(MediaType::Movie, "cd2", Columns::Paths) == QVector<int>{2});
+            CHECK(sorted(index.search(MediaType::Movie, "movies", Columns::Paths)) == QVector<int>({1, 2}));
+            CHECK(index.search(MediaType::Movie, "poulain", Columns::Paths).isEmpty());
+
+            // Indexing again replaces the document
+            starWars.title = "Star Wars: Episode IV";
+            starWars.paths.clear();
+            index.index(MediaType::Movie, 1, starWars);
+            CHECK(index.search(MediaType::Movie, "episode", Columns::Titles) == QVector<int>{1});
+            CHECK(index.search(MediaType::Movie, "1977", Columns::Paths).isEmpty());
+
+            index.remove(MediaType::Movie, 1);
+            CHECK(index.search(MediaType::Movie, "star", Columns::Titles).isEmpty());
+            CHECK(index.search(MediaType::Concert, "amelie", Columns::Titles) == QVector<int>{1});
+
+            index.clear(MediaType::Movie);
+            CHECK(index.search(MediaType::Movie, "amelie", Columns::Titles).isEmpty());
+            db.close();
+        }
+    }
+    QSqlDatabase::removeDatabase("testLibrarySearchIndex");
+}
+
+TEST_CASE("LibrarySearchIndex indexes cached items", "[data][search]")
+{
+    using MediaType = LibrarySearchIndex::MediaType;
+    using Columns = LibrarySearchIndex::Columns;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "testLibrarySearchIndexCache");
+        db.setDatabaseName(":memory:");
+        REQUIRE(db.open());
+
+        LibrarySearchIndex index(db);
+        if (!index.create()) {
+            WARN("SQLite was built without FTS5");
+            db.close();
+        } else {
+            // Only the columns of the cache tables that are indexed
+            QSqlQuery query(db);
+            REQUIRE(query.exec("CREATE TABLE movies (idMovie integer PRIMARY KEY, content text)"));
+            REQUIRE(query.exec("CREATE TABLE movieFiles (idFile integer PRIMARY KEY, idMovie integer, file text)"));
+            REQUIRE(query.exec("CREATE TABLE concerts (idConcert integer PRIMARY KEY, content text)"));
+            REQUIRE(query.exec("CREATE TABLE concertFiles (idFile integer PRIMARY KEY, idConcert integer, file text)"));
+            REQUIRE(query.exec("CREATE TABLE shows (idShow integer PRIMARY KEY, dir text, content text)"));
+
+            const auto insert = [&query](const QString& statement, const QVariantList& values) {
+                query.prepare(statement);
+                for (const QVariant& value : values) {
+                    query.addBindValue(value);
+                }
+                return query.exec();
+            };
+            // The cache stores the content and the files as UTF-8 blobs.
+            REQUIRE(insert("INSERT INTO movies VALUES(?, ?)",
+                {1,
+                    QString("<movie><title>Star Wars</title><originaltitle>Krieg der Sterne</originaltitle></movie>")
+                        .toUtf8()}));
+            REQUIRE(insert("INSERT INTO movies VALUES(?, ?)", {2, QByteArray("")}));
+            const QString insertFile = "INSERT INTO movieFiles(idMovie, file) VALUES(?, ?)";
+            REQUIRE(insert(insertFile, {1, QByteArray("/movies/Star.Wars.mkv")}));
+            REQUIRE(insert(insertFile, {2, QByteArray("/movies/Amelie.mkv")}));
+            REQUIRE(insert("INSERT INTO concerts VALUES(?, ?)",
+                {3, QString("<musicvideo><title>Live</title><artist>Queen</artist></musicvideo>").toUtf8()}));
+            REQUIRE(insert("INSERT INTO shows VALUES(?, ?, ?)",
+                {4, QByteArray("/shows/Firefly"), QString("<tvshow><title>Firefly</title></tvshow>").toUtf8()}));
+
+            index.indexCachedItems();
+
+            CHECK(index.search(MediaType::Movie, "sterne", Columns::Titles) == QVector<int>{1});
+            CHECK(index.search(MediaType::Movie, "wars", Columns::Paths) == QVector<int>{1});
+            // Items without NFO content are found by their paths.
+            CHECK(index.search(MediaType::Movie, "amelie", Columns::Titles) == QVector<int>{2});
+            CHECK(index.search(MediaType::Concert, "queen", Columns::Titles) == QVector<int>{3});
+            CHECK(index.search(MediaType::TvShow, "firefly", Columns::Titles) == QVector<int>{4});
+            CHECK(index.search(MediaType::TvShow, "shows", Columns::Paths) == QVector<int>{4});
+
+            // Indexing again doesn't duplicate items
+            index.indexCachedItems();
+            CHECK(index.search(MediaType::Movie, "star", Columns::Titles) == QVector<int>{1});
+            db.close();
+        }
+    }
+    QSqlDatabase::removeDatabase("testLibrarySearchIndexCache");
+}
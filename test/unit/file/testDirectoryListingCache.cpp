@@ -0,0 +1,47 @@
+#include "test/test_helpers.h"
+
+#include "file/DirectoryListingCache.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+static void createFile(const QString& path)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::WriteOnly));
+    file.write("test");
+}
+
+TEST_CASE("DirectoryListingCache lists a directory once", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    createFile(dir.filePath("movie.mkv"));
+    createFile(dir.filePath("movie.nfo"));
+
+    DirectoryListingCache cache;
+    CHECK(cache.containsFile(dir.filePath("movie.nfo")));
+    CHECK_FALSE(cache.containsFile(dir.filePath("poster.jpg")));
+
+    SECTION("listing is not updated after the first access")
+    {
+        createFile(dir.filePath("poster.jpg"));
+        CHECK_FALSE(cache.containsFile(dir.filePath("poster.jpg")));
+        CHECK(cache.listing(dir.path()).files == QStringList({"movie.mkv", "movie.nfo"}));
+    }
+
+    SECTION("isFile() uses the active cache of the current thread")
+    {
+        createFile(dir.filePath("poster.jpg"));
+        CHECK(DirectoryListingCache::current() == nullptr);
+        CHECK(DirectoryListingCache::isFile(dir.filePath("poster.jpg")));
+        {
+            DirectoryListingCache::Scope scope(cache);
+            CHECK(DirectoryListingCache::current() == &cache);
+            CHECK_FALSE(DirectoryListingCache::isFile(dir.filePath("poster.jpg")));
+        }
+        CHECK(DirectoryListingCache::current() == nullptr);
+    }
+}
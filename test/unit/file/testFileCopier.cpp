@@ -0,0 +1,62 @@
+#include "test/test_helpers.h"
+
+#include "file/FileCopier.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+static void writeFile(const QString& path, const QByteArray& data)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::WriteOnly));
+    REQUIRE(file.write(data) == data.size());
+}
+
+TEST_CASE("FileCopier copies files", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString source = dir.filePath("movie.mkv");
+    const QString target = dir.filePath("copy.mkv");
+
+    // Larger than the buffer of the fallback implementation
+    QByteArray data(5 * 1024 * 1024 + 123, Qt::Uninitialized);
+    for (int i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    writeFile(source, data);
+
+    SECTION("content and progress are complete")
+    {
+        qint64 progress = 0;
+        FileCopier::Options options;
+        options.verify = true;
+        options.progress = [&progress](qint64 bytes) { progress += bytes; };
+
+        REQUIRE(FileCopier::copy(source, target, options));
+        CHECK(progress == data.size());
+        CHECK(FileCopier::checksum(target) == FileCopier::checksum(source));
+        CHECK(QFile::exists(source));
+    }
+
+    SECTION("existing files are not overwritten")
+    {
+        writeFile(target, "existing");
+        CHECK_FALSE(FileCopier::copy(source, target));
+        CHECK(QFileInfo(target).size() == 8);
+    }
+
+    SECTION("missing source files don't leave empty target files")
+    {
+        CHECK_FALSE(FileCopier::copy(dir.filePath("missing.mkv"), target));
+        CHECK_FALSE(QFile::exists(target));
+    }
+
+    SECTION("paths in the same directory are on the same device")
+    {
+        CHECK(FileCopier::device(source) == FileCopier::device(dir.filePath("not/yet/created.mkv")));
+    }
+}
@@ -0,0 +1,110 @@
+#include "test/test_helpers.h"
+
+#include "file/FileNameMatcher.h"
+
+using namespace mediaelch;
+using Rule = FileNameMatcher::Rule;
+
+TEST_CASE("FileNameMatcher", "[file]")
+{
+    SECTION("empty matcher matches nothing")
+    {
+        FileNameMatcher matcher;
+        matcher.compile();
+        CHECK_FALSE(matcher.matchFile("Movie.mkv").hasMatch());
+        CHECK_FALSE(matcher.matchFolder("extras").hasMatch());
+    }
+
+    SECTION("merged file rules report rule and index")
+    {
+        FileNameMatcher matcher;
+        matcher.addFilePattern(QRegularExpression("^\\."));
+        matcher.addFilePattern(QRegularExpression("\\.part$"));
+        matcher.addFileKeywords(Rule::MovieExtra, {"-trailer", "-sample"});
+        matcher.compile();
+
+        FileNameMatcher::Match match = matcher.matchFile(".hidden.mkv");
+        CHECK(match.rule == Rule::ExcludedFile);
+        CHECK(match.index == 0);
+
+        match = matcher.matchFile("Movie.mkv.part");
+        CHECK(match.rule == Rule::ExcludedFile);
+        CHECK(match.index == 1);
+
+        match = matcher.matchFile("Movie-Sample.mkv");
+        CHECK(match.rule == Rule::MovieExtra);
+        CHECK(match.index == 1);
+
+        CHECK(matcher.matchFile("Movie-TRAILER.mkv").rule == Rule::MovieExtra);
+        CHECK_FALSE(matcher.matchFile("Movie.mkv").hasMatch());
+        // Keywords are not interpreted as regular expressions
+        CHECK_FALSE(matcher.matchFile("Movie_trailer.mkv").hasMatch());
+    }
+
+    SECTION("case-sensitive patterns stay case-sensitive when merged")
+    {
+        FileNameMatcher matcher;
+        matcher.addFilePattern(QRegularExpression("SAMPLE"));
+        matcher.addFileKeywords(Rule::MovieExtra, {"-trailer"});
+        matcher.compile();
+
+        CHECK(matcher.matchFile("Movie.SAMPLE.mkv").rule == Rule::ExcludedFile);
+        CHECK_FALSE(matcher.matchFile("Movie.sample.mkv").hasMatch());
+        CHECK(matcher.matchFile("Movie-Trailer.mkv").rule == Rule::MovieExtra);
+    }
+
+    SECTION("capture groups inside patterns don't shift later rules")
+    {
+        FileNameMatcher matcher;
+        matcher.addFilePattern(QRegularExpression("^(a)(b)(c)$"));
+        matcher.addFilePattern(QRegularExpression("^(?:x|(y))z$"));
+        matcher.addFileKeywords(Rule::MovieExtra, {"-short"});
+        matcher.compile();
+
+        CHECK(matcher.matchFile("abc").index == 0);
+        CHECK(matcher.matchFile("xz").index == 1);
+        CHECK(matcher.matchFile("yz").index == 1);
+        CHECK(matcher.matchFile("Movie-Short.mkv").rule == Rule::MovieExtra);
+    }
+
+    SECTION("patterns with backreferences are matched one by one")
+    {
+        FileNameMatcher matcher;
+        matcher.addFilePattern(QRegularExpression("^(\\w)\\1"));
+        matcher.addFileKeywords(Rule::MovieExtra, {"-trailer"});
+        matcher.compile();
+
+        CHECK(matcher.matchFile("aabc.mkv").rule == Rule::ExcludedFile);
+        CHECK_FALSE(matcher.matchFile("abc.mkv").hasMatch());
+        CHECK(matcher.matchFile("abc-trailer.mkv").rule == Rule::MovieExtra);
+    }
+
+    SECTION("folder names are case-insensitive and checked before patterns")
+    {
+        FileNameMatcher matcher;
+        matcher.addFolderPattern(QRegularExpression("^extra"));
+        matcher.addFolderNames(Rule::SkippedFolder, {".actors", "extras"});
+        matcher.compile();
+
+        FileNameMatcher::Match match = matcher.matchFolder("Extras");
+        CHECK(match.rule == Rule::SkippedFolder);
+        CHECK(match.index == 1);
+        CHECK(matcher.matchFolder(".ACTORS").rule == Rule::SkippedFolder);
+        CHECK(matcher.matchFolder("extrafanart").rule == Rule::ExcludedFolder);
+        CHECK_FALSE(matcher.matchFolder("Movie (2020)").hasMatch());
+        // Folder rules don't apply to files and vice versa
+        CHECK_FALSE(matcher.matchFile("extras").hasMatch());
+    }
+
+    SECTION("folder keywords match anywhere in folder names")
+    {
+        FileNameMatcher matcher;
+        matcher.addFolderNames(Rule::SkippedFolder, {"extras"});
+        matcher.addFolderKeywords(Rule::MovieExtra, {"-trailer"});
+        matcher.compile();
+
+        CHECK(matcher.matchFolder("Movie-Trailer").rule == Rule::MovieExtra);
+        CHECK(matcher.matchFolder("Extras").rule == Rule::SkippedFolder);
+        CHECK_FALSE(matcher.matchFile("Movie-trailer.mkv").hasMatch());
+    }
+}
@@ -0,0 +1,95 @@
+#include "test/test_helpers.h"
+
+#include "file/FileWriteBatch.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QFuture>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+static QByteArray readFile(const QString& path)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::ReadOnly));
+    return file.readAll();
+}
+
+TEST_CASE("FileWriteBatch writes files only if their content changed", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString nfo = dir.filePath("Alien/movie.nfo");
+
+    SECTION("new files and directories are created")
+    {
+        CHECK(FileWriteBatch::writeIfChanged(nfo, "<movie/>") == FileWriteBatch::Result::Written);
+        CHECK(readFile(nfo) == "<movie/>");
+    }
+
+    SECTION("identical content is not written again")
+    {
+        REQUIRE(FileWriteBatch::writeIfChanged(nfo, "<movie/>") == FileWriteBatch::Result::Written);
+        CHECK(FileWriteBatch::writeIfChanged(nfo, "<movie/>") == FileWriteBatch::Result::Unchanged);
+    }
+
+    SECTION("files that were not written by us are compared by content")
+    {
+        {
+            QFile file(dir.filePath("poster.jpg"));
+            REQUIRE(file.open(QIODevice::WriteOnly));
+            file.write("image");
+        }
+        CHECK(FileWriteBatch::writeIfChanged(dir.filePath("poster.jpg"), "image")
+              == FileWriteBatch::Result::Unchanged);
+        CHECK(FileWriteBatch::writeIfChanged(dir.filePath("poster.jpg"), "other")
+              == FileWriteBatch::Result::Written);
+        CHECK(readFile(dir.filePath("poster.jpg")) == "other");
+    }
+}
+
+TEST_CASE("FileWriteBatch executes operations in order", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString fanart1 = dir.filePath("extrafanart/fanart1.jpg");
+    const QString fanart2 = dir.filePath("extrafanart/fanart2.jpg");
+    REQUIRE(FileWriteBatch::writeIfChanged(fanart1, "old") == FileWriteBatch::Result::Written);
+
+    FileWriteBatch batch;
+    CHECK_FALSE(batch.isPathFree(fanart1));
+    const int remove = batch.removeFile(fanart1);
+    CHECK(batch.isPathFree(fanart1));
+    const int write = batch.writeFile(fanart2, "new");
+    CHECK_FALSE(batch.isPathFree(fanart2));
+    const int removeMissing = batch.removeFile(dir.filePath("missing.jpg"));
+
+    const auto results = batch.executeAsync().result();
+    REQUIRE(results.size() == 3);
+    CHECK(results[remove] == FileWriteBatch::Result::Removed);
+    CHECK(results[write] == FileWriteBatch::Result::Written);
+    CHECK(results[removeMissing] == FileWriteBatch::Result::Unchanged);
+    CHECK_FALSE(QFileInfo::exists(fanart1));
+    CHECK(readFile(fanart2) == "new");
+}
+
+TEST_CASE("FileWriteBatch executes batches for the same file in order", "[file]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString nfo = dir.filePath("movie.nfo");
+
+    QVector<QFuture<QVector<FileWriteBatch::Result>>> futures;
+    for (int i = 0; i < 100; ++i) {
+        FileWriteBatch batch;
+        batch.writeFile(nfo, QByteArray::number(i));
+        futures.append(batch.executeAsync());
+    }
+    futures.last().waitForFinished();
+    for (const auto& future : futures) {
+        // Executed one after another, so all earlier batches are done, too.
+        CHECK(future.isFinished());
+    }
+    CHECK(readFile(nfo) == "99");
+}
@@ -0,0 +1,83 @@
+#include "test/test_helpers.h"
+
+#include "file/InotifyWatcher.h"
+
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTimer>
+
+using namespace mediaelch;
+using namespace std::chrono_literals;
+
+/// Waits until the watcher reports changes or the timeout elapsed.
+static QStringList waitForChanges(InotifyWatcher& watcher, int timeoutMs = 5000)
+{
+    QStringList changed;
+    QEventLoop loop;
+    QObject::connect(&watcher, &InotifyWatcher::sigDirectoriesChanged, &loop, [&](QStringList directories) {
+        changed = directories;
+        loop.quit();
+    });
+    QTimer::singleShot(timeoutMs, &loop, &QEventLoop::quit);
+    loop.exec();
+    return changed;
+}
+
+TEST_CASE("InotifyWatcher reports changed directories", "[file]")
+{
+    if (!InotifyWatcher::isSupported()) {
+        return;
+    }
+
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString root = QDir(dir.path()).absolutePath();
+    REQUIRE(QDir(root).mkpath("Movie A"));
+
+    InotifyWatcher watcher;
+    watcher.setDebounceInterval(50ms);
+    REQUIRE(watcher.watchTree(root));
+    CHECK(watcher.watchCount() == 2);
+
+    SECTION("new file in subdirectory")
+    {
+        QFile file(root + "/Movie A/Movie A.mkv");
+        REQUIRE(file.open(QIODevice::WriteOnly));
+        file.close();
+        CHECK(waitForChanges(watcher) == QStringList{root + "/Movie A"});
+    }
+
+    SECTION("files are reported once they are closed")
+    {
+        QFile file(root + "/Movie A/Movie A.mkv");
+        REQUIRE(file.open(QIODevice::WriteOnly));
+        REQUIRE(file.write("data") == 4);
+        REQUIRE(file.flush());
+        CHECK(waitForChanges(watcher, 500).isEmpty());
+        file.close();
+        CHECK(waitForChanges(watcher) == QStringList{root + "/Movie A"});
+    }
+
+    SECTION("new directories are watched")
+    {
+        REQUIRE(QDir(root).mkpath("Movie B"));
+        CHECK(waitForChanges(watcher) == (QStringList{root, root + "/Movie B"}));
+        CHECK(watcher.watchCount() == 3);
+
+        QFile file(root + "/Movie B/Movie B.mkv");
+        REQUIRE(file.open(QIODevice::WriteOnly));
+        file.close();
+        CHECK(waitForChanges(watcher) == QStringList{root + "/Movie B"});
+    }
+
+    SECTION("removed directories are reported")
+    {
+        REQUIRE(QDir(root + "/Movie A").removeRecursively());
+        const QStringList changed = waitForChanges(watcher);
+        CHECK(changed.contains(root));
+        CHECK(changed.contains(root + "/Movie A"));
+        CHECK(watcher.watchCount() == 1);
+    }
+}
@@ -0,0 +1,35 @@
+#include "test/test_helpers.h"
+
+#include "globals/StringPool.h"
+
+using namespace mediaelch;
+
+TEST_CASE("StringPool interns strings", "[globals][StringPool]")
+{
+    SECTION("equal strings share their data")
+    {
+        const QString first = StringPool::intern(QStringLiteral("Science") + QStringLiteral(" Fiction"));
+        const QString second = StringPool::intern(QString("Science Fiction"));
+        CHECK(first == "Science Fiction");
+        CHECK(first.constData() == second.constData());
+    }
+
+    SECTION("lists are interned element-wise")
+    {
+        const QStringList genres = StringPool::intern(QStringList{"Drama", "", "Comedy"});
+        REQUIRE(genres.size() == 3);
+        CHECK(genres[0].constData() == StringPool::intern("Drama").constData());
+        CHECK(genres[1].isEmpty());
+        CHECK(genres[2] == "Comedy");
+    }
+
+    SECTION("each distinct string is stored once")
+    {
+        const int sizeBefore = StringPool::size();
+        StringPool::intern("StringPool test studio");
+        CHECK(StringPool::size() == sizeBefore + 1);
+        StringPool::intern(QString("StringPool test studio"));
+        StringPool::intern("");
+        CHECK(StringPool::size() == sizeBefore + 1);
+    }
+}
@@ -0,0 +1,131 @@
+#include "test/test_helpers.h"
+
+#include "imports/ExtractionQueue.h"
+
+using namespace mediaelch;
+
+static ExtractionQueue::Job job(const QString& name, const QString& device, int priority = 0, qint64 size = 100)
+{
+    ExtractionQueue::Job job;
+    job.name = name;
+    job.device = device;
+    job.priority = priority;
+    job.size = size;
+    return job;
+}
+
+static QStringList names(const QVector<ExtractionQueue::Job>& jobs)
+{
+    QStringList list;
+    for (const auto& job : jobs) {
+        list << job.name;
+    }
+    return list;
+}
+
+TEST_CASE("ExtractionQueue runs one job per device", "[imports]")
+{
+    ExtractionQueue queue(3);
+    REQUIRE(queue.add(job("a1", "disk-a")));
+    REQUIRE(queue.add(job("a2", "disk-a")));
+    REQUIRE(queue.add(job("b1", "disk-b")));
+
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"a1", "b1"}));
+    CHECK(queue.isPending("a2"));
+    CHECK(queue.takeStartableJobs().isEmpty());
+
+    queue.finish("a1");
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"a2"}));
+}
+
+TEST_CASE("ExtractionQueue limits parallel jobs", "[imports]")
+{
+    ExtractionQueue queue(2);
+    queue.add(job("a", "disk-a"));
+    queue.add(job("b", "disk-b"));
+    queue.add(job("c", "disk-c"));
+
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"a", "b"}));
+    queue.finish("b");
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"c"}));
+}
+
+TEST_CASE("ExtractionQueue starts jobs in the order they were added", "[imports]")
+{
+    ExtractionQueue queue(1);
+    queue.add(job("c", "disk-c"));
+    queue.add(job("a", "disk-a"));
+    queue.add(job("d", "disk-d"));
+    queue.add(job("b", "disk-b"));
+
+    QStringList order;
+    while (!queue.isIdle()) {
+        const auto jobs = queue.takeStartableJobs();
+        REQUIRE(jobs.size() == 1);
+        order << jobs.first().name;
+        queue.finish(jobs.first().name);
+    }
+    CHECK(order == QStringList({"c", "a", "d", "b"}));
+}
+
+TEST_CASE("ExtractionQueue starts jobs by priority", "[imports]")
+{
+    ExtractionQueue queue(1);
+    queue.add(job("low", "disk-a"));
+    queue.add(job("low2", "disk-b"));
+    queue.add(job("high", "disk-c", 10));
+    queue.add(job("high2", "disk-d", 10));
+
+    QStringList order;
+    while (!queue.isIdle()) {
+        const auto jobs = queue.takeStartableJobs();
+        REQUIRE(jobs.size() == 1);
+        order << jobs.first().name;
+        queue.finish(jobs.first().name);
+    }
+    CHECK(order == QStringList({"high", "high2", "low", "low2"}));
+}
+
+TEST_CASE("ExtractionQueue can raise the priority of pending jobs", "[imports]")
+{
+    ExtractionQueue queue(1);
+    queue.add(job("a", "disk-a"));
+    queue.add(job("b", "disk-b"));
+    queue.add(job("c", "disk-c"));
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"a"}));
+
+    CHECK(queue.setPriority("c", 1));
+    CHECK_FALSE(queue.setPriority("a", 1));
+    queue.finish("a");
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"c"}));
+
+    // Back to the original priority: b still comes before later jobs.
+    queue.add(job("d", "disk-d"));
+    CHECK(queue.setPriority("b", 0));
+    queue.finish("c");
+    CHECK(names(queue.takeStartableJobs()) == QStringList({"b"}));
+}
+
+TEST_CASE("ExtractionQueue reports progress weighted by size", "[imports]")
+{
+    ExtractionQueue queue(2);
+    CHECK(queue.add(job("small", "disk-a", 0, 100)));
+    queue.add(job("large", "disk-b", 0, 300));
+    CHECK_FALSE(queue.add(job("small", "disk-c")));
+    CHECK(queue.totalProgress() == 0);
+
+    queue.takeStartableJobs();
+    queue.setProgress("large", 50);
+    CHECK(queue.totalProgress() == 37);
+    queue.finish("small");
+    CHECK(queue.totalProgress() == 62);
+    queue.finish("large");
+    CHECK(queue.totalProgress() == 100);
+    CHECK(queue.isIdle());
+
+    // A new batch doesn't count finished jobs.
+    queue.add(job("next", "disk-a"));
+    CHECK(queue.totalProgress() == 0);
+    CHECK(queue.removePending("next"));
+    CHECK(queue.isIdle());
+}
@@ -0,0 +1,136 @@
+#include "test/test_helpers.h"
+
+#include "log/AsyncLogWriter.h"
+
+#include <QBuffer>
+#include <QSemaphore>
+#include <thread>
+#include <vector>
+
+using namespace mediaelch;
+
+namespace {
+
+/// Blocks each write until the test releases the gate.
+class BlockingDevice : public QIODevice
+{
+public:
+    QSemaphore entered;
+    QSemaphore gate;
+    QByteArray content;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override
+    {
+        Q_UNUSED(data);
+        Q_UNUSED(maxSize);
+        return -1;
+    }
+
+    qint64 writeData(const char* data, qint64 size) override
+    {
+        entered.release();
+        gate.acquire();
+        content.append(data, static_cast<int>(size));
+        return size;
+    }
+};
+
+} // namespace
+
+TEST_CASE("AsyncLogWriter writes messages in order", "[log]")
+{
+    QByteArray content;
+    QBuffer buffer(&content);
+    REQUIRE(buffer.open(QIODevice::WriteOnly));
+
+    SECTION("flush() writes all queued messages")
+    {
+        AsyncLogWriter writer(buffer);
+        writer.write(QtDebugMsg, "first\n");
+        writer.write(QtWarningMsg, "second\n");
+        writer.write(QtInfoMsg, "third\n");
+        writer.flush();
+        CHECK(content == "first\nsecond\nthird\n");
+        CHECK(writer.writtenCount() == 3);
+        CHECK(writer.droppedCount() == 0);
+    }
+
+    SECTION("destructor writes remaining messages")
+    {
+        {
+            AsyncLogWriter writer(buffer);
+            writer.write(QtDebugMsg, "last words\n");
+        }
+        CHECK(content == "last words\n");
+    }
+
+    SECTION("stop() writes remaining messages and rejects new ones")
+    {
+        AsyncLogWriter writer(buffer);
+        CHECK(writer.write(QtDebugMsg, "before stop\n"));
+        writer.stop();
+        CHECK_FALSE(writer.write(QtCriticalMsg, "after stop\n"));
+        writer.flush();
+        CHECK(content == "before stop\n");
+        CHECK(writer.writtenCount() == 1);
+    }
+
+    SECTION("messages of multiple threads are written completely")
+    {
+        AsyncLogWriter writer(buffer);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&writer, t]() {
+                for (int i = 0; i < 1000; ++i) {
+                    writer.write(QtDebugMsg, QStringLiteral("%1-%2\n").arg(t).arg(i));
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        writer.flush();
+        CHECK(writer.writtenCount() + writer.droppedCount() == 4000);
+        CHECK(content.count('\n') == static_cast<int>(writer.writtenCount()));
+    }
+}
+
+TEST_CASE("AsyncLogWriter drops debug messages if the buffer is full", "[log]")
+{
+    BlockingDevice device;
+    REQUIRE(device.open(QIODevice::WriteOnly | QIODevice::Unbuffered));
+
+    AsyncLogWriter writer(device, 10);
+    // Block the writer thread in its first batch so that the buffer fills up.
+    writer.write(QtWarningMsg, "warning\n");
+    device.entered.acquire();
+    for (int i = 0; i < 100; ++i) {
+        writer.write(QtDebugMsg, "debug\n");
+    }
+    writer.write(QtCriticalMsg, "critical\n");
+    REQUIRE(writer.droppedCount() == 90);
+
+    device.gate.release(1000);
+    writer.flush();
+    CHECK(writer.writtenCount() == 12);
+    CHECK(device.content.startsWith("warning\n"));
+    CHECK(device.content.contains("Dropped 90 debug and info messages because the log buffer was full"));
+    CHECK(device.content.endsWith("critical\n"));
+}
+
+TEST_CASE("AsyncLogWriter writes queued messages in crash handlers", "[log]")
+{
+    QByteArray content;
+    QBuffer buffer(&content);
+    REQUIRE(buffer.open(QIODevice::WriteOnly));
+
+    AsyncLogWriter writer(buffer);
+    writer.write(QtDebugMsg, "first\n");
+    writer.flush();
+    // Debug messages don't wake up the writer thread.
+    writer.write(QtDebugMsg, "second\n");
+    writer.flushNow();
+    CHECK(content == "first\nsecond\n");
+    CHECK(writer.writtenCount() == 2);
+}
@@ -0,0 +1,96 @@
+#include "test/test_helpers.h"
+
+#include "log/Tracer.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <thread>
+
+using namespace mediaelch;
+
+static QJsonArray readTraceEvents(const QString& filePath)
+{
+    QFile file(filePath);
+    REQUIRE(file.open(QIODevice::ReadOnly));
+    QJsonParseError error{};
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    REQUIRE(error.error == QJsonParseError::NoError);
+    return document.object().value("traceEvents").toArray();
+}
+
+static QJsonObject findEvent(const QJsonArray& events, const QString& name)
+{
+    for (const QJsonValue& value : events) {
+        if (value.toObject().value("name").toString() == name) {
+            return value.toObject();
+        }
+    }
+    return {};
+}
+
+TEST_CASE("Tracer writes Chrome trace events", "[log][tracer]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString traceFile = dir.path() + "/trace.json";
+
+    SECTION("spans are not recorded if the tracer is disabled")
+    {
+        CHECK_FALSE(Tracer::isEnabled());
+        {
+            ELCH_TRACE_SCOPE("test", "Not recorded");
+        }
+        {
+            bool isDetailEvaluated = false;
+            const auto detail = [&isDetailEvaluated]() {
+                isDetailEvaluated = true;
+                return QStringLiteral("detail");
+            };
+            ELCH_TRACE_SCOPE("test", "Not recorded with detail", detail());
+            CHECK_FALSE(isDetailEvaluated);
+        }
+        REQUIRE(Tracer::start(traceFile));
+        REQUIRE(Tracer::stop());
+        CHECK(findEvent(readTraceEvents(traceFile), "Not recorded").isEmpty());
+    }
+
+    SECTION("spans of multiple threads are recorded")
+    {
+        REQUIRE(Tracer::start(traceFile));
+        CHECK(Tracer::isEnabled());
+        {
+            ELCH_TRACE_SCOPE("test", "Outer span", QStringLiteral("/some/file.nfo"));
+            ELCH_TRACE_SCOPE("test", "Inner span");
+        }
+        std::thread worker([]() { ELCH_TRACE_SCOPE("test", "Worker span"); });
+        worker.join();
+        REQUIRE(Tracer::stop());
+        CHECK_FALSE(Tracer::isEnabled());
+
+        const QJsonArray events = readTraceEvents(traceFile);
+        const QJsonObject outer = findEvent(events, "Outer span");
+        const QJsonObject inner = findEvent(events, "Inner span");
+        const QJsonObject workerSpan = findEvent(events, "Worker span");
+        REQUIRE_FALSE(outer.isEmpty());
+        REQUIRE_FALSE(inner.isEmpty());
+        REQUIRE_FALSE(workerSpan.isEmpty());
+
+        CHECK(outer.value("ph").toString() == "X");
+        CHECK(outer.value("cat").toString() == "test");
+        CHECK(outer.value("args").toObject().value("detail").toString() == "/some/file.nfo");
+        // The inner span is destroyed first, i.e. it is contained in the outer span.
+        CHECK(inner.value("ts").toDouble() >= outer.value("ts").toDouble());
+        CHECK(inner.value("dur").toDouble() <= outer.value("dur").toDouble());
+        CHECK(inner.value("tid").toInt() == outer.value("tid").toInt());
+        CHECK(workerSpan.value("tid").toInt() != outer.value("tid").toInt());
+        CHECK_FALSE(findEvent(events, "thread_name").isEmpty());
+    }
+
+    SECTION("stop() without start() fails")
+    {
+        CHECK_FALSE(Tracer::stop());
+    }
+}
@@ -0,0 +1,64 @@
+#include "test/test_helpers.h"
+
+#include "media_centers/kodi/KodiFileIndex.h"
+
+using namespace mediaelch::kodi;
+
+TEST_CASE("KodiFileIndex matches files by their last path components", "[kodi]")
+{
+    KodiFileIndex index;
+    index.insert(1, "smb://nas/movies/Alien (1979)/Alien.mkv");
+    index.insert(2, "smb://nas/movies/Aliens (1986)/Aliens.mkv");
+    index.insert(3, "smb://nas/movies/Heat (1995)/movie.mkv");
+    index.insert(4, "smb://nas/movies/Ronin (1998)/movie.mkv");
+    index.insert(5, "stack://smb://nas/movies/Up/Up-cd1.avi , smb://nas/movies/Up/Up-cd2.avi");
+    REQUIRE(index.count() == 5);
+
+    SECTION("unique file name")
+    {
+        CHECK(index.findId({"/mnt/movies/Alien (1979)/Alien.mkv"}) == 1);
+        CHECK(index.findId({"/mnt/movies/Aliens (1986)/aliens.MKV"}) == 2);
+    }
+
+    SECTION("ambiguous file names are resolved by parent directories")
+    {
+        CHECK(index.findId({"/mnt/movies/Heat (1995)/movie.mkv"}) == 3);
+        CHECK(index.findId({"D:\\Movies\\Ronin (1998)\\movie.mkv"}) == 4);
+    }
+
+    SECTION("stacked files match in any order but not partially")
+    {
+        CHECK(index.findId({"/mnt/movies/Up/Up-cd2.avi", "/mnt/movies/Up/Up-cd1.avi"}) == 5);
+        CHECK(index.findId({"/mnt/movies/Up/Up-cd1.avi"}) == 0);
+    }
+
+    SECTION("unknown and empty files")
+    {
+        CHECK(index.findId({"/mnt/movies/Up/Down.avi"}) == 0);
+        CHECK(index.findId({}) == -1);
+    }
+
+    SECTION("items that can't be distinguished are ambiguous")
+    {
+        index.insert(6, "nfs://nas/movies/Heat (1995)/movie.mkv");
+        CHECK(index.findId({"smb://nas/movies/Heat (1995)/movie.mkv"}) == -1);
+        CHECK(index.findId({"/mnt/movies/Ronin (1998)/movie.mkv"}) == 4);
+    }
+
+    SECTION("clear removes all items")
+    {
+        index.clear();
+        CHECK(index.count() == 0);
+        CHECK(index.findId({"/mnt/movies/Alien (1979)/Alien.mkv"}) == 0);
+    }
+}
+
+TEST_CASE("KodiFileIndex matches TV show directories", "[kodi]")
+{
+    KodiFileIndex index;
+    index.insert(10, "smb://nas/tv/Firefly/");
+    index.insert(11, "smb://nas/tv/Dark/");
+
+    CHECK(index.findId({"/mnt/tv/Firefly/"}) == 10);
+    CHECK(index.findId({"/mnt/tv/Dark/"}) == 11);
+}
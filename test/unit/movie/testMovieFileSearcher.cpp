@@ -1,9 +1,90 @@
 #include "test/test_helpers.h"
 
+#include "globals/Helper.h"
+#include "movies/file_searcher/MovieFileGrouping.h"
 #include "movies/file_searcher/MovieFileSearcher.h"
 
+using namespace mediaelch;
+
 TEST_CASE("movies are found", "[movie]")
 {
     // TODO
     CHECK(true);
 }
+
+TEST_CASE("stacked base name of multi-part movies", "[movie][utils]")
+{
+    CHECK(helper::stackedBaseName("Movie.cd1.avi") == "Movie");
+    CHECK(helper::stackedBaseName("Movie - Part 2.mkv") == "Movie");
+    CHECK(helper::stackedBaseName("Movie_dvd3_extra.mkv") == "Movie");
+    CHECK(helper::stackedBaseName("Movie-disc-b.mkv") == "Movie");
+    CHECK(helper::stackedBaseName("Movie (2000).mkv") == "Movie (2000).mkv");
+}
+
+TEST_CASE("stacked files are grouped", "[movie][utils]")
+{
+    SECTION("single group")
+    {
+        const QStringList files{"/a/Movie.cd1.avi", "/a/Movie.cd2.avi", "/a/Movie.cd3.avi"};
+        const QVector<QStringList> expected{{"/a/Movie.cd3.avi", "/a/Movie.cd1.avi", "/a/Movie.cd2.avi"}};
+        CHECK(groupStackedFiles(files) == expected);
+    }
+
+    SECTION("groups are ordered by base name")
+    {
+        const QStringList files{"/a/B.part1.mkv", "/a/A.part1.mkv", "/a/B.part2.mkv", "/a/C.mkv"};
+        const QVector<QStringList> groups = groupStackedFiles(files);
+        REQUIRE(groups.size() == 3);
+        CHECK(groups[0] == QStringList{"/a/A.part1.mkv"});
+        CHECK(groups[1] == QStringList{"/a/B.part2.mkv", "/a/B.part1.mkv"});
+        CHECK(groups[2] == QStringList{"/a/C.mkv"});
+    }
+}
+
+TEST_CASE("multi-part files are grouped", "[movie][utils]")
+{
+    SECTION("parts are grouped")
+    {
+        QStringList files{"Other.avi", "Movie-cd2.avi", "Movie-cd1.avi", "Trailer-b.mkv"};
+        files.sort();
+        const QVector<QStringList> expected{{"Movie-cd1.avi", "Movie-cd2.avi"}, {"Other.avi"}, {"Trailer-b.mkv"}};
+        CHECK(groupMultiPartFiles(files) == expected);
+    }
+
+    SECTION("no parts")
+    {
+        const QStringList files{"A.mkv", "B.mkv"};
+        const QVector<QStringList> expected{{"A.mkv"}, {"B.mkv"}};
+        CHECK(groupMultiPartFiles(files) == expected);
+    }
+}
+
+TEST_CASE("disc structure index finds nested files", "[movie][utils]")
+{
+    DiscStructureIndex index;
+    CHECK_FALSE(index.containsFile("/movies/Movie/BDMV/index.bdmv"));
+
+    index.addDirectory("/movies/Movie");
+    CHECK(index.containsFile("/movies/Movie/BDMV/index.bdmv"));
+    CHECK(index.containsFile("/movies/Movie\\BDMV\\index.bdmv"));
+    CHECK(index.containsFile("/movies/Movie/index.bdmv"));
+    CHECK_FALSE(index.containsFile("/movies/Movie 2/BDMV/index.bdmv"));
+    CHECK_FALSE(index.containsFile("/movies/Movie"));
+    CHECK_FALSE(index.containsFile("/movies/index.bdmv"));
+}
+
+TEST_CASE("movie extras are detected", "[movie][utils]")
+{
+    using Rule = FileNameMatcher::Rule;
+    FileNameMatcher matcher;
+    addMovieFileRules(matcher);
+    matcher.compile();
+
+    CHECK(matcher.matchFile("Movie-trailer.mkv").rule == Rule::MovieExtra);
+    CHECK(matcher.matchFile("Movie-Sample.avi").rule == Rule::MovieExtra);
+    CHECK(matcher.matchFile("Movie-deleted scene.mkv").rule == Rule::MovieExtra);
+    CHECK_FALSE(matcher.matchFile("Movie.mkv").hasMatch());
+    CHECK_FALSE(matcher.matchFile("Movie Trailer (2000).mkv").hasMatch());
+    CHECK(matcher.matchFolder("Movie-featurette").rule == Rule::MovieExtra);
+    CHECK(matcher.matchFolder(".actors").rule == Rule::SkippedFolder);
+}
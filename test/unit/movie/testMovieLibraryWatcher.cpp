@@ -0,0 +1,59 @@
+#include "test/test_helpers.h"
+
+#include "file/FileFilter.h"
+#include "file/FileNameMatcher.h"
+#include "movies/file_searcher/MovieFileGrouping.h"
+#include "movies/file_searcher/MovieLibraryWatcher.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace mediaelch;
+
+static void createFile(const QString& path)
+{
+    QFile file(path);
+    REQUIRE(file.open(QIODevice::WriteOnly));
+    file.write("movie");
+}
+
+TEST_CASE("MovieLibraryWatcher finds new and removed movie files", "[movie]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    const QString root = QDir(dir.path()).absolutePath();
+    for (const char* subDir : {"Existing", "New", "Removed", "Excluded", "Unchanged", ".actors"}) {
+        REQUIRE(QDir(root).mkpath(subDir));
+    }
+
+    createFile(root + "/Existing/Existing.mkv");
+    createFile(root + "/Unchanged/Unchanged.mkv");
+    createFile(root + "/New/New.mkv");
+    createFile(root + "/Excluded/Excluded.part.mkv");
+    createFile(root + "/Excluded/Excluded-trailer.mkv");
+    createFile(root + "/.actors/Actor.mkv");
+    const QSet<QString> knownFiles{root + "/Existing/Existing.mkv",
+        root + "/Removed/Removed.mkv",
+        root + "/Unchanged/Unchanged.mkv",
+        root + "/Unchanged/Gone.mkv"};
+
+    FileNameMatcher matcher;
+    matcher.addFilePattern(QRegularExpression("\\.part\\."));
+    addMovieFileRules(matcher);
+    matcher.compile();
+    const FileFilter filter({"*.mkv"});
+
+    // "Unchanged" is not reported as changed, so its missing file is ignored.
+    const QStringList changedDirectories{root + "/Existing",
+        root + "/New",
+        root + "/Removed",
+        root + "/Excluded",
+        root + "/.actors"};
+    const MovieFileChanges changes = findMovieFileChanges(changedDirectories, knownFiles, filter, matcher);
+
+    CHECK(changes.newFiles.keys() == QStringList{root + "/New"});
+    CHECK(changes.newFiles.value(root + "/New") == QStringList{root + "/New/New.mkv"});
+    CHECK(changes.removedFiles == QStringList{root + "/Removed/Removed.mkv"});
+    CHECK(changes.changedDirectories() == QSet<QString>{root + "/New", root + "/Removed"});
+}
@@ -0,0 +1,141 @@
+#include "test/test_helpers.h"
+
+#include "movies/Movie.h"
+#include "movies/MovieSaveQueue.h"
+#include "test/mocks/media_centers/MockMediaCenter.h"
+
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTimer>
+
+#include <functional>
+
+using namespace mediaelch;
+
+namespace {
+
+struct SaveResult
+{
+    int saved = -1;
+    int failed = -1;
+    bool canceled = false;
+    bool isFinished = false;
+    QStringList savedMovies;
+    QVector<int> progress;
+};
+
+QVector<Movie*> createMovies(QObject& parent, int count)
+{
+    QVector<Movie*> movies;
+    for (int i = 1; i <= count; ++i) {
+        auto* movie = new Movie({}, &parent);
+        movie->setName(QStringLiteral("Movie %1").arg(i));
+        // Avoids reading stream details (and the settings) in MovieController::beforeSave().
+        movie->setStreamDetailsLoaded(true);
+        movies.append(movie);
+    }
+    return movies;
+}
+
+/// Connects to the queue's signals, calls start and waits until the queue is finished.
+SaveResult runQueue(MovieSaveQueue& queue, const std::function<void()>& start)
+{
+    SaveResult result;
+    QEventLoop loop;
+    QObject::connect(&queue, &MovieSaveQueue::sigMovieSaved, &loop, [&result](Movie* movie, bool saved) {
+        if (saved) {
+            result.savedMovies.append(movie->name());
+        }
+    });
+    QObject::connect(&queue, &MovieSaveQueue::sigProgress, &loop, [&result](int done, int total) {
+        Q_UNUSED(total);
+        result.progress.append(done);
+    });
+    QObject::connect(&queue, &MovieSaveQueue::sigFinished, &loop, [&](int saved, int failed, bool canceled) {
+        result.saved = saved;
+        result.failed = failed;
+        result.canceled = canceled;
+        result.isFinished = true;
+        loop.quit();
+    });
+    start();
+    if (!result.isFinished) {
+        QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+        loop.exec();
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("MovieSaveQueue saves movies", "[movie]")
+{
+    QTemporaryDir dir;
+    REQUIRE(dir.isValid());
+    MockMediaCenter mediaCenter;
+    mediaCenter.directory = dir.path();
+    MovieSaveQueue queue(mediaCenter, nullptr);
+    QObject owner;
+
+    SECTION("all movies are saved and progress is reported in order")
+    {
+        const QVector<Movie*> movies = createMovies(owner, 20);
+        const SaveResult result = runQueue(queue, [&]() { queue.save(movies); });
+
+        REQUIRE(result.isFinished);
+        CHECK(result.saved == 20);
+        CHECK(result.failed == 0);
+        CHECK_FALSE(result.canceled);
+        CHECK(result.savedMovies.size() == 20);
+        REQUIRE(result.progress.size() == 21);
+        for (int i = 0; i < result.progress.size(); ++i) {
+            CHECK(result.progress[i] == i);
+        }
+        for (Movie* movie : movies) {
+            CHECK(QFile::exists(mediaCenter.nfoFilePath(movie)));
+        }
+        CHECK_FALSE(queue.isRunning());
+    }
+
+    SECTION("failed movies are counted")
+    {
+        const QVector<Movie*> movies = createMovies(owner, 5);
+        mediaCenter.failingMovies = {"Movie 2", "Movie 4"};
+        const SaveResult result = runQueue(queue, [&]() { queue.save(movies); });
+
+        REQUIRE(result.isFinished);
+        CHECK(result.saved == 3);
+        CHECK(result.failed == 2);
+        CHECK_FALSE(result.savedMovies.contains("Movie 2"));
+        CHECK_FALSE(result.savedMovies.contains("Movie 4"));
+        CHECK(mediaCenter.finishedMovies.size() == 5);
+    }
+
+    SECTION("canceling keeps movies that were not written yet")
+    {
+        const QVector<Movie*> movies = createMovies(owner, 20);
+        const SaveResult result = runQueue(queue, [&]() {
+            queue.save(movies);
+            // NFO files are created asynchronously, so no movie reached the write step yet.
+            queue.cancel();
+        });
+
+        REQUIRE(result.isFinished);
+        CHECK(result.canceled);
+        CHECK(result.saved == 0);
+        CHECK(result.failed == 0);
+        CHECK(mediaCenter.finishedMovies.isEmpty());
+        CHECK(QDir(dir.path()).entryList(QDir::Files).isEmpty());
+        CHECK_FALSE(queue.isRunning());
+    }
+
+    SECTION("an empty list finishes immediately")
+    {
+        const SaveResult result = runQueue(queue, [&]() { queue.save({}); });
+        REQUIRE(result.isFinished);
+        CHECK(result.saved == 0);
+        CHECK(result.failed == 0);
+    }
+}
@@ -0,0 +1,99 @@
+#include "test/test_helpers.h"
+
+#include "network/HostRateLimiter.h"
+
+using namespace mediaelch::network;
+
+TEST_CASE("HostRateLimiter token bucket", "[network]")
+{
+    HostRateLimiter limiter;
+    limiter.setPolicy("example.com", {2.0, 2, 6});
+
+    CHECK(limiter.waitTime("example.com", 0) == 0);
+    limiter.acquire("example.com", 0);
+    CHECK(limiter.waitTime("example.com", 0) == 0);
+    limiter.acquire("example.com", 0);
+
+    // Bucket is empty; refilled with two tokens per second.
+    CHECK(limiter.waitTime("example.com", 0) == 500);
+    CHECK(limiter.waitTime("example.com", 250) == 250);
+    CHECK(limiter.waitTime("example.com", 500) == 0);
+
+    SECTION("other hosts are not affected")
+    {
+        CHECK(limiter.waitTime("example.org", 0) == 0);
+    }
+}
+
+TEST_CASE("HostRateLimiter limits concurrent requests", "[network]")
+{
+    HostRateLimiter limiter({0.0, 1, 2});
+
+    limiter.acquire("example.com", 0);
+    limiter.acquire("example.com", 0);
+    CHECK(limiter.activeRequests("example.com") == 2);
+    CHECK(limiter.waitTime("example.com", 0) == -1);
+
+    limiter.release("example.com", HostRateLimiter::Outcome::Success, 10);
+    CHECK(limiter.waitTime("example.com", 10) == 0);
+}
+
+TEST_CASE("HostRateLimiter backs off when throttled", "[network]")
+{
+    HostRateLimiter limiter({0.0, 1, 4});
+    CHECK(limiter.concurrencyLimit("example.com") == 4);
+
+    SECTION("Retry-After is respected and concurrency is halved")
+    {
+        limiter.acquire("example.com", 0);
+        limiter.release("example.com", HostRateLimiter::Outcome::Throttled, 0, 3000);
+        CHECK(limiter.concurrencyLimit("example.com") == 2);
+        CHECK(limiter.waitTime("example.com", 1000) == 2000);
+        CHECK(limiter.waitTime("example.com", 3000) == 0);
+
+        // Additive increase after "limit" successful requests.
+        limiter.release("example.com", HostRateLimiter::Outcome::Success, 3000);
+        CHECK(limiter.concurrencyLimit("example.com") == 2);
+        limiter.release("example.com", HostRateLimiter::Outcome::Success, 3000);
+        CHECK(limiter.concurrencyLimit("example.com") == 3);
+    }
+
+    SECTION("exponential backoff without Retry-After")
+    {
+        limiter.release("example.com", HostRateLimiter::Outcome::Throttled, 0);
+        CHECK(limiter.waitTime("example.com", 0) == 1000);
+        limiter.release("example.com", HostRateLimiter::Outcome::Throttled, 1000);
+        CHECK(limiter.waitTime("example.com", 1000) == 2000);
+        CHECK(limiter.concurrencyLimit("example.com") == 1);
+    }
+
+    SECTION("network errors don't change limits")
+    {
+        limiter.release("example.com", HostRateLimiter::Outcome::Failed, 0);
+        CHECK(limiter.concurrencyLimit("example.com") == 4);
+        CHECK(limiter.waitTime("example.com", 0) == 0);
+    }
+}
+
+TEST_CASE("HostRateLimiter policies apply to subdomains", "[network]")
+{
+    HostRateLimiter limiter;
+    limiter.setPolicy("musicbrainz.org", {1.0, 1, 1});
+
+    CHECK(limiter.policy("musicbrainz.org").requestsPerSecond == 1.0);
+    CHECK(limiter.policy("Beta.MusicBrainz.org").maxConcurrentRequests == 1);
+    CHECK(limiter.policy("notmusicbrainz.org").requestsPerSecond == 0.0);
+}
+
+TEST_CASE("HostRateLimiter parses Retry-After", "[network]")
+{
+    const QDateTime now(QDate(2015, 10, 21), QTime(7, 27, 0), Qt::UTC);
+
+    CHECK(HostRateLimiter::parseRetryAfter("120", now) == 120000);
+    CHECK(HostRateLimiter::parseRetryAfter(" 0 ", now) == 0);
+    CHECK(HostRateLimiter::parseRetryAfter("Wed, 21 Oct 2015 07:28:00 GMT", now) == 60000);
+    CHECK(HostRateLimiter::parseRetryAfter("Wed, 21 Oct 2015 07:00:00 GMT", now) == 0);
+    CHECK(HostRateLimiter::parseRetryAfter("", now) == -1);
+    CHECK(HostRateLimiter::parseRetryAfter("-5", now) == -1);
+    CHECK(HostRateLimiter::parseRetryAfter("soon", now) == -1);
+}
@@ -0,0 +1,156 @@
+#include "test/test_helpers.h"
+
+#include "network/NetworkService.h"
+
+#include <QEventLoop>
+#include <QHash>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+using namespace mediaelch::network;
+
+namespace {
+
+QByteArray httpResponse(int status, const QByteArray& reason, const QByteArray& body, const QByteArray& headers = {})
+{
+    return "HTTP/1.1 " + QByteArray::number(status) + " " + reason + "\r\n"
+           + "Content-Length: " + QByteArray::number(body.size()) + "\r\n" //
+           + "Connection: close\r\n" + headers + "\r\n" + body;
+}
+
+/// \brief Local HTTP server that answers GET requests with scripted responses.
+/// The last response is repeated once all others were sent.
+class StubHttpServer
+{
+public:
+    explicit StubHttpServer(QVector<QByteArray> responses) : m_responses{std::move(responses)}
+    {
+        QObject::connect(&m_server, &QTcpServer::newConnection, &m_server, [this]() {
+            while (QTcpSocket* socket = m_server.nextPendingConnection()) {
+                QObject::connect(socket, &QTcpSocket::readyRead, &m_server, [this, socket]() { onReadyRead(socket); });
+                QObject::connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+            }
+        });
+        REQUIRE(m_server.listen(QHostAddress::LocalHost));
+    }
+
+    QUrl url(const QString& path) const
+    {
+        return QUrl(QStringLiteral("http://127.0.0.1:%1%2").arg(m_server.serverPort()).arg(path));
+    }
+
+    int requestCount() const { return m_requestCount; }
+
+private:
+    void onReadyRead(QTcpSocket* socket)
+    {
+        QByteArray& buffer = m_buffers[socket];
+        buffer += socket->readAll();
+        if (!buffer.contains("\r\n\r\n")) {
+            return;
+        }
+        m_buffers.remove(socket);
+        socket->write(m_responses.value(m_requestCount, m_responses.last()));
+        ++m_requestCount;
+        socket->disconnectFromHost();
+    }
+
+    QTcpServer m_server;
+    QVector<QByteArray> m_responses;
+    QHash<QTcpSocket*, QByteArray> m_buffers;
+    int m_requestCount = 0;
+};
+
+bool waitForFinished(QNetworkReply* reply)
+{
+    if (!reply->isFinished()) {
+        QEventLoop loop;
+        QObject::connect(reply, &QNetworkReply::finished, &loop, &QEventLoop::quit);
+        QTimer::singleShot(5000, &loop, &QEventLoop::quit);
+        loop.exec();
+    }
+    return reply->isFinished();
+}
+
+} // namespace
+
+TEST_CASE("NetworkService passes responses through", "[network]")
+{
+    StubHttpServer server({httpResponse(200, "OK", "hello")});
+    NetworkService service;
+
+    QNetworkReply* reply = service.get(QNetworkRequest(server.url("/movie")));
+    REQUIRE(waitForFinished(reply));
+
+    CHECK(reply->error() == QNetworkReply::NoError);
+    CHECK(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200);
+    CHECK(reply->readAll() == "hello");
+    CHECK(server.requestCount() == 1);
+    reply->deleteLater();
+}
+
+TEST_CASE("NetworkService retries throttled requests", "[network]")
+{
+    StubHttpServer server({httpResponse(429, "Too Many Requests", "slow down", "Retry-After: 0\r\n"),
+        httpResponse(200, "OK", "hello")});
+    NetworkService service;
+
+    QueuedNetworkReply* reply = service.get(QNetworkRequest(server.url("/movie")));
+    REQUIRE(waitForFinished(reply));
+
+    CHECK(reply->error() == QNetworkReply::NoError);
+    CHECK(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 200);
+    CHECK(reply->readAll() == "hello");
+    CHECK(reply->attempts() == 2);
+    CHECK(server.requestCount() == 2);
+    reply->deleteLater();
+}
+
+TEST_CASE("NetworkService gives up after the maximum number of retries", "[network]")
+{
+    StubHttpServer server({httpResponse(429, "Too Many Requests", "slow down", "Retry-After: 0\r\n")});
+    NetworkService service;
+    service.setMaxRetries(1);
+
+    QNetworkReply* reply = service.get(QNetworkRequest(server.url("/movie")));
+    REQUIRE(waitForFinished(reply));
+
+    CHECK(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 429);
+    CHECK(reply->readAll() == "slow down");
+    CHECK(server.requestCount() == 2);
+    reply->deleteLater();
+}
+
+TEST_CASE("NetworkService queues requests per host", "[network]")
+{
+    StubHttpServer server({httpResponse(200, "OK", "hello")});
+    NetworkService service;
+    service.rateLimiter().setPolicy("127.0.0.1", {0.0, 1, 1});
+
+    QueuedNetworkReply* first = service.get(QNetworkRequest(server.url("/first")));
+    QueuedNetworkReply* second = service.get(QNetworkRequest(server.url("/second")));
+    CHECK(first->isRunning());
+    CHECK_FALSE(second->isRunning());
+
+    SECTION("queued requests are sent once a slot is free")
+    {
+        REQUIRE(waitForFinished(second));
+        CHECK(first->isFinished());
+        CHECK(second->readAll() == "hello");
+        CHECK(server.requestCount() == 2);
+    }
+
+    SECTION("queued requests can be aborted")
+    {
+        second->abort();
+        CHECK(second->isFinished());
+        CHECK(second->error() == QNetworkReply::OperationCanceledError);
+
+        REQUIRE(waitForFinished(first));
+        CHECK(server.requestCount() == 1);
+    }
+
+    first->deleteLater();
+    second->deleteLater();
+}
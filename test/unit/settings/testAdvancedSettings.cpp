@@ -28,6 +28,9 @@ TEST_CASE("Advanced Settings XML", "[settings]")
         CHECK(settings.useFirstStudioOnly() == defaults.useFirstStudioOnly());
         CHECK(settings.forceCache() == defaults.forceCache());
         CHECK(settings.portableMode() == defaults.portableMode());
+        CHECK(settings.verifyImportedFiles() == defaults.verifyImportedFiles());
+        CHECK(settings.parallelExtractions() == defaults.parallelExtractions());
+        CHECK(settings.watchLibrary() == defaults.watchLibrary());
         CHECK(settings.episodeThumbnailDimensions() == defaults.episodeThumbnailDimensions());
         CHECK(messages.isEmpty());
     }
@@ -42,6 +45,9 @@ TEST_CASE("Advanced Settings XML", "[settings]")
             <genres>
                 <map from="SciFi" to="Science Fiction" />
             </genres>
+            <verifyImportedFiles>true</verifyImportedFiles>
+            <parallelExtractions>4</parallelExtractions>
+            <watchLibrary>true</watchLibrary>
         )xml");
 
         AdvancedSettings settings = AdvancedSettingsXmlReader::loadFromXml(emptyXml).first;
@@ -50,6 +56,9 @@ TEST_CASE("Advanced Settings XML", "[settings]")
         CHECK(settings.logFile() == "./MediaElchTest.log");
         REQUIRE(settings.genreMappings().size() == 1);
         CHECK(settings.genreMappings()["SciFi"] == "Science Fiction");
+        CHECK(settings.verifyImportedFiles());
+        CHECK(settings.parallelExtractions() == 4);
+        CHECK(settings.watchLibrary());
     }
 
     const auto checkEpisodeThumbValues = [](auto pair) {
@@ -0,0 +1,227 @@
+#include "test/test_helpers.h"
+
+#include "globals/Helper.h"
+#include "tv_shows/EpisodeFileNameParser.h"
+
+#include <QRegExp>
+#include <QStringList>
+
+using mediaelch::EpisodeFileNameParser;
+
+namespace {
+
+// Reference implementation: QRegExp based parser that was used by TvShowFileSearcher
+// before EpisodeFileNameParser was introduced. The new parser must yield identical results.
+
+QString legacyFileName(const QString& file)
+{
+    QStringList filenameParts = file.split('/');
+    QString filename = filenameParts.last();
+    if (filename.endsWith("VIDEO_TS.IFO", Qt::CaseInsensitive)) {
+        // Note: the original checked for "count() > 1" which reads out of bounds for "dir/VIDEO_TS.IFO".
+        if (filenameParts.count() > 2 && helper::isDvd(file)) {
+            filename = filenameParts.at(filenameParts.count() - 3);
+        } else if (filenameParts.count() > 2 && helper::isDvd(file, true)) {
+            filename = filenameParts.at(filenameParts.count() - 2);
+        }
+    } else if (filename.endsWith("index.bdmv", Qt::CaseInsensitive)) {
+        if (filenameParts.count() > 2) {
+            filename = filenameParts.at(filenameParts.count() - 3);
+        }
+    }
+    return filename;
+}
+
+SeasonNumber legacySeasonNumber(const QString& file)
+{
+    const QString filename = legacyFileName(file);
+    QRegExp rx(R"(S(\d+)[ ._-]?E)", Qt::CaseInsensitive);
+    if (rx.indexIn(filename) != -1) {
+        return SeasonNumber(rx.cap(1).toInt());
+    }
+    rx.setPattern("(\\d+)?x(\\d+)");
+    if (rx.indexIn(filename) != -1) {
+        return SeasonNumber(rx.cap(1).toInt());
+    }
+    rx.setPattern("(\\d+).(\\d){2,4}");
+    if (rx.indexIn(filename) != -1) {
+        return SeasonNumber(rx.cap(1).toInt());
+    }
+    rx.setPattern("Season[ ._]?(\\d+)[ ._]?Episode");
+    if (rx.indexIn(filename) != -1) {
+        return SeasonNumber(rx.cap(1).toInt());
+    }
+    return SeasonNumber::SpecialsSeason;
+}
+
+QVector<EpisodeNumber> legacyEpisodeNumbers(const QString& file)
+{
+    const QString filename = legacyFileName(file);
+    QVector<EpisodeNumber> episodes;
+
+    auto scanWithPattern = [&](const QString& pattern, bool mayBeAmbiguous) -> bool {
+        QRegExp rx(pattern);
+        rx.setCaseSensitivity(Qt::CaseInsensitive);
+
+        int pos = 0;
+        int lastPos = -1;
+        while ((pos = rx.indexIn(filename, pos)) != -1) {
+            if (mayBeAmbiguous && lastPos != -1 && lastPos < pos + 5) {
+                return true;
+            }
+            episodes << EpisodeNumber(rx.cap(2).toInt());
+            pos += rx.matchedLength();
+            lastPos = pos;
+        }
+        pos = lastPos;
+
+        if (episodes.isEmpty()) {
+            return false;
+        }
+        if (episodes.count() == 1) {
+            rx.setPattern(R"(^[-_EeXx]+([0-9]+)($|[\-\._\sE]))");
+            while (rx.indexIn(filename, pos, QRegExp::CaretAtOffset) != -1) {
+                episodes << EpisodeNumber(rx.cap(1).toInt());
+                pos += rx.matchedLength() - 1;
+            }
+        }
+        return true;
+    };
+
+    const QVector<QPair<QString, bool>> patterns{{R"(S(\d+)[ ._-]?E(\d+))", false},
+        {R"(S(\d+)[ ._-]?EP(\d+))", false},
+        {R"(Season[ ._-]?(\d+)[._ -]?Episode[ ._-]?(\d+))", false},
+        {R"((\d+)x(\d+))", true},
+        {R"((\d+).(\d){2,4})", true}};
+
+    for (const auto& pattern : patterns) {
+        if (scanWithPattern(pattern.first, pattern.second)) {
+            break;
+        }
+    }
+    return episodes;
+}
+
+QStringList fileNameCorpus()
+{
+    const QStringList names{"S01E4.mov",
+        "S01E04.mov",
+        "S01E004.mov",
+        "S01E14.mov",
+        "S01E142.mov",
+        "S01E1425.mov",
+        "s02e03.mkv",
+        "S2.E3.mkv",
+        "S02_E03.mkv",
+        "S02-E03.mkv",
+        "S02EP03.mkv",
+        "S02 EP03.mkv",
+        "Season.01-Episode.142.mov",
+        "Season.01 Episode.142.mov",
+        "Season01Episode14.mov",
+        "season 3 episode 7.avi",
+        "Name_S01E14.mov",
+        "Name with space S01E14.mov",
+        "Name_before_S01E14.mov",
+        "Name_before_S01E142.mov",
+        "Name_before_S01E1425.mov",
+        "S01E14_Name.mov",
+        "S01E14 Name with space.mov",
+        "S01E14_Name_before.mov",
+        "S01E142_Name_before.mov",
+        "S01E1425_Name_before.mov",
+        "S01E4-S01E5.mov",
+        "S01E4-S01E05.mov",
+        "S01E14-S01E115.mov",
+        "S01E004-S01E005.mov",
+        "S01E004-S01E005-S01E15.mov",
+        "Name_S01E4-S01E5.mov",
+        "S01E4 Name with space S01E05 Second name.mov",
+        "S01E14-S01E115 - Some name.mov",
+        "S01E004.S01E005-Another-Title.mov",
+        "S01E04-E05.mkv",
+        "S01E04E05E06.mkv",
+        "S01E04-05.mkv",
+        "S01E04_05_06.mkv",
+        "S01E04xE05.mkv",
+        "S01E04-E05-Title.mkv",
+        "1x02.avi",
+        "01x02 - Title.avi",
+        "1x02x03.avi",
+        "1x02-1x03.avi",
+        "21x04 - Hammond vs. 6x6.mp4",
+        "x05 - Only episode.mp4",
+        "Show 102.avi",
+        "Show 1102 Title.avi",
+        "Show.2010.1080p.mkv",
+        "Show 1.023.avi",
+        "Special.mkv",
+        "no numbers at all.mkv",
+        "",
+        "Sx.mkv",
+        "S99999E99999.mkv",
+        "Ünicode Šhow S03E07 – Tïtle.mkv"};
+
+    const QStringList directories{"", "dir/", "/media/Shows/My Show/Season 1/", "C:/TV/Show/"};
+
+    QStringList corpus;
+    for (const QString& directory : directories) {
+        for (const QString& name : names) {
+            corpus << directory + name;
+        }
+    }
+    // Disc structures: the relevant name is the folder name.
+    corpus << "/media/Show/S01E02/VIDEO_TS/VIDEO_TS.IFO"
+           << "Show S01E03/VIDEO_TS.IFO"
+           << "VIDEO_TS.IFO"
+           << "/media/Show/S01E02-E03/BDMV/index.bdmv"
+           << "S01E04/BDMV/index.bdmv"
+           << "BDMV/index.bdmv"
+           << "index.bdmv";
+    return corpus;
+}
+
+} // namespace
+
+TEST_CASE("EpisodeFileNameParser yields same results as QRegExp implementation", "[show][utils]")
+{
+    const QStringList corpus = fileNameCorpus();
+    for (const QString& file : corpus) {
+        CAPTURE(file);
+        CHECK(EpisodeFileNameParser::seasonNumber(file) == legacySeasonNumber(file));
+        CHECK(EpisodeFileNameParser::episodeNumbers(file) == legacyEpisodeNumbers(file));
+    }
+}
+
+TEST_CASE("EpisodeFileNameParser extracts relevant file name", "[show][utils]")
+{
+    CHECK(EpisodeFileNameParser::fileNameForParsing("dir/S01E04.mkv") == "S01E04.mkv");
+    CHECK(EpisodeFileNameParser::fileNameForParsing("S01E04.mkv") == "S01E04.mkv");
+    CHECK(EpisodeFileNameParser::fileNameForParsing("/media/S01E04/BDMV/index.bdmv") == "S01E04");
+    CHECK(EpisodeFileNameParser::fileNameForParsing("BDMV/index.bdmv") == "index.bdmv");
+}
+
+TEST_CASE("EpisodeFileNameParser benchmark", "[.benchmark][show][utils]")
+{
+    const QStringList corpus = fileNameCorpus();
+
+    BENCHMARK("EpisodeFileNameParser")
+    {
+        int sum = 0;
+        for (const QString& file : corpus) {
+            sum += EpisodeFileNameParser::seasonNumber(file).toInt();
+            sum += EpisodeFileNameParser::episodeNumbers(file).size();
+        }
+        return sum;
+    };
+
+    BENCHMARK("QRegExp reference")
+    {
+        int sum = 0;
+        for (const QString& file : corpus) {
+            sum += legacySeasonNumber(file).toInt();
+            sum += legacyEpisodeNumbers(file).size();
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,62 @@
+#include "test/test_helpers.h"
+
+#include "tv_shows/TvShow.h"
+#include "tv_shows/TvShowEpisode.h"
+
+static TvShowEpisode* addEpisode(TvShow& show, int season, int episode, bool isDummy = false)
+{
+    auto* tvShowEpisode = new TvShowEpisode({}, &show);
+    tvShowEpisode->setSeason(SeasonNumber(season));
+    tvShowEpisode->setEpisode(EpisodeNumber(episode));
+    tvShowEpisode->setIsDummy(isDummy);
+    show.addEpisode(tvShowEpisode);
+    return tvShowEpisode;
+}
+
+TEST_CASE("TvShow episode index", "[tvshow]")
+{
+    TvShow show;
+    TvShowEpisode* s2e1 = addEpisode(show, 2, 1);
+    TvShowEpisode* s1e2 = addEpisode(show, 1, 2);
+    TvShowEpisode* s3e1 = addEpisode(show, 3, 1, true);
+
+    SECTION("episodes are found by season and episode number")
+    {
+        CHECK(show.episode(SeasonNumber(2), EpisodeNumber(1)) == s2e1);
+        CHECK(show.episode(SeasonNumber(1), EpisodeNumber(2)) == s1e2);
+        CHECK(show.episode(SeasonNumber(3), EpisodeNumber(1)) == s3e1);
+        CHECK(show.episode(SeasonNumber(1), EpisodeNumber(1)) == nullptr);
+        CHECK(show.episodeCount() == 3);
+    }
+
+    SECTION("seasons are sorted")
+    {
+        CHECK(show.seasons() == QVector<SeasonNumber>({SeasonNumber(1), SeasonNumber(2), SeasonNumber(3)}));
+        CHECK(show.seasons(false) == QVector<SeasonNumber>({SeasonNumber(1), SeasonNumber(2)}));
+        CHECK(show.isDummySeason(SeasonNumber(3)));
+        CHECK_FALSE(show.isDummySeason(SeasonNumber(2)));
+        CHECK(show.hasDummyEpisodes(SeasonNumber(3)));
+        CHECK_FALSE(show.hasDummyEpisodes(SeasonNumber(1)));
+        CHECK(show.hasDummyEpisodes());
+    }
+
+    SECTION("changed episode numbers are indexed")
+    {
+        s1e2->setEpisode(EpisodeNumber(1));
+        CHECK(show.episode(SeasonNumber(1), EpisodeNumber(2)) == nullptr);
+        CHECK(show.episode(SeasonNumber(1), EpisodeNumber(1)) == s1e2);
+
+        s1e2->setSeason(SeasonNumber(4));
+        CHECK(show.episode(SeasonNumber(4), EpisodeNumber(1)) == s1e2);
+        CHECK(show.seasons() == QVector<SeasonNumber>({SeasonNumber(2), SeasonNumber(3), SeasonNumber(4)}));
+    }
+
+    SECTION("episodes that are not part of the show are ignored")
+    {
+        TvShowEpisode episode({}, &show);
+        episode.setSeason(SeasonNumber(1));
+        episode.setEpisode(EpisodeNumber(2));
+        CHECK(show.episode(SeasonNumber(1), EpisodeNumber(2)) == s1e2);
+        CHECK(show.episodeCount() == 3);
+    }
+}